@@ -0,0 +1,120 @@
+#ifndef _BENCHMARK_H
+#define _BENCHMARK_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+/**
+ * Cronometro usato dai benchmark per misurare il tempo trascorso.
+ */
+class BenchmarkTimer
+{
+    private:
+        std::chrono::steady_clock::time_point _start; // Istante di partenza
+
+    public:
+        BenchmarkTimer();
+
+        void restart();
+        double elapsedMilliseconds() const;
+};
+
+/**
+ * Crea un cronometro gia' avviato
+ */
+inline BenchmarkTimer::BenchmarkTimer()
+{
+    this->restart();
+}
+
+/**
+ * Riavvia il cronometro
+ */
+inline void BenchmarkTimer::restart()
+{
+    this->_start = std::chrono::steady_clock::now();
+}
+
+/**
+ * Restituisce i millisecondi trascorsi dall'ultimo avvio
+ *
+ * @return Millisecondi trascorsi
+ */
+inline double BenchmarkTimer::elapsedMilliseconds() const
+{
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - this->_start;
+    return elapsed.count();
+}
+
+
+/**
+ * Generatore pseudo-casuale xorshift64, deterministico e indipendente dalla libreria
+ * standard, cosi' che tutte le strutture confrontate ricevano la stessa sequenza.
+ *
+ * @param state : Stato del generatore, aggiornato ad ogni chiamata
+ * @return Numero pseudo-casuale a 64 bit
+ */
+inline uint64_t benchmarkRandom(uint64_t& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return state;
+}
+
+/**
+ * Legge un argomento numerico dalla riga di comando, oppure restituisce defaultValue
+ *
+ * @param argc : Numero di argomenti
+ * @param argv : Argomenti
+ * @param index : Posizione dell'argomento
+ * @param defaultValue : Valore di default
+ * @return Valore dell'argomento
+ */
+inline uint64_t benchmarkArgument(int argc, char const *argv[], int index, uint64_t defaultValue)
+{
+    if (index < argc)
+    {
+        return std::strtoull(argv[index], nullptr, 10);
+    }
+
+    return defaultValue;
+}
+
+/**
+ * Stampa una riga dei risultati del benchmark
+ *
+ * @param name : Nome della prova
+ * @param milliseconds : Tempo impiegato
+ * @param operations : Numero di operazioni eseguite
+ */
+inline void benchmarkReport(const std::string& name, double milliseconds, uint64_t operations)
+{
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2) << milliseconds << " ms"
+              << std::setw(12) << std::setprecision(1) << (operations / (milliseconds * 1000.0)) << " Mop/s"
+              << std::endl;
+}
+
+/**
+ * Stampa una riga dei risultati del benchmark per le prove che leggono dati, con il
+ * throughput in megabyte al secondo
+ *
+ * @param name : Nome della prova
+ * @param milliseconds : Tempo impiegato
+ * @param bytes : Numero di byte letti
+ */
+inline void benchmarkReportBandwidth(const std::string& name, double milliseconds, uint64_t bytes)
+{
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2) << milliseconds << " ms"
+              << std::setw(12) << std::setprecision(1) << (bytes / (milliseconds * 1000.0)) << " MB/s"
+              << std::endl;
+}
+
+#endif // _BENCHMARK_H
@@ -0,0 +1,183 @@
+#include "Benchmark.h"
+#include "../Graph/Graph.h"
+#include "../Graph/CsrGraph.h"
+#include "../Graph/BitGraph.h"
+
+#include <vector>
+
+/**
+ * Confronta il BitGraph con il CsrGraph su un grafo casuale non orientato (ogni arco ha
+ * il suo inverso):
+ *  - conteggio dei vicini in comune fra coppie di nodi casuali: AND fra righe di bit
+ *    contro la fusione di due liste ordinate di vicini;
+ *  - conteggio dei triangoli con le stesse due tecniche.
+ * Il target benchmark_bit_graph_avx2 e' compilato con -mavx2 e usa la versione AVX2
+ * di intersectionCount: va eseguito solo su processori che la supportano.
+ *
+ * Uso: benchmark_bit_graph [nodi] [grado medio] [coppie]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+/**
+ * Conta gli elementi comuni a due intervalli di archi ordinati per id
+ *
+ * @tparam TRange : Tipo dell'intervallo di archi
+ * @param first : Primo intervallo
+ * @param second : Secondo intervallo
+ * @param minimum : Vengono contati solo i nodi con id maggiore o uguale a minimum
+ * @return Numero di nodi comuni
+ */
+template <class TRange>
+uint64_t mergeCount(const TRange& first, const TRange& second, uint32_t minimum)
+{
+    auto a = first.begin();
+    auto b = second.begin();
+    uint64_t amount = 0;
+
+    while (a != first.end() && b != second.end())
+    {
+        uint32_t x = (*a).id;
+        uint32_t y = (*b).id;
+
+        if (x < y)
+        {
+            ++a;
+        }
+
+        else if (y < x)
+        {
+            ++b;
+        }
+
+        else
+        {
+            amount += (x >= minimum) ? 1 : 0;
+            ++a;
+            ++b;
+        }
+    }
+
+    return amount;
+}
+
+
+int main(int argc, char const *argv[])
+{
+    uint32_t nodes = (uint32_t) benchmarkArgument(argc, argv, 1, 4096);
+    uint32_t degree = (uint32_t) benchmarkArgument(argc, argv, 2, 64);
+    uint64_t pairs = benchmarkArgument(argc, argv, 3, 1000000);
+
+    if (nodes == 0)
+    {
+        nodes = 1;
+    }
+
+    uint64_t state = 88172645463325252ULL;
+    BitGraph<int> bits(nodes);
+    CsrGraph<int, int> csr;
+
+    // Il Graph occupa O(V^2) memoria: serve solo per costruire il grafo compresso
+    {
+        Graph<int, int> matrix(nodes);
+        std::vector<GraphNode> ids(nodes);
+        std::vector<GraphNode> bitIds(nodes);
+
+        for (uint32_t i = 0; i < nodes; i++)
+        {
+            matrix.addNode(ids[i], 0);
+            bits.addNode(bitIds[i], 0);
+        }
+
+        for (uint64_t i = 0; i < (uint64_t) nodes * degree / 2; i++)
+        {
+            uint32_t from = (uint32_t) (benchmarkRandom(state) % nodes);
+            uint32_t to = (uint32_t) (benchmarkRandom(state) % nodes);
+
+            if (from != to && !matrix.isLinkActive(ids[from], ids[to]))
+            {
+                matrix.addLink(ids[from], ids[to], 1);
+                matrix.addLink(ids[to], ids[from], 1);
+                bits.addLink(bitIds[from], bitIds[to]);
+                bits.addLink(bitIds[to], bitIds[from]);
+            }
+        }
+
+        csr = CsrGraph<int, int>(matrix);
+    }
+
+#if defined(BIT_INTERSECTION_AVX2)
+    std::cout << "Intersezione: AVX2" << std::endl;
+#else
+    std::cout << "Intersezione: scalare" << std::endl;
+#endif
+
+    std::cout << "Nodi: " << nodes << ", archi: " << bits.getLinkAmount()
+              << ", matrice di bit: " << ((uint64_t) nodes * ((nodes + 63) / 64) * 8) / 1024 << " KB"
+              << ", matrice di LinkInfo: " << ((uint64_t) nodes * nodes * sizeof(LinkInfo<int>)) / 1024 << " KB" << std::endl;
+
+    std::vector<uint32_t> queries(2 * pairs);
+
+    for (uint64_t i = 0; i < 2 * pairs; i++)
+    {
+        queries[i] = (uint32_t) (benchmarkRandom(state) % nodes);
+    }
+
+    uint64_t checksum = 0;
+
+    {
+        BenchmarkTimer timer;
+
+        for (uint64_t i = 0; i < pairs; i++)
+        {
+            checksum += bits.countCommonNeighbours(GraphNode(queries[2 * i]), GraphNode(queries[2 * i + 1]));
+        }
+
+        benchmarkReport("vicini comuni bit", timer.elapsedMilliseconds(), pairs);
+    }
+
+    {
+        BenchmarkTimer timer;
+
+        for (uint64_t i = 0; i < pairs; i++)
+        {
+            checksum -= mergeCount(csr.getOutLinks(GraphNode(queries[2 * i])), csr.getOutLinks(GraphNode(queries[2 * i + 1])), 0);
+        }
+
+        benchmarkReport("vicini comuni csr", timer.elapsedMilliseconds(), pairs);
+    }
+
+    uint64_t bitTriangles;
+    uint64_t csrTriangles = 0;
+
+    {
+        BenchmarkTimer timer;
+        bitTriangles = bits.countTriangles();
+        benchmarkReport("triangoli bit", timer.elapsedMilliseconds(), bits.getLinkAmount());
+    }
+
+    {
+        BenchmarkTimer timer;
+
+        for (uint32_t u = 0; u < nodes; u++)
+        {
+            for (auto link : csr.getOutLinks(GraphNode(u)))
+            {
+                if (link.id > u)
+                {
+                    csrTriangles += mergeCount(csr.getOutLinks(GraphNode(u)), csr.getOutLinks(GraphNode(link.id)), link.id + 1);
+                }
+            }
+        }
+
+        benchmarkReport("triangoli csr", timer.elapsedMilliseconds(), csr.getLinkAmount());
+    }
+
+    if (checksum != 0 || bitTriangles != csrTriangles)
+    {
+        std::cout << "Risultati diversi fra le due rappresentazioni" << std::endl;
+    }
+
+    std::cout << "Triangoli: " << bitTriangles << std::endl;
+
+    return 0;
+}
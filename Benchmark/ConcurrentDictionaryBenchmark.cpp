@@ -0,0 +1,198 @@
+#include "Benchmark.h"
+#include "../Dictionary/Dictionary.h"
+#include "../Dictionary/ConcurrentDictionary.h"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Misura il throughput del ConcurrentDictionary con un numero crescente di thread
+ * (1, 2, 4, ... fino al massimo richiesto) e due miscele di operazioni:
+ *  - 90/10: 90% ricerche e 10% scritture;
+ *  - 50/50: 50% ricerche e 50% scritture.
+ * Le scritture sono per meta' inserimenti e per meta' cancellazioni, su un insieme di
+ * chiavi di cui circa la meta' e' presente. Come riferimento viene misurato anche un
+ * Dictionary protetto da un unico mutex globale. Ogni chiave e' associata a se' stessa,
+ * quindi ogni ricerca riuscita deve restituire la chiave cercata.
+ *
+ * Uso: benchmark_concurrent_dictionary [operazioni totali] [chiavi] [thread massimi]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+/**
+ * Dictionary protetto da un unico mutex, usato come riferimento
+ */
+class LockedDictionary
+{
+    private:
+        Dictionary<uint64_t, uint64_t> _dictionary; // Dizionario protetto
+        std::mutex _lock; // Mutex globale
+
+    public:
+        bool get(const uint64_t& key, uint64_t& value);
+        void insert(const uint64_t& key, const uint64_t& value);
+        void erase(const uint64_t& key);
+};
+
+/**
+ * Copia in value il valore associato a key
+ *
+ * @param key : Chiave dell'associazione
+ * @param value : Valore associato a key
+ * @return True se la chiave esiste, altrimenti false
+ */
+bool LockedDictionary::get(const uint64_t& key, uint64_t& value)
+{
+    std::lock_guard<std::mutex> lock(this->_lock);
+    Pair<uint64_t, uint64_t>* pair = this->_dictionary.get(key);
+
+    if (pair == nullptr)
+    {
+        return false;
+    }
+
+    value = pair->getValue();
+    return true;
+}
+
+/**
+ * Inserisce un'associazione chiave-valore
+ *
+ * @param key : Chiave da inserire
+ * @param value : Valore da associare alla chiave
+ */
+void LockedDictionary::insert(const uint64_t& key, const uint64_t& value)
+{
+    std::lock_guard<std::mutex> lock(this->_lock);
+    this->_dictionary.insert(key, value);
+}
+
+/**
+ * Elimina un'associazione chiave-valore
+ *
+ * @param key : Chiave dell'associazione da eliminare
+ */
+void LockedDictionary::erase(const uint64_t& key)
+{
+    std::lock_guard<std::mutex> lock(this->_lock);
+    this->_dictionary.erase(key);
+}
+
+
+/**
+ * Esegue operations operazioni sul dizionario con threads thread, ne stampa il throughput
+ * e segnala le ricerche che hanno restituito un valore diverso dalla chiave
+ *
+ * @tparam TDictionary : Dizionario da misurare
+ * @param name : Nome della prova
+ * @param operations : Numero totale di operazioni
+ * @param keys : Numero di chiavi distinte
+ * @param threads : Numero di thread
+ * @param readPercent : Percentuale di ricerche
+ */
+template <class TDictionary>
+void runMix(const std::string& name, uint64_t operations, uint64_t keys, uint32_t threads, uint32_t readPercent)
+{
+    TDictionary dictionary;
+    std::vector<std::thread> workers;
+    std::vector<uint64_t> wrongs(threads, 0);
+
+    // Inserisco meta' delle chiavi
+    for (uint64_t key = 0; key < keys; key += 2)
+    {
+        dictionary.insert(key, key);
+    }
+
+    BenchmarkTimer timer;
+
+    for (uint32_t t = 0; t < threads; t++)
+    {
+        workers.push_back(std::thread([&dictionary, &wrongs, operations, keys, threads, readPercent, t]()
+        {
+            uint64_t state = 88172645463325252ULL + t * 0x9E3779B97F4A7C15ULL;
+            uint64_t wrong = 0;
+
+            for (uint64_t i = 0; i < operations / threads; i++)
+            {
+                uint64_t random = benchmarkRandom(state);
+                uint64_t key = (random >> 8) % keys;
+                uint64_t value;
+
+                if (random % 100 < readPercent)
+                {
+                    if (dictionary.get(key, value) && value != key)
+                    {
+                        wrong++;
+                    }
+                }
+
+                else if ((random >> 7) & 1)
+                {
+                    dictionary.insert(key, key);
+                }
+
+                else
+                {
+                    dictionary.erase(key);
+                }
+            }
+
+            wrongs[t] = wrong;
+        }));
+    }
+
+    for (uint32_t t = 0; t < threads; t++)
+    {
+        workers[t].join();
+    }
+
+    benchmarkReport(name + " " + std::to_string(threads) + " thread", timer.elapsedMilliseconds(), (operations / threads) * threads);
+
+    uint64_t wrong = 0;
+
+    for (uint32_t t = 0; t < threads; t++)
+    {
+        wrong += wrongs[t];
+    }
+
+    if (wrong != 0)
+    {
+        std::cout << "    Valori letti diversi da quelli inseriti: " << wrong << std::endl;
+    }
+}
+
+
+int main(int argc, char const *argv[])
+{
+    uint64_t operations = benchmarkArgument(argc, argv, 1, 8000000);
+    uint64_t keys = benchmarkArgument(argc, argv, 2, 1000000);
+    uint64_t maxThreads = benchmarkArgument(argc, argv, 3, 64);
+
+    if (keys == 0)
+    {
+        keys = 1;
+    }
+
+    std::cout << "Operazioni: " << operations << ", chiavi: " << keys
+              << ", core disponibili: " << std::thread::hardware_concurrency() << std::endl;
+
+    const uint32_t readPercents[] = { 90, 50 };
+
+    for (uint32_t readPercent : readPercents)
+    {
+        std::string mix = std::to_string(readPercent) + "/" + std::to_string(100 - readPercent);
+
+        for (uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            runMix< ConcurrentDictionary<uint64_t, uint64_t> >("concurrent " + mix, operations, keys, threads, readPercent);
+        }
+
+        for (uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            runMix<LockedDictionary>("global mutex " + mix, operations, keys, threads, readPercent);
+        }
+    }
+
+    return 0;
+}
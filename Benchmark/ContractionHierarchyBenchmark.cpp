@@ -0,0 +1,213 @@
+#include "Benchmark.h"
+#include "../Graph/Graph.h"
+#include "../Graph/CsrGraph.h"
+#include "../Graph/BidirectionalDijkstra.h"
+#include "../Graph/ContractionHierarchy.h"
+
+#include <sstream>
+#include <vector>
+
+/**
+ * Confronta le interrogazioni di cammino minimo punto a punto su un grafo a griglia con
+ * pesi casuali, simile ad una rete stradale:
+ *  - Dijkstra fermato sulla destinazione e Dijkstra bidirezionale, senza preelaborazione;
+ *  - ContractionHierarchy, solo distanza e cammino completo.
+ * Vengono misurati anche la preelaborazione e il salvataggio e caricamento dell'indice.
+ * La distanza di ogni interrogazione, anche sull'indice caricato, viene confrontata con
+ * quella di Dijkstra.
+ *
+ * Uso: benchmark_contraction_hierarchy [lato della griglia] [interrogazioni]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+/**
+ * Stampa il tempo medio di un'interrogazione e il numero medio di nodi etichettati
+ *
+ * @param name : Nome della prova
+ * @param milliseconds : Tempo impiegato da tutte le interrogazioni
+ * @param queries : Numero di interrogazioni
+ * @param settled : Nodi etichettati da tutte le interrogazioni
+ */
+void reportQueries(const std::string& name, double milliseconds, uint64_t queries, uint64_t settled)
+{
+    benchmarkReport(name, milliseconds, queries);
+    std::cout << "    " << (milliseconds * 1000.0 / queries) << " us per interrogazione, "
+              << (settled / queries) << " nodi etichettati" << std::endl;
+}
+
+/**
+ * Stampa un avviso se le distanze di una prova sono diverse da quelle di Dijkstra
+ *
+ * @param name : Nome della prova
+ * @param distances : Distanza di ogni interrogazione
+ * @param expected : Distanza di ogni interrogazione calcolata da Dijkstra
+ */
+void checkQueries(const std::string& name, const std::vector<int>& distances, const std::vector<int>& expected)
+{
+    if (distances != expected)
+    {
+        std::cout << "    Risultati diversi da Dijkstra: " << name << std::endl;
+    }
+}
+
+
+int main(int argc, char const *argv[])
+{
+    uint32_t side = (uint32_t) benchmarkArgument(argc, argv, 1, 64);
+    uint64_t queries = benchmarkArgument(argc, argv, 2, 2000);
+
+    if (side == 0)
+    {
+        side = 1;
+    }
+
+    uint32_t nodes = side * side;
+    uint64_t state = 88172645463325252ULL;
+    CsrGraph<int, int> graph;
+
+    // Il Graph occupa O(V^2) memoria: serve solo per costruire il grafo compresso
+    {
+        Graph<int, int> matrix(nodes);
+        std::vector<GraphNode> ids(nodes);
+
+        for (uint32_t i = 0; i < nodes; i++)
+        {
+            matrix.addNode(ids[i], 0);
+        }
+
+        for (uint32_t i = 0; i < nodes; i++)
+        {
+            uint32_t right = i + 1;
+            uint32_t down = i + side;
+
+            if (right % side != 0)
+            {
+                int weight = 10 + (int) (benchmarkRandom(state) % 90);
+                matrix.addLink(ids[i], ids[right], weight);
+                matrix.addLink(ids[right], ids[i], weight);
+            }
+
+            if (down < nodes)
+            {
+                int weight = 10 + (int) (benchmarkRandom(state) % 90);
+                matrix.addLink(ids[i], ids[down], weight);
+                matrix.addLink(ids[down], ids[i], weight);
+            }
+        }
+
+        graph = CsrGraph<int, int>(matrix);
+    }
+
+    std::vector<uint32_t> pairs(2 * queries);
+
+    for (uint64_t i = 0; i < 2 * queries; i++)
+    {
+        pairs[i] = (uint32_t) (benchmarkRandom(state) % nodes);
+    }
+
+    std::cout << "Nodi: " << nodes << ", archi: " << graph.getLinkAmount() << ", interrogazioni: " << queries << std::endl;
+
+    ContractionHierarchy<int> hierarchy;
+    ContractionHierarchy<int> loaded;
+
+    {
+        BenchmarkTimer timer;
+        hierarchy.build(graph);
+        benchmarkReport("preelaborazione", timer.elapsedMilliseconds(), nodes);
+    }
+
+    std::cout << "Scorciatoie: " << hierarchy.getShortcutAmount() << ", archi dell'indice: " << hierarchy.getLinkAmount() << std::endl;
+
+    {
+        std::stringstream file;
+        BenchmarkTimer timer;
+
+        hierarchy.save(file);
+        benchmarkReport("salvataggio", timer.elapsedMilliseconds(), hierarchy.getLinkAmount());
+
+        timer.restart();
+
+        if (!loaded.load(file))
+        {
+            std::cout << "Caricamento fallito" << std::endl;
+        }
+
+        benchmarkReport("caricamento", timer.elapsedMilliseconds(), hierarchy.getLinkAmount());
+    }
+
+    std::vector<int> expected(queries);
+    std::vector<int> distances(queries);
+
+    {
+        Dijkstra< CsrGraph<int, int> > engine(graph);
+        uint64_t settled = 0;
+        BenchmarkTimer timer;
+
+        for (uint64_t i = 0; i < queries; i++)
+        {
+            expected[i] = engine.run(GraphNode(pairs[2 * i]), GraphNode(pairs[2 * i + 1])).getDistance(pairs[2 * i + 1]);
+            settled += engine.getSettledAmount();
+        }
+
+        reportQueries("dijkstra", timer.elapsedMilliseconds(), queries, settled);
+    }
+
+    {
+        BidirectionalDijkstra< CsrGraph<int, int> > engine(graph);
+        uint64_t settled = 0;
+        BenchmarkTimer timer;
+
+        for (uint64_t i = 0; i < queries; i++)
+        {
+            distances[i] = engine.run(GraphNode(pairs[2 * i]), GraphNode(pairs[2 * i + 1])).getCost();
+            settled += engine.getSettledAmount();
+        }
+
+        reportQueries("dijkstra bidirezionale", timer.elapsedMilliseconds(), queries, settled);
+        checkQueries("dijkstra bidirezionale", distances, expected);
+    }
+
+    {
+        uint64_t settled = 0;
+        BenchmarkTimer timer;
+
+        for (uint64_t i = 0; i < queries; i++)
+        {
+            distances[i] = hierarchy.getDistance(GraphNode(pairs[2 * i]), GraphNode(pairs[2 * i + 1]));
+            settled += hierarchy.getSettledAmount();
+        }
+
+        reportQueries("contraction hierarchy distanza", timer.elapsedMilliseconds(), queries, settled);
+        checkQueries("contraction hierarchy distanza", distances, expected);
+    }
+
+    {
+        uint64_t settled = 0;
+        BenchmarkTimer timer;
+
+        for (uint64_t i = 0; i < queries; i++)
+        {
+            distances[i] = hierarchy.run(GraphNode(pairs[2 * i]), GraphNode(pairs[2 * i + 1])).getCost();
+            settled += hierarchy.getSettledAmount();
+        }
+
+        reportQueries("contraction hierarchy cammino", timer.elapsedMilliseconds(), queries, settled);
+        checkQueries("contraction hierarchy cammino", distances, expected);
+    }
+
+    {
+        uint64_t settled = 0;
+        BenchmarkTimer timer;
+
+        for (uint64_t i = 0; i < queries; i++)
+        {
+            distances[i] = loaded.run(GraphNode(pairs[2 * i]), GraphNode(pairs[2 * i + 1])).getCost();
+            settled += loaded.getSettledAmount();
+        }
+
+        reportQueries("contraction hierarchy caricata", timer.elapsedMilliseconds(), queries, settled);
+        checkQueries("contraction hierarchy caricata", distances, expected);
+    }
+
+    return 0;
+}
@@ -0,0 +1,287 @@
+#include "Benchmark.h"
+#include "../Graph/Graph.h"
+#include "../Graph/CsrGraph.h"
+#include "../Graph/DeltaStepping.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/**
+ * Misura i cammini minimi da piu' sorgenti su un grafo casuale pesato compresso (CsrGraph):
+ *  - Dijkstra sequenziale, come riferimento;
+ *  - DeltaStepping al variare dell'ampiezza dei secchi (frazioni e multipli di quella
+ *    stimata dal grafo) e del numero di thread (1, 2, 4, ... fino al massimo richiesto).
+ * Le distanze di ogni esecuzione vengono confrontate con quelle di Dijkstra; i padri
+ * possono differire solo fra cammini minimi di pari costo, e vengono quindi controllati
+ * verificando che ogni padre sia un predecessore su un cammino minimo. Alla fine il peso di
+ * una parte degli archi viene cambiato con setWeight: i padri si ricostruiscono dagli archi
+ * entranti, che devono riportare i nuovi pesi.
+ * Il throughput e' espresso in archi del grafo per sorgente.
+ *
+ * Uso: benchmark_delta_stepping [nodi] [grado medio] [peso massimo] [sorgenti] [thread massimi]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+typedef CsrGraph<int, int> BenchmarkGraph;
+
+/**
+ * Controlla che ogni padre sia un predecessore del nodo lungo un cammino minimo
+ *
+ * @param graph : Grafo su cui sono stati calcolati i cammini
+ * @param distances : Distanza di ogni nodo dalla sorgente
+ * @param parents : Padre di ogni nodo
+ * @param reference : Padri calcolati da Dijkstra, con cui si confrontano i nodi senza padre
+ * @return True se tutti i padri sono corretti, altrimenti false
+ */
+bool checkParents(const BenchmarkGraph& graph, const std::vector<int>& distances, const std::vector<uint32_t>& parents, const std::vector<uint32_t>& reference)
+{
+    for (uint32_t v = 0; v < parents.size(); v++)
+    {
+        uint32_t u = parents[v];
+        bool valid = false;
+
+        if (u == ShortestPathTree<int>::NO_PARENT || reference[v] == ShortestPathTree<int>::NO_PARENT)
+        {
+            valid = (u == reference[v]);
+        }
+
+        else
+        {
+            for (auto link : graph.getOutLinks(GraphNode(u)))
+            {
+                valid = valid || (link.id == v && distances[u] + link.weight == distances[v]);
+            }
+        }
+
+        if (!valid)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Esegue DeltaStepping da ognuna delle sorgenti, ne stampa il throughput e controlla
+ * i risultati con quelli di Dijkstra
+ *
+ * @param graph : Grafo su cui calcolare i cammini
+ * @param sources : Nodi sorgente
+ * @param distances : Distanze calcolate da Dijkstra per ogni sorgente
+ * @param parents : Padri calcolati da Dijkstra per ogni sorgente
+ * @param threads : Numero di thread
+ * @param delta : Ampiezza dei secchi
+ */
+void runDeltaStepping(const BenchmarkGraph& graph, const std::vector<uint32_t>& sources, const std::vector< std::vector<int> >& distances,
+                      const std::vector< std::vector<uint32_t> >& parents, uint32_t threads, int delta)
+{
+    ThreadPool pool(threads);
+    DeltaStepping<BenchmarkGraph> engine(graph, pool);
+    uint64_t phases = 0;
+    double elapsed = 0;
+    bool equal = true;
+
+    engine.setDelta(delta);
+
+    for (std::size_t i = 0; i < sources.size(); i++)
+    {
+        BenchmarkTimer timer;
+
+        engine.run(GraphNode(sources[i]));
+        elapsed += timer.elapsedMilliseconds();
+
+        // Il controllo e' escluso dal tempo misurato
+        phases += engine.getPhaseAmount();
+        equal = equal && engine.getDistances() == distances[i] && checkParents(graph, engine.getDistances(), engine.getParents(), parents[i]);
+    }
+
+    benchmarkReport("delta " + std::to_string(delta) + " " + std::to_string(threads) + " thread", elapsed, (uint64_t) graph.getLinkAmount() * sources.size());
+
+    std::cout << "    fasi per sorgente: " << phases / (sources.empty() ? 1 : sources.size()) << std::endl;
+
+    if (!equal)
+    {
+        std::cout << "    Risultati diversi da Dijkstra" << std::endl;
+    }
+}
+
+/**
+ * Cambia con setWeight il peso di circa un arco su quattro di una copia del grafo, poi
+ * controlla che gli archi entranti riportino i nuovi pesi e che DeltaStepping coincida
+ * ancora con Dijkstra
+ *
+ * @param graph : Copia del grafo da modificare
+ * @param source : Nodo sorgente
+ * @param threads : Numero di thread
+ * @param maxWeight : Peso massimo dei nuovi archi
+ * @param state : Stato del generatore casuale
+ * @return True se archi entranti e cammini sono corretti, altrimenti false
+ */
+bool checkSetWeight(BenchmarkGraph graph, uint32_t source, uint32_t threads, uint32_t maxWeight, uint64_t& state)
+{
+    std::vector<uint32_t> targets;
+
+    for (uint32_t u = 0; u < graph.getMaxNodeAmount(); u++)
+    {
+        GraphNode from(u);
+
+        targets.clear();
+
+        for (auto link : graph.getOutLinks(from))
+        {
+            targets.push_back(link.id);
+        }
+
+        for (std::size_t i = 0; i < targets.size(); i++)
+        {
+            GraphNode to(targets[i]);
+
+            if (benchmarkRandom(state) % 4 == 0)
+            {
+                graph.setWeight(from, to, 1 + (int) (benchmarkRandom(state) % maxWeight));
+            }
+        }
+    }
+
+    for (uint32_t v = 0; v < graph.getMaxNodeAmount(); v++)
+    {
+        for (auto link : graph.getInLinks(GraphNode(v)))
+        {
+            if (link.weight != graph.getWeight(GraphNode(link.id), GraphNode(v)))
+            {
+                return false;
+            }
+        }
+    }
+
+    Dijkstra<BenchmarkGraph> dijkstra(graph);
+    const ShortestPathTree<int>& tree = dijkstra.run(GraphNode(source));
+    std::vector<int> distances(graph.getMaxNodeAmount());
+    std::vector<uint32_t> parents(graph.getMaxNodeAmount());
+
+    for (uint32_t u = 0; u < graph.getMaxNodeAmount(); u++)
+    {
+        distances[u] = tree.getDistance(u);
+        parents[u] = tree.getParent(u);
+    }
+
+    ThreadPool pool(threads);
+    DeltaStepping<BenchmarkGraph> engine(graph, pool);
+
+    engine.run(GraphNode(source));
+
+    return engine.getDistances() == distances && checkParents(graph, engine.getDistances(), engine.getParents(), parents);
+}
+
+
+int main(int argc, char const *argv[])
+{
+    uint32_t nodes = (uint32_t) benchmarkArgument(argc, argv, 1, 4096);
+    uint32_t degree = (uint32_t) benchmarkArgument(argc, argv, 2, 16);
+    uint32_t maxWeight = (uint32_t) benchmarkArgument(argc, argv, 3, 1000);
+    uint32_t sourceAmount = (uint32_t) benchmarkArgument(argc, argv, 4, 32);
+    uint64_t maxThreads = benchmarkArgument(argc, argv, 5, 16);
+
+    if (nodes == 0)
+    {
+        nodes = 1;
+    }
+
+    if (maxWeight == 0)
+    {
+        maxWeight = 1;
+    }
+
+    uint64_t state = 88172645463325252ULL;
+    std::vector<uint32_t> sources;
+
+    // Il Graph occupa O(V^2) memoria: serve solo per costruire il grafo compresso
+    BenchmarkGraph graph;
+
+    {
+        Graph<int, int> matrix(nodes);
+        std::vector<GraphNode> ids(nodes);
+
+        for (uint32_t i = 0; i < nodes; i++)
+        {
+            matrix.addNode(ids[i], 0);
+        }
+
+        for (uint64_t i = 0; i < (uint64_t) nodes * degree; i++)
+        {
+            uint32_t from = (uint32_t) (benchmarkRandom(state) % nodes);
+            uint32_t to = (uint32_t) (benchmarkRandom(state) % nodes);
+
+            if (!matrix.isLinkActive(ids[from], ids[to]))
+            {
+                matrix.addLink(ids[from], ids[to], 1 + (int) (benchmarkRandom(state) % maxWeight));
+            }
+        }
+
+        graph = BenchmarkGraph(matrix);
+    }
+
+    for (uint32_t i = 0; i < sourceAmount; i++)
+    {
+        sources.push_back((uint32_t) (benchmarkRandom(state) % nodes));
+    }
+
+    std::cout << "Nodi: " << nodes << ", archi: " << graph.getLinkAmount() << ", sorgenti: " << sourceAmount
+              << ", core disponibili: " << std::thread::hardware_concurrency() << std::endl;
+
+    std::vector< std::vector<int> > distances(sources.size(), std::vector<int>(nodes));
+    std::vector< std::vector<uint32_t> > parents(sources.size(), std::vector<uint32_t>(nodes));
+
+    {
+        Dijkstra<BenchmarkGraph> dijkstra(graph);
+        BenchmarkTimer timer;
+
+        for (std::size_t i = 0; i < sources.size(); i++)
+        {
+            const ShortestPathTree<int>& tree = dijkstra.run(GraphNode(sources[i]));
+
+            for (uint32_t u = 0; u < nodes; u++)
+            {
+                distances[i][u] = tree.getDistance(u);
+                parents[i][u] = tree.getParent(u);
+            }
+        }
+
+        benchmarkReport("dijkstra", timer.elapsedMilliseconds(), (uint64_t) graph.getLinkAmount() * sources.size());
+    }
+
+    int estimated;
+
+    {
+        ThreadPool pool(1);
+        DeltaStepping<BenchmarkGraph> engine(graph, pool);
+
+        estimated = engine.getDelta();
+    }
+
+    std::cout << "Delta stimato: " << estimated << std::endl;
+
+    std::vector<int> deltas = { 1, estimated / 4, estimated, estimated * 4, (int) maxWeight };
+
+    for (std::size_t d = 0; d < deltas.size(); d++)
+    {
+        if (deltas[d] <= 0)
+        {
+            continue;
+        }
+
+        for (uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            runDeltaStepping(graph, sources, distances, parents, threads, deltas[d]);
+        }
+    }
+
+    if (!sources.empty() && !checkSetWeight(graph, sources[0], (uint32_t) std::max<uint64_t>(maxThreads, 1), maxWeight, state))
+    {
+        std::cout << "Risultati diversi dopo setWeight" << std::endl;
+    }
+
+    return 0;
+}
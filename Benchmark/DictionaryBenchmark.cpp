@@ -0,0 +1,153 @@
+#include "Benchmark.h"
+#include "../Dictionary/Dictionary.h"
+#include "../Dictionary/FlatDictionary.h"
+
+/**
+ * Confronta la ricerca nel Dictionary, che scandisce un bucket alla volta con il ciclo
+ * do { ... } while di search, con la ricerca a gruppi di 16 byte di controllo del
+ * FlatDictionary. Le prove misurano:
+ *  - insert: inserimento di tutte le chiavi;
+ *  - hit: ricerca di chiavi presenti;
+ *  - miss: ricerca di chiavi assenti.
+ *
+ * Il target benchmark_dictionary_scalar compila lo stesso file con FLAT_DICTIONARY_SCALAR,
+ * cosi' da misurare anche la versione scalare dei gruppi di controllo.
+ *
+ * Uso: benchmark_dictionary [numero di chiavi] [numero di ricerche]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+/**
+ * Genera la chiave i-esima. Le chiavi presenti sono pari e quelle assenti dispari,
+ * cosi' le ricerche fallite non trovano mai una chiave inserita.
+ *
+ * @param state : Stato del generatore
+ * @param present : Se true genera una chiave presente, altrimenti una assente
+ * @return Chiave
+ */
+uint64_t nextKey(uint64_t& state, bool present)
+{
+    uint64_t key = benchmarkRandom(state) << 1;
+    return present ? key : (key | 1);
+}
+
+/**
+ * Misura inserimenti, ricerche riuscite e ricerche fallite nel Dictionary
+ *
+ * @param keys : Numero di chiavi da inserire
+ * @param lookups : Numero di ricerche per prova
+ */
+void runDictionary(uint64_t keys, uint64_t lookups)
+{
+    Dictionary<uint64_t, uint64_t> dictionary;
+    uint64_t state = 88172645463325252ULL;
+    uint64_t checksum = 0;
+    BenchmarkTimer timer;
+
+    for (uint64_t i = 0; i < keys; i++)
+    {
+        dictionary.insert(nextKey(state, true), i);
+    }
+
+    benchmarkReport("Dictionary insert", timer.elapsedMilliseconds(), keys);
+
+    timer.restart();
+    state = 88172645463325252ULL;
+
+    for (uint64_t i = 0; i < lookups; i++)
+    {
+        // Ripercorro la sequenza delle chiavi inserite
+        if (i % keys == 0)
+        {
+            state = 88172645463325252ULL;
+        }
+
+        Pair<uint64_t, uint64_t>* pair = dictionary.get(nextKey(state, true));
+        checksum += pair->getValue();
+    }
+
+    benchmarkReport("Dictionary hit", timer.elapsedMilliseconds(), lookups);
+
+    timer.restart();
+    state = 1234567ULL;
+
+    for (uint64_t i = 0; i < lookups; i++)
+    {
+        checksum += dictionary.has(nextKey(state, false));
+    }
+
+    benchmarkReport("Dictionary miss", timer.elapsedMilliseconds(), lookups);
+    std::cout << "  checksum: " << checksum << std::endl;
+}
+
+/**
+ * Misura inserimenti, ricerche riuscite e ricerche fallite nel FlatDictionary
+ *
+ * @param keys : Numero di chiavi da inserire
+ * @param lookups : Numero di ricerche per prova
+ */
+void runFlatDictionary(uint64_t keys, uint64_t lookups)
+{
+#if defined(CONTROL_GROUP_SSE2)
+    const std::string name = "FlatDictionary (SSE2)";
+#else
+    const std::string name = "FlatDictionary (scalare)";
+#endif
+
+    FlatDictionary<uint64_t, uint64_t> dictionary;
+    uint64_t state = 88172645463325252ULL;
+    uint64_t checksum = 0;
+    BenchmarkTimer timer;
+
+    for (uint64_t i = 0; i < keys; i++)
+    {
+        dictionary.insert(nextKey(state, true), i);
+    }
+
+    benchmarkReport(name + " insert", timer.elapsedMilliseconds(), keys);
+
+    timer.restart();
+    state = 88172645463325252ULL;
+
+    for (uint64_t i = 0; i < lookups; i++)
+    {
+        if (i % keys == 0)
+        {
+            state = 88172645463325252ULL;
+        }
+
+        checksum += *dictionary.get(nextKey(state, true));
+    }
+
+    benchmarkReport(name + " hit", timer.elapsedMilliseconds(), lookups);
+
+    timer.restart();
+    state = 1234567ULL;
+
+    for (uint64_t i = 0; i < lookups; i++)
+    {
+        checksum += dictionary.has(nextKey(state, false));
+    }
+
+    benchmarkReport(name + " miss", timer.elapsedMilliseconds(), lookups);
+    std::cout << "  checksum: " << checksum << std::endl;
+}
+
+
+int main(int argc, char const *argv[])
+{
+    uint64_t keys = benchmarkArgument(argc, argv, 1, 1000000);
+    uint64_t lookups = benchmarkArgument(argc, argv, 2, 5000000);
+
+    if (keys == 0)
+    {
+        keys = 1;
+    }
+
+    std::cout << "Chiavi: " << keys << ", ricerche per prova: " << lookups << std::endl;
+
+    runDictionary(keys, lookups);
+    runFlatDictionary(keys, lookups);
+
+    return 0;
+}
@@ -0,0 +1,224 @@
+#include "Benchmark.h"
+#include "../Graph/Graph.h"
+#include "../Graph/CsrGraph.h"
+#include "../Graph/EdgeListLoader.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+/**
+ * Misura il throughput di caricamento di una lista di archi testuale ("from to weight"
+ * per riga) generata a caso: prima la lettura con std::ifstream e operator>> in un
+ * vettore, su un thread, poi EdgeListLoader fino al grafo compresso con un numero
+ * crescente di thread (1, 2, 4, ... fino al massimo richiesto).
+ * Prima della misura il caricatore viene confrontato, su una lista piccola con archi
+ * ripetuti e righe malformate, con il grafo costruito con Graph::addLink.
+ * Il throughput e' espresso in megabyte del file letti al secondo.
+ *
+ * Uso: benchmark_edge_list_loader [nodi] [grado] [thread massimi]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+typedef CsrGraph<int, double> BenchmarkGraph;
+
+/**
+ * Confronta due sequenze di archi, per id e peso
+ *
+ * @tparam TRange : Tipo delle sequenze di archi
+ * @param first : Prima sequenza
+ * @param second : Seconda sequenza
+ * @return true se le sequenze sono uguali, false altrimenti
+ */
+template <class TRange>
+bool sameLinks(const TRange& first, const TRange& second)
+{
+    auto current = second.begin();
+
+    for (auto link : first)
+    {
+        if (!(current != second.end()) || (*current).id != link.id || (*current).weight != link.weight)
+        {
+            return false;
+        }
+
+        ++current;
+    }
+
+    return !(current != second.end());
+}
+
+/**
+ * Scrive una lista di archi piccola, con archi ripetuti e righe malformate, e confronta
+ * il grafo caricato da EdgeListLoader con quello costruito con Graph::addLink, in cui un
+ * arco ripetuto prende il peso dell'ultima riga
+ *
+ * @param path : Percorso del file da scrivere
+ * @param threads : Numero di thread del caricatore
+ * @param state : Stato del generatore casuale
+ * @return true se i grafi e il numero di righe scartate coincidono, false altrimenti
+ */
+bool checkLoader(const char* path, uint32_t threads, uint64_t& state)
+{
+    const uint32_t nodes = 64;
+    const uint32_t lines = 1024;
+    Graph<int, double> matrix(nodes);
+    std::vector<GraphNode> ids(nodes);
+    uint64_t invalid = 0;
+
+    for (uint32_t i = 0; i < nodes; i++)
+    {
+        matrix.addNode(ids[i], 0);
+    }
+
+    {
+        std::ofstream out(path, std::ios::binary);
+        std::vector<char> line(64);
+
+        out << "# lista di controllo\n";
+
+        // L'arco fra i nodi estremi fissa il numero di nodi del grafo caricato
+        out << "0 " << nodes - 1 << " 1\n";
+        matrix.addLink(ids[0], ids[nodes - 1], 1.0);
+
+        for (uint32_t i = 0; i < lines; i++)
+        {
+            uint32_t from = (uint32_t) (benchmarkRandom(state) % nodes);
+            uint32_t to = (uint32_t) (benchmarkRandom(state) % nodes);
+            double weight = (double) (benchmarkRandom(state) % 100000) / 100.0;
+
+            if (i % 97 == 0)
+            {
+                out << from << " -" << to << " 1\n";
+                invalid++;
+                continue;
+            }
+
+            if (i % 89 == 0)
+            {
+                out << from << " " << to << " -1\n";
+                invalid++;
+                continue;
+            }
+
+            // Il peso del riferimento si rilegge dal testo scritto, come fa il caricatore
+            std::snprintf(line.data(), line.size(), "%.2f", weight);
+            out << from << " " << to << " " << line.data() << "\n";
+            matrix.addLink(ids[from], ids[to], std::strtod(line.data(), nullptr));
+        }
+    }
+
+    BenchmarkGraph reference(matrix);
+    ThreadPool pool(threads);
+    EdgeListLoader<int, double> loader(pool);
+    BenchmarkGraph graph;
+
+    if (!loader.load(path, graph) || loader.getInvalidAmount() != invalid)
+    {
+        return false;
+    }
+
+    if (graph.getMaxNodeAmount() != reference.getMaxNodeAmount() || graph.getLinkAmount() != reference.getLinkAmount())
+    {
+        return false;
+    }
+
+    for (uint32_t u = 0; u < nodes; u++)
+    {
+        if (!sameLinks(graph.getOutLinks(GraphNode(u)), reference.getOutLinks(GraphNode(u)))
+            || !sameLinks(graph.getInLinks(GraphNode(u)), reference.getInLinks(GraphNode(u))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+int main(int argc, char const *argv[])
+{
+    uint32_t nodes = (uint32_t) benchmarkArgument(argc, argv, 1, 1000000);
+    uint32_t degree = (uint32_t) benchmarkArgument(argc, argv, 2, 16);
+    uint64_t maxThreads = benchmarkArgument(argc, argv, 3, 16);
+    const char* path = "benchmark_edge_list.txt";
+
+    if (nodes == 0)
+    {
+        nodes = 1;
+    }
+
+    uint64_t state = 88172645463325252ULL;
+    uint64_t bytes = 0;
+
+    std::cout << "Core disponibili: " << std::thread::hardware_concurrency() << std::endl;
+
+    for (uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        if (!checkLoader(path, threads, state))
+        {
+            std::cout << "Risultati diversi da Graph::addLink con " << threads << " thread" << std::endl;
+            break;
+        }
+    }
+
+    {
+        std::ofstream out(path, std::ios::binary);
+        std::vector<char> line(64);
+
+        for (uint64_t i = 0; i < (uint64_t) nodes * degree; i++)
+        {
+            uint32_t from = (uint32_t) (benchmarkRandom(state) % nodes);
+            uint32_t to = (uint32_t) (benchmarkRandom(state) % nodes);
+            double weight = (double) (benchmarkRandom(state) % 100000) / 100.0;
+            int length = std::snprintf(line.data(), line.size(), "%u %u %.2f\n", from, to, weight);
+
+            out.write(line.data(), length);
+            bytes += (uint64_t) length;
+        }
+    }
+
+    std::cout << "Nodi: " << nodes << ", righe: " << (uint64_t) nodes * degree << ", file: " << bytes / (1024 * 1024) << " MB" << std::endl;
+
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::vector< EdgeListLink<double> > links;
+        EdgeListLink<double> link;
+        BenchmarkTimer timer;
+
+        while (in >> link.from >> link.to >> link.weight)
+        {
+            links.push_back(link);
+        }
+
+        benchmarkReportBandwidth("ifstream >>", timer.elapsedMilliseconds(), bytes);
+    }
+
+    for (uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        ThreadPool pool(threads);
+        EdgeListLoader<int, double> loader(pool);
+        BenchmarkGraph graph;
+        BenchmarkTimer timer;
+
+        if (!loader.load(path, graph))
+        {
+            std::cout << "Caricamento fallito" << std::endl;
+            break;
+        }
+
+        benchmarkReportBandwidth("loader " + std::to_string(threads) + " thread", timer.elapsedMilliseconds(), loader.getByteAmount());
+
+        if (threads == 1)
+        {
+            std::cout << "    Archi: " << graph.getLinkAmount() << ", ripetuti: " << loader.getDuplicateAmount()
+                      << ", righe scartate: " << loader.getInvalidAmount() << std::endl;
+        }
+    }
+
+    std::remove(path);
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include "Benchmark.h"
+#include "../Graph/Graph.h"
+#include "../Graph/CsrGraph.h"
+#include "../Graph/FloydWarshall.h"
+
+#include <thread>
+#include <vector>
+
+/**
+ * Misura il calcolo dei cammini minimi fra tutte le coppie di nodi di un grafo casuale
+ * pesato compresso (CsrGraph):
+ *  - Dijkstra eseguito da ogni nodo, come riferimento;
+ *  - FloydWarshall a blocchi con un numero crescente di thread (1, 2, 4, ... fino al
+ *    massimo richiesto).
+ * Le distanze di FloydWarshall vengono confrontate con quelle di Dijkstra.
+ * Il throughput e' espresso in V^2 coppie per esecuzione. Il target
+ * benchmark_floyd_warshall_scalar e' compilato con MIN_PLUS_SCALAR e usa il ciclo interno
+ * scalare al posto di quello SSE2.
+ *
+ * Uso: benchmark_floyd_warshall [nodi] [grado medio] [peso massimo] [thread massimi]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+typedef CsrGraph<int, int> BenchmarkGraph;
+
+
+int main(int argc, char const *argv[])
+{
+    uint32_t nodes = (uint32_t) benchmarkArgument(argc, argv, 1, 1024);
+    uint32_t degree = (uint32_t) benchmarkArgument(argc, argv, 2, 16);
+    uint32_t maxWeight = (uint32_t) benchmarkArgument(argc, argv, 3, 1000);
+    uint64_t maxThreads = benchmarkArgument(argc, argv, 4, 16);
+
+    if (nodes == 0)
+    {
+        nodes = 1;
+    }
+
+    if (maxWeight == 0)
+    {
+        maxWeight = 1;
+    }
+
+    uint64_t state = 88172645463325252ULL;
+    uint64_t pairs = (uint64_t) nodes * nodes;
+
+    // Il Graph occupa O(V^2) memoria: serve solo per costruire il grafo compresso
+    BenchmarkGraph graph;
+
+    {
+        Graph<int, int> matrix(nodes);
+        std::vector<GraphNode> ids(nodes);
+
+        for (uint32_t i = 0; i < nodes; i++)
+        {
+            matrix.addNode(ids[i], 0);
+        }
+
+        for (uint64_t i = 0; i < (uint64_t) nodes * degree; i++)
+        {
+            uint32_t from = (uint32_t) (benchmarkRandom(state) % nodes);
+            uint32_t to = (uint32_t) (benchmarkRandom(state) % nodes);
+
+            if (!matrix.isLinkActive(ids[from], ids[to]))
+            {
+                matrix.addLink(ids[from], ids[to], 1 + (int) (benchmarkRandom(state) % maxWeight));
+            }
+        }
+
+        graph = BenchmarkGraph(matrix);
+    }
+
+#if defined(MIN_PLUS_SSE2)
+    std::cout << "Min-plus: SSE2" << std::endl;
+#else
+    std::cout << "Min-plus: scalare" << std::endl;
+#endif
+
+    std::cout << "Nodi: " << nodes << ", archi: " << graph.getLinkAmount()
+              << ", core disponibili: " << std::thread::hardware_concurrency() << std::endl;
+
+    std::vector<int> distances(pairs);
+
+    {
+        Dijkstra<BenchmarkGraph> dijkstra(graph);
+        BenchmarkTimer timer;
+
+        for (uint32_t u = 0; u < nodes; u++)
+        {
+            const ShortestPathTree<int>& tree = dijkstra.run(GraphNode(u));
+
+            for (uint32_t v = 0; v < nodes; v++)
+            {
+                distances[(std::size_t) u * nodes + v] = tree.getDistance(v);
+            }
+        }
+
+        benchmarkReport("dijkstra da ogni nodo", timer.elapsedMilliseconds(), pairs);
+    }
+
+    for (uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        ThreadPool pool(threads);
+        FloydWarshall<BenchmarkGraph> engine(graph, pool);
+        BenchmarkTimer timer;
+
+        engine.run();
+
+        benchmarkReport("floyd-warshall " + std::to_string(threads) + " thread", timer.elapsedMilliseconds(), pairs);
+
+        bool equal = true;
+
+        for (uint32_t u = 0; u < nodes; u++)
+        {
+            for (uint32_t v = 0; v < nodes; v++)
+            {
+                equal = equal && engine.getDistance(GraphNode(u), GraphNode(v)) == distances[(std::size_t) u * nodes + v];
+            }
+        }
+
+        if (!equal)
+        {
+            std::cout << "    Risultati diversi da Dijkstra" << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+#include "Benchmark.h"
+#include "../Graph/Graph.h"
+#include "../Graph/CsrGraph.h"
+#include "../Graph/MappedGraph.h"
+
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+/**
+ * Confronta l'avvio di un grafo ricostruito ripetendo addNode/addLink con l'apertura
+ * della sua istantanea mappata in memoria (MappedGraph), poi la scansione di tutti gli
+ * archi sul grafo compresso in memoria (CsrGraph) e su quello mappato. La prima scansione
+ * del grafo mappato include il caricamento delle pagine dalla page cache.
+ * Il throughput e' espresso in archi del grafo.
+ *
+ * Uso: benchmark_graph_snapshot [nodi] [grado] [esecuzioni]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+typedef MappedGraph<int, int> SnapshotGraph;
+
+/**
+ * Somma i pesi di tutti gli archi uscenti del grafo
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo da percorrere
+ * @return Somma dei pesi
+ */
+template <class TGraph>
+int64_t sumWeights(const TGraph& graph)
+{
+    int64_t sum = 0;
+
+    for (uint32_t u = 0; u < graph.getMaxNodeAmount(); u++)
+    {
+        for (auto link : graph.getOutLinks(GraphNode(u)))
+        {
+            sum += link.weight;
+        }
+    }
+
+    return sum;
+}
+
+
+int main(int argc, char const *argv[])
+{
+    uint32_t nodes = (uint32_t) benchmarkArgument(argc, argv, 1, 4096);
+    uint32_t degree = (uint32_t) benchmarkArgument(argc, argv, 2, 16);
+    uint32_t runs = (uint32_t) benchmarkArgument(argc, argv, 3, 8);
+    const char* path = "benchmark_graph_snapshot.bin";
+
+    if (nodes == 0)
+    {
+        nodes = 1;
+    }
+
+    uint64_t state = 88172645463325252ULL;
+
+    std::cout << "Core disponibili: " << std::thread::hardware_concurrency() << std::endl;
+
+    // Il Graph occupa O(V^2) memoria: e' il grafo da cui si parte all'avvio senza istantanea
+    Graph<int, int> matrix(1);
+    std::vector<GraphNode> ids(nodes);
+
+    {
+        BenchmarkTimer timer;
+
+        for (uint32_t i = 0; i < nodes; i++)
+        {
+            matrix.addNode(ids[i], (int) i);
+        }
+
+        for (uint64_t i = 0; i < (uint64_t) nodes * degree; i++)
+        {
+            uint32_t from = (uint32_t) (benchmarkRandom(state) % nodes);
+            uint32_t to = (uint32_t) (benchmarkRandom(state) % nodes);
+
+            if (!matrix.isLinkActive(ids[from], ids[to]))
+            {
+                matrix.addLink(ids[from], ids[to], 1 + (int) (benchmarkRandom(state) % 100));
+            }
+        }
+
+        benchmarkReport("ricostruzione Graph", timer.elapsedMilliseconds(), matrix.getLinkAmount());
+    }
+
+    uint64_t links = matrix.getLinkAmount();
+
+    std::cout << "Nodi: " << nodes << ", archi: " << links << std::endl;
+
+    {
+        std::ofstream out(path, std::ios::binary);
+        BenchmarkTimer timer;
+
+        if (!SnapshotGraph::save(out, matrix))
+        {
+            std::cout << "Salvataggio fallito" << std::endl;
+            return 1;
+        }
+
+        out.close();
+        benchmarkReport("salvataggio", timer.elapsedMilliseconds(), links);
+    }
+
+    CsrGraph<int, int> compressed(matrix);
+    SnapshotGraph mapped;
+
+    {
+        BenchmarkTimer timer;
+
+        if (!mapped.open(path))
+        {
+            std::cout << "Apertura fallita" << std::endl;
+            return 1;
+        }
+
+        benchmarkReport("apertura mmap", timer.elapsedMilliseconds(), links);
+    }
+
+    {
+        BenchmarkTimer timer;
+        bool valid = mapped.verify();
+
+        benchmarkReport("verifica completa", timer.elapsedMilliseconds(), links);
+
+        if (!valid)
+        {
+            std::cout << "    Istantanea non valida" << std::endl;
+        }
+    }
+
+    int64_t expected = sumWeights(matrix);
+    bool equal = true;
+
+    {
+        BenchmarkTimer timer;
+
+        for (uint32_t i = 0; i < runs; i++)
+        {
+            equal = equal && sumWeights(compressed) == expected;
+        }
+
+        benchmarkReport("scansione CsrGraph", timer.elapsedMilliseconds(), links * runs);
+    }
+
+    {
+        BenchmarkTimer timer;
+
+        for (uint32_t i = 0; i < runs; i++)
+        {
+            equal = equal && sumWeights(mapped) == expected;
+        }
+
+        benchmarkReport("scansione MappedGraph", timer.elapsedMilliseconds(), links * runs);
+    }
+
+    if (!equal)
+    {
+        std::cout << "    Pesi diversi fra i grafi" << std::endl;
+    }
+
+    mapped.close();
+    std::remove(path);
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include "Benchmark.h"
+#include "../Graph/Graph.h"
+#include "../Graph/CsrGraph.h"
+#include "../Graph/Prim.h"
+#include "../Graph/Kruskal.h"
+#include "../Graph/Boruvka.h"
+
+#include <thread>
+#include <vector>
+
+/**
+ * Confronta Prim, Kruskal e Boruvka parallelo (con un numero crescente di thread: 1, 2,
+ * 4, ... fino al massimo richiesto) su due grafi casuali pesati compressi (CsrGraph) con
+ * gli stessi nodi, uno sparso e uno denso. Il peso delle foreste viene confrontato fra
+ * i tre algoritmi. Il throughput e' espresso in archi del grafo per esecuzione.
+ *
+ * Uso: benchmark_minimum_spanning_tree [nodi] [grado sparso] [grado denso] [esecuzioni] [thread massimi]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+typedef CsrGraph<int, int> BenchmarkGraph;
+
+/**
+ * Crea un grafo casuale compresso con nodes nodi e circa nodes * degree archi
+ *
+ * @param nodes : Numero di nodi
+ * @param degree : Grado medio
+ * @param state : Stato del generatore casuale
+ * @return Grafo compresso
+ */
+BenchmarkGraph randomGraph(uint32_t nodes, uint32_t degree, uint64_t& state)
+{
+    // Il Graph occupa O(V^2) memoria: serve solo per costruire il grafo compresso
+    Graph<int, int> matrix(nodes);
+    std::vector<GraphNode> ids(nodes);
+
+    for (uint32_t i = 0; i < nodes; i++)
+    {
+        matrix.addNode(ids[i], 0);
+    }
+
+    for (uint64_t i = 0; i < (uint64_t) nodes * degree; i++)
+    {
+        uint32_t from = (uint32_t) (benchmarkRandom(state) % nodes);
+        uint32_t to = (uint32_t) (benchmarkRandom(state) % nodes);
+
+        if (!matrix.isLinkActive(ids[from], ids[to]))
+        {
+            matrix.addLink(ids[from], ids[to], 1 + (int) (benchmarkRandom(state) % 100000));
+        }
+    }
+
+    return BenchmarkGraph(matrix);
+}
+
+/**
+ * Esegue i tre algoritmi sul grafo e ne stampa il throughput
+ *
+ * @param name : Nome del grafo
+ * @param graph : Grafo di cui calcolare la foresta
+ * @param runs : Numero di esecuzioni di ogni algoritmo
+ * @param maxThreads : Numero massimo di thread per Boruvka
+ */
+void runAll(const std::string& name, const BenchmarkGraph& graph, uint32_t runs, uint64_t maxThreads)
+{
+    uint64_t links = (uint64_t) graph.getLinkAmount() * runs;
+    int64_t weight = 0;
+    bool equal = true;
+
+    std::cout << name << ": " << graph.getMaxNodeAmount() << " nodi, " << graph.getLinkAmount() << " archi" << std::endl;
+
+    {
+        Prim<BenchmarkGraph> prim(graph);
+        BenchmarkTimer timer;
+
+        for (uint32_t i = 0; i < runs; i++)
+        {
+            weight = prim.run().getWeight();
+        }
+
+        benchmarkReport(name + " prim", timer.elapsedMilliseconds(), links);
+    }
+
+    {
+        Kruskal<BenchmarkGraph> kruskal(graph);
+        BenchmarkTimer timer;
+
+        for (uint32_t i = 0; i < runs; i++)
+        {
+            equal = equal && kruskal.run().getWeight() == weight;
+        }
+
+        benchmarkReport(name + " kruskal", timer.elapsedMilliseconds(), links);
+    }
+
+    for (uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        ThreadPool pool(threads);
+        Boruvka<BenchmarkGraph> boruvka(graph, pool);
+        BenchmarkTimer timer;
+
+        for (uint32_t i = 0; i < runs; i++)
+        {
+            equal = equal && boruvka.run().getWeight() == weight;
+        }
+
+        benchmarkReport(name + " boruvka " + std::to_string(threads) + " thread", timer.elapsedMilliseconds(), links);
+    }
+
+    if (!equal)
+    {
+        std::cout << "    Pesi diversi fra gli algoritmi" << std::endl;
+    }
+
+    std::cout << "    Peso della foresta: " << weight << std::endl;
+}
+
+
+int main(int argc, char const *argv[])
+{
+    uint32_t nodes = (uint32_t) benchmarkArgument(argc, argv, 1, 4096);
+    uint32_t sparseDegree = (uint32_t) benchmarkArgument(argc, argv, 2, 8);
+    uint32_t denseDegree = (uint32_t) benchmarkArgument(argc, argv, 3, 512);
+    uint32_t runs = (uint32_t) benchmarkArgument(argc, argv, 4, 4);
+    uint64_t maxThreads = benchmarkArgument(argc, argv, 5, 16);
+
+    if (nodes == 0)
+    {
+        nodes = 1;
+    }
+
+    uint64_t state = 88172645463325252ULL;
+
+    std::cout << "Core disponibili: " << std::thread::hardware_concurrency() << std::endl;
+
+    {
+        BenchmarkGraph sparse = randomGraph(nodes, sparseDegree, state);
+
+        runAll("sparso", sparse, runs, maxThreads);
+    }
+
+    {
+        BenchmarkGraph dense = randomGraph(nodes, denseDegree, state);
+
+        runAll("denso", dense, runs, maxThreads);
+    }
+
+    return 0;
+}
@@ -0,0 +1,216 @@
+#include "Benchmark.h"
+#include "../Graph/Graph.h"
+#include "../Graph/CsrGraph.h"
+#include "../Graph/ParallelBfs.h"
+
+#include <thread>
+#include <vector>
+
+/**
+ * Misura la visita in ampiezza su un grafo casuale compresso (CsrGraph), da piu' nodi di
+ * partenza:
+ *  - la visita sequenziale di GraphTraversal, come riferimento;
+ *  - ParallelBfs con soli passi top-down e con il cambio di direzione, con un numero
+ *    crescente di thread (1, 2, 4, ... fino al massimo richiesto).
+ * Il throughput e' espresso in archi del grafo per visita.
+ *
+ * Uso: benchmark_parallel_bfs [nodi] [grado medio] [visite] [thread massimi]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+/**
+ * Visitatore che conta i nodi raggiunti, per impedire che la visita venga eliminata
+ */
+class CountVisitor : public TraversalVisitor<int>
+{
+    public:
+        uint64_t amount = 0; // Nodi visitati
+
+    public:
+        void preVisit(uint32_t node) { this->amount++; }
+};
+
+/**
+ * Visitatore che calcola il livello di ogni nodo durante la visita in ampiezza sequenziale
+ */
+class LevelVisitor : public TraversalVisitor<int>
+{
+    public:
+        std::vector<uint32_t> levels; // Livello di ogni nodo, UNREACHED se non raggiunto
+
+    public:
+        void visitLink(uint32_t from, uint32_t to, const int& weight)
+        {
+            if (this->levels[to] == ParallelBfs< CsrGraph<int, int> >::UNREACHED)
+            {
+                this->levels[to] = this->levels[from] + 1;
+            }
+        }
+};
+
+/**
+ * Confronta l'ultima visita di ParallelBfs con la visita in ampiezza sequenziale: i livelli
+ * devono coincidere e il padre di ogni nodo raggiunto deve essere un suo vicino entrante
+ * di un livello inferiore
+ *
+ * @param graph : Grafo visitato
+ * @param bfs : Visita parallela appena eseguita
+ * @param root : Nodo di partenza della visita
+ * @return true se la visita parallela e' corretta, false altrimenti
+ */
+bool checkParallel(const CsrGraph<int, int>& graph, const ParallelBfs< CsrGraph<int, int> >& bfs, uint32_t root)
+{
+    const uint32_t UNREACHED = ParallelBfs< CsrGraph<int, int> >::UNREACHED;
+    GraphTraversal< CsrGraph<int, int> > traversal(graph);
+    LevelVisitor visitor;
+
+    visitor.levels.assign(graph.getMaxNodeAmount(), UNREACHED);
+    visitor.levels[root] = 0;
+    traversal.bfs(GraphNode(root), visitor);
+
+    const std::vector<uint32_t>& levels = bfs.getLevels();
+    const std::vector<uint32_t>& parents = bfs.getParents();
+
+    if (levels != visitor.levels)
+    {
+        return false;
+    }
+
+    for (uint32_t v = 0; v < levels.size(); v++)
+    {
+        if (levels[v] == UNREACHED || v == root)
+        {
+            continue;
+        }
+
+        uint32_t parent = parents[v];
+
+        if (parent >= levels.size() || levels[parent] + 1 != levels[v] || !graph.isLinkActive(GraphNode(parent), GraphNode(v)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Esegue una visita da ognuno dei nodi di partenza con ParallelBfs e ne stampa il throughput,
+ * poi ripete le visite fuori dalla misura e le confronta con quella sequenziale
+ *
+ * @param name : Nome della prova
+ * @param graph : Grafo da visitare
+ * @param roots : Nodi di partenza
+ * @param threads : Numero di thread
+ * @param alpha : Soglia per il passaggio al bottom-up, zero per disattivarlo
+ */
+void runParallel(const std::string& name, const CsrGraph<int, int>& graph, const std::vector<uint32_t>& roots, uint32_t threads, uint32_t alpha)
+{
+    ThreadPool pool(threads);
+    ParallelBfs< CsrGraph<int, int> > bfs(graph, pool);
+    uint64_t reached = 0;
+
+    bfs.setThresholds(alpha, ParallelBfs< CsrGraph<int, int> >::DEFAULT_BETA);
+
+    BenchmarkTimer timer;
+
+    for (std::size_t i = 0; i < roots.size(); i++)
+    {
+        bfs.run(GraphNode(roots[i]));
+        reached += bfs.getReachedAmount();
+    }
+
+    benchmarkReport(name + " " + std::to_string(threads) + " thread", timer.elapsedMilliseconds(), (uint64_t) graph.getLinkAmount() * roots.size());
+
+    if (reached == 0)
+    {
+        std::cout << "Nessun nodo raggiunto" << std::endl;
+    }
+
+    for (std::size_t i = 0; i < roots.size(); i++)
+    {
+        bfs.run(GraphNode(roots[i]));
+
+        if (!checkParallel(graph, bfs, roots[i]))
+        {
+            std::cout << "    Risultati diversi dalla visita sequenziale" << std::endl;
+            break;
+        }
+    }
+}
+
+
+int main(int argc, char const *argv[])
+{
+    uint32_t nodes = (uint32_t) benchmarkArgument(argc, argv, 1, 4096);
+    uint32_t degree = (uint32_t) benchmarkArgument(argc, argv, 2, 16);
+    uint32_t visits = (uint32_t) benchmarkArgument(argc, argv, 3, 64);
+    uint64_t maxThreads = benchmarkArgument(argc, argv, 4, 16);
+
+    if (nodes == 0)
+    {
+        nodes = 1;
+    }
+
+    uint64_t state = 88172645463325252ULL;
+    std::vector<uint32_t> roots;
+
+    // Il Graph occupa O(V^2) memoria: serve solo per costruire il grafo compresso
+    CsrGraph<int, int> graph;
+
+    {
+        Graph<int, int> matrix(nodes);
+        std::vector<GraphNode> ids(nodes);
+
+        for (uint32_t i = 0; i < nodes; i++)
+        {
+            matrix.addNode(ids[i], 0);
+        }
+
+        for (uint64_t i = 0; i < (uint64_t) nodes * degree; i++)
+        {
+            uint32_t from = (uint32_t) (benchmarkRandom(state) % nodes);
+            uint32_t to = (uint32_t) (benchmarkRandom(state) % nodes);
+
+            if (!matrix.isLinkActive(ids[from], ids[to]))
+            {
+                matrix.addLink(ids[from], ids[to], 1);
+            }
+        }
+
+        graph = CsrGraph<int, int>(matrix);
+    }
+
+    for (uint32_t i = 0; i < visits; i++)
+    {
+        roots.push_back((uint32_t) (benchmarkRandom(state) % nodes));
+    }
+
+    std::cout << "Nodi: " << nodes << ", archi: " << graph.getLinkAmount() << ", visite: " << visits
+              << ", core disponibili: " << std::thread::hardware_concurrency() << std::endl;
+
+    {
+        GraphTraversal< CsrGraph<int, int> > traversal(graph);
+        CountVisitor visitor;
+        BenchmarkTimer timer;
+
+        for (std::size_t i = 0; i < roots.size(); i++)
+        {
+            traversal.bfs(GraphNode(roots[i]), visitor);
+        }
+
+        benchmarkReport("sequenziale", timer.elapsedMilliseconds(), (uint64_t) graph.getLinkAmount() * roots.size());
+    }
+
+    for (uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        runParallel("top-down", graph, roots, threads, 0);
+    }
+
+    for (uint32_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        runParallel("direction-optimizing", graph, roots, threads, ParallelBfs< CsrGraph<int, int> >::DEFAULT_ALPHA);
+    }
+
+    return 0;
+}
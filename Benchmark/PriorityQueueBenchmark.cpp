@@ -0,0 +1,148 @@
+#include "Benchmark.h"
+#include "../PriorityQueue/PriorityQueue.h"
+#include "../PriorityQueue/DaryPriorityQueue.h"
+#include "../PriorityQueue/PairingHeap.h"
+
+/**
+ * Confronta lo heap binario, gli heap 4-ario e 8-ario e il pairing heap su tre tracce:
+ *  - insert-heavy: 10 inserimenti per ogni estrazione;
+ *  - pop-heavy: tutti gli inserimenti seguiti da tutte le estrazioni;
+ *  - mixed: inserimenti ed estrazioni alternati in modo casuale.
+ *
+ * Uso: benchmark_priority_queue [numero di operazioni]
+ * Per risultati significativi compilare con -DCMAKE_BUILD_TYPE=Release
+ */
+
+/**
+ * Traccia con 10 inserimenti per ogni estrazione
+ *
+ * @tparam TQueue : Coda con priorita' da misurare
+ * @param operations : Numero di operazioni
+ * @return Checksum dei minimi estratti, per evitare che il lavoro venga eliminato
+ */
+template <class TQueue>
+uint64_t insertHeavy(uint64_t operations)
+{
+    TQueue queue;
+    uint64_t state = 88172645463325252ULL;
+    uint64_t checksum = 0;
+
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        if (i % 11 == 10)
+        {
+            checksum += queue.min();
+            queue.deleteMin();
+        }
+
+        else
+        {
+            queue.insert(benchmarkRandom(state) % 1000000);
+        }
+    }
+
+    return checksum;
+}
+
+/**
+ * Traccia con tutti gli inserimenti seguiti da tutte le estrazioni
+ *
+ * @tparam TQueue : Coda con priorita' da misurare
+ * @param operations : Numero di operazioni
+ * @return Checksum dei minimi estratti
+ */
+template <class TQueue>
+uint64_t popHeavy(uint64_t operations)
+{
+    TQueue queue;
+    uint64_t state = 88172645463325252ULL;
+    uint64_t checksum = 0;
+
+    for (uint64_t i = 0; i < operations / 2; i++)
+    {
+        queue.insert(benchmarkRandom(state) % 1000000);
+    }
+
+    while (!queue.isEmpty())
+    {
+        checksum += queue.min();
+        queue.deleteMin();
+    }
+
+    return checksum;
+}
+
+/**
+ * Traccia con inserimenti ed estrazioni alternati casualmente
+ *
+ * @tparam TQueue : Coda con priorita' da misurare
+ * @param operations : Numero di operazioni
+ * @return Checksum dei minimi estratti
+ */
+template <class TQueue>
+uint64_t mixed(uint64_t operations)
+{
+    TQueue queue;
+    uint64_t state = 88172645463325252ULL;
+    uint64_t checksum = 0;
+
+    for (uint64_t i = 0; i < operations; i++)
+    {
+        uint64_t random = benchmarkRandom(state);
+
+        if ((random & 1) && !queue.isEmpty())
+        {
+            checksum += queue.min();
+            queue.deleteMin();
+        }
+
+        else
+        {
+            queue.insert((random >> 1) % 1000000);
+        }
+    }
+
+    return checksum;
+}
+
+/**
+ * Esegue le tre tracce su una coda con priorita' e ne stampa i tempi
+ *
+ * @tparam TQueue : Coda con priorita' da misurare
+ * @param name : Nome della coda
+ * @param operations : Numero di operazioni per traccia
+ */
+template <class TQueue>
+void runTraces(const std::string& name, uint64_t operations)
+{
+    uint64_t checksum = 0;
+    BenchmarkTimer timer;
+
+    checksum += insertHeavy<TQueue>(operations);
+    benchmarkReport(name + " insert-heavy", timer.elapsedMilliseconds(), operations);
+
+    timer.restart();
+    checksum += popHeavy<TQueue>(operations);
+    benchmarkReport(name + " pop-heavy", timer.elapsedMilliseconds(), operations);
+
+    timer.restart();
+    checksum += mixed<TQueue>(operations);
+    benchmarkReport(name + " mixed", timer.elapsedMilliseconds(), operations);
+
+    std::cout << "  checksum: " << checksum << std::endl;
+}
+
+
+int main(int argc, char const *argv[])
+{
+    uint64_t operations = benchmarkArgument(argc, argv, 1, 2000000);
+
+    std::cout << "Operazioni per traccia: " << operations << std::endl;
+
+    runTraces< PriorityQueue<uint64_t> >("binary heap", operations);
+    runTraces< DaryPriorityQueue<uint64_t, 4> >("4-ary heap", operations);
+    runTraces< DaryPriorityQueue<uint64_t, 8> >("8-ary heap", operations);
+    runTraces< PairingHeap<uint64_t> >("pairing heap", operations);
+
+    return 0;
+}
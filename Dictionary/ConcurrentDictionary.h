@@ -0,0 +1,613 @@
+#ifndef _CONCURRENTDICTIONARY_H
+#define _CONCURRENTDICTIONARY_H
+
+#include "Hash.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Tabella hash di una partizione di ConcurrentDictionary. Usa lo stesso schema del
+ * Dictionary: indirizzamento aperto, scansione lineare e capacita' potenza di due.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ */
+template <class Key, class Value>
+class ConcurrentTable
+{
+    public:
+        uint32_t size; // Numero di bucket, sempre potenza di due
+        uint32_t mask; // Maschera per ottenere il bucket dall'hashcode, pari a size - 1
+        uint8_t* used; // Se diverso da zero, il bucket contiene un'associazione
+        Key* keys; // Chiave di ogni bucket
+        Value* values; // Valore di ogni bucket
+
+    public:
+        ConcurrentTable(uint32_t size);
+        ~ConcurrentTable();
+};
+
+/**
+ * Crea una tabella vuota con size bucket. size deve essere una potenza di due.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @param size : Numero di bucket
+ */
+template <class Key, class Value>
+ConcurrentTable<Key, Value>::ConcurrentTable(uint32_t size)
+{
+    this->size = size;
+    this->mask = size - 1;
+    this->used = new uint8_t[size]();
+    this->keys = new Key[size]();
+    this->values = new Value[size]();
+}
+
+/**
+ * Distruttore
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ */
+template <class Key, class Value>
+ConcurrentTable<Key, Value>::~ConcurrentTable()
+{
+    delete[] this->used;
+    delete[] this->keys;
+    delete[] this->values;
+}
+
+
+/**
+ * Partizione (shard) di ConcurrentDictionary. Occupa almeno una linea di cache, cosi'
+ * che partizioni diverse non si contendano la stessa linea.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ */
+template <class Key, class Value>
+class alignas(64) ConcurrentShard
+{
+    public:
+        std::mutex writerLock; // Serializza gli scrittori della partizione
+        std::atomic<uint32_t> sequence; // Contatore del seqlock, dispari durante una scrittura
+        std::atomic<ConcurrentTable<Key, Value>*> table; // Tabella corrente
+        std::atomic<uint32_t> pairsAmount; // Numero di associazioni nella partizione
+        std::vector<ConcurrentTable<Key, Value>*> retired; // Tabelle sostituite, liberate alla distruzione
+};
+
+
+/**
+ * Dizionario concorrente per piu' lettori e scrittori.
+ *
+ * Le chiavi sono distribuite in Shards partizioni in base ai bit alti dell'hashcode;
+ * ogni partizione e' una tabella hash con lo stesso schema di scansione del Dictionary.
+ * Gli scrittori di una partizione sono serializzati da un mutex, mentre scrittori di
+ * partizioni diverse procedono in parallelo.
+ *
+ * I lettori non prendono alcun lock: ogni partizione e' protetta da un seqlock. Lo
+ * scrittore rende dispari il contatore prima di modificare la tabella e di nuovo pari
+ * alla fine; il lettore legge il contatore, esegue la ricerca e la ripete se nel
+ * frattempo il contatore e' cambiato o era dispari. Per questo chiavi e valori devono
+ * essere copiabili byte per byte (trivially copyable): una lettura concorrente ad una
+ * scrittura puo' vedere dati parziali, che vengono poi scartati.
+ *
+ * Quando una tabella raddoppia, quella vecchia non viene liberata subito perche' un
+ * lettore potrebbe ancora scandirla: viene conservata fino alla distruzione del
+ * dizionario. La memoria in piu' e' al massimo pari a quella della tabella corrente.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash, deve restituire un hashcode a 64 bit
+ * @tparam Shards: Numero di partizioni, potenza di due
+ */
+template <class Key, class Value, class Hash = DefaultHash<Key>, uint32_t Shards = 64>
+class ConcurrentDictionary
+{
+    static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0, "Il numero di partizioni deve essere una potenza di due");
+    static_assert(std::is_trivially_copyable<Key>::value, "Le chiavi devono essere trivially copyable");
+    static_assert(std::is_trivially_copyable<Value>::value, "I valori devono essere trivially copyable");
+
+    public:
+        typedef ConcurrentTable<Key, Value> Table;
+        typedef ConcurrentShard<Key, Value> Shard;
+
+    private:
+        static const uint32_t _DEFAULT_SHARD_SIZE = 16U; // Dimensioni di default di ogni partizione
+        static const uint32_t _NOT_FOUND = UINT32_MAX; // Bucket di una chiave inesistente
+
+        Shard _shards[Shards]; // Partizioni del dizionario
+        Hash _hasher; // Funzione hash
+
+    private:
+        Shard& _shard(uint64_t hash);
+        const Shard& _shard(uint64_t hash) const;
+
+        uint32_t _find(const Table* table, const Key& key, uint64_t hash) const;
+        bool _read(const Shard& shard, const Key& key, uint64_t hash, Value* value) const;
+
+        void _beginWrite(Shard& shard);
+        void _endWrite(Shard& shard);
+        void _resize(Shard& shard);
+
+    public:
+        ConcurrentDictionary();
+        ConcurrentDictionary(uint32_t size);
+        ~ConcurrentDictionary();
+
+        bool isEmpty() const;
+        uint32_t getSize() const;
+
+        bool has(const Key& key) const;
+        bool get(const Key& key, Value& value) const;
+
+        void insert(const Key& key, const Value& value);
+        void erase(const Key& key);
+        void update(const Key& key, const Value& value);
+};
+
+
+/**
+ * Crea un dizionario vuoto con 16 bucket per partizione
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+ConcurrentDictionary<Key, Value, Hash, Shards>::ConcurrentDictionary() : ConcurrentDictionary(0) { }
+
+/**
+ * Crea un dizionario vuoto pensato per contenere circa size associazioni, divise
+ * fra le partizioni. Ogni partizione ha almeno 16 bucket.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param size : Numero di associazioni previste
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+ConcurrentDictionary<Key, Value, Hash, Shards>::ConcurrentDictionary(uint32_t size)
+{
+    uint32_t shardSize = _DEFAULT_SHARD_SIZE;
+
+    // Con fattore di carico massimo 3/4 servono circa 4/3 bucket per associazione
+    while ((uint64_t) shardSize * 3 < (uint64_t) (size / Shards + 1) * 4)
+    {
+        shardSize <<= 1;
+    }
+
+    for (uint32_t i = 0; i < Shards; i++)
+    {
+        this->_shards[i].sequence.store(0, std::memory_order_relaxed);
+        this->_shards[i].pairsAmount.store(0, std::memory_order_relaxed);
+        this->_shards[i].table.store(new Table(shardSize), std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/**
+ * Distruttore. Non deve essere eseguito mentre altri thread usano il dizionario.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+ConcurrentDictionary<Key, Value, Hash, Shards>::~ConcurrentDictionary()
+{
+    for (uint32_t i = 0; i < Shards; i++)
+    {
+        delete this->_shards[i].table.load(std::memory_order_relaxed);
+
+        for (std::size_t j = 0; j < this->_shards[i].retired.size(); j++)
+        {
+            delete this->_shards[i].retired[j];
+        }
+    }
+}
+
+/**
+ * Restituisce true se il dizionario e' vuoto, altrimenti false.
+ * Con scrittori concorrenti il risultato e' solo indicativo.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @return True se e' vuoto, altrimenti false
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+bool ConcurrentDictionary<Key, Value, Hash, Shards>::isEmpty() const
+{
+    return (this->getSize() == 0);
+}
+
+/**
+ * Restituisce il numero di associazioni presenti nel dizionario.
+ * Con scrittori concorrenti il risultato e' solo indicativo.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @return Numero di associazioni
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+uint32_t ConcurrentDictionary<Key, Value, Hash, Shards>::getSize() const
+{
+    uint32_t size = 0;
+
+    for (uint32_t i = 0; i < Shards; i++)
+    {
+        size += this->_shards[i].pairsAmount.load(std::memory_order_relaxed);
+    }
+
+    return size;
+}
+
+/**
+ * Restituisce true se la chiave key esiste all'interno del dizionario, altrimenti false.
+ * Non prende alcun lock.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param key : Chiave da cercare
+ * @return True se la chiave esiste, altrimenti false
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+bool ConcurrentDictionary<Key, Value, Hash, Shards>::has(const Key& key) const
+{
+    uint64_t hash = this->_hasher(key);
+    return this->_read(this->_shard(hash), key, hash, nullptr);
+}
+
+/**
+ * Copia in value il valore associato a key. Non prende alcun lock.
+ * Se key non esiste, value non viene modificato.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param key : Chiave dell'associazione
+ * @param value : Valore associato a key
+ * @return True se la chiave esiste, altrimenti false
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+bool ConcurrentDictionary<Key, Value, Hash, Shards>::get(const Key& key, Value& value) const
+{
+    uint64_t hash = this->_hasher(key);
+    return this->_read(this->_shard(hash), key, hash, &value);
+}
+
+/**
+ * Inserisce un'associazione chiave-valore all'interno del dizionario.
+ * Se nel dizionario esiste key, allora viene aggiornato il valore a cui e' associata.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param key : Chiave da inserire
+ * @param value : Valore da associare alla chiave
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+void ConcurrentDictionary<Key, Value, Hash, Shards>::insert(const Key& key, const Value& value)
+{
+    uint64_t hash = this->_hasher(key);
+    Shard& shard = this->_shard(hash);
+    std::lock_guard<std::mutex> lock(shard.writerLock);
+
+    Table* table = shard.table.load(std::memory_order_relaxed);
+    uint32_t bucket = this->_find(table, key, hash);
+
+    this->_beginWrite(shard);
+
+    if (bucket != _NOT_FOUND)
+    {
+        table->values[bucket] = value;
+        this->_endWrite(shard);
+
+        return;
+    }
+
+    uint32_t pairsAmount = shard.pairsAmount.load(std::memory_order_relaxed);
+
+    if ((uint64_t) (pairsAmount + 1) * 4 > (uint64_t) table->size * 3)
+    {
+        this->_resize(shard);
+        table = shard.table.load(std::memory_order_relaxed);
+    }
+
+    bucket = (uint32_t) hash & table->mask;
+
+    while (table->used[bucket])
+    {
+        bucket = (bucket + 1) & table->mask;
+    }
+
+    table->keys[bucket] = key;
+    table->values[bucket] = value;
+    table->used[bucket] = 1;
+
+    shard.pairsAmount.store(pairsAmount + 1, std::memory_order_relaxed);
+    this->_endWrite(shard);
+}
+
+/**
+ * Elimina un'associazione chiave-valore dal dizionario, spostando indietro le
+ * associazioni successive del cluster come nel Dictionary (backward-shift)
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param key : Chiave dell'associazione da eliminare
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+void ConcurrentDictionary<Key, Value, Hash, Shards>::erase(const Key& key)
+{
+    uint64_t hash = this->_hasher(key);
+    Shard& shard = this->_shard(hash);
+    std::lock_guard<std::mutex> lock(shard.writerLock);
+
+    Table* table = shard.table.load(std::memory_order_relaxed);
+    uint32_t hole = this->_find(table, key, hash);
+
+    if (hole == _NOT_FOUND)
+    {
+        return;
+    }
+
+    this->_beginWrite(shard);
+
+    table->used[hole] = 0;
+    uint32_t next = (hole + 1) & table->mask;
+
+    while (table->used[next])
+    {
+        uint32_t home = (uint32_t) this->_hasher(table->keys[next]) & table->mask;
+
+        if (((next - home) & table->mask) >= ((next - hole) & table->mask))
+        {
+            table->keys[hole] = table->keys[next];
+            table->values[hole] = table->values[next];
+            table->used[hole] = 1;
+            table->used[next] = 0;
+            hole = next;
+        }
+
+        next = (next + 1) & table->mask;
+    }
+
+    shard.pairsAmount.store(shard.pairsAmount.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+    this->_endWrite(shard);
+}
+
+/**
+ * Aggiorna il valore associato alla chiave key, con un nuovo valore value.
+ * Se l'associazione chiave-valore non esiste nel dizionario, allora viene creata.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param key : Chiave a cui aggiornare il valore
+ * @param value : Nuovo valore da associare alla chiave
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+void ConcurrentDictionary<Key, Value, Hash, Shards>::update(const Key& key, const Value& value)
+{
+    this->insert(key, value);
+}
+
+
+/**
+ * Restituisce la partizione di una chiave, scelta con i bit alti dell'hashcode
+ * perche' quelli bassi scelgono il bucket
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param hash : Hashcode della chiave
+ * @return Partizione
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+typename ConcurrentDictionary<Key, Value, Hash, Shards>::Shard& ConcurrentDictionary<Key, Value, Hash, Shards>::_shard(uint64_t hash)
+{
+    return this->_shards[(uint32_t) (hash >> 40) & (Shards - 1)];
+}
+
+/**
+ * Restituisce la partizione di una chiave
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param hash : Hashcode della chiave
+ * @return Partizione
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+const typename ConcurrentDictionary<Key, Value, Hash, Shards>::Shard& ConcurrentDictionary<Key, Value, Hash, Shards>::_shard(uint64_t hash) const
+{
+    return this->_shards[(uint32_t) (hash >> 40) & (Shards - 1)];
+}
+
+/**
+ * Restituisce il bucket di table che contiene key, oppure _NOT_FOUND. La scansione
+ * e' limitata al numero di bucket, cosi' termina anche su una tabella letta mentre
+ * uno scrittore la modifica.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param table : Tabella in cui cercare
+ * @param key : Chiave da cercare
+ * @param hash : Hashcode della chiave
+ * @return Bucket della chiave, oppure _NOT_FOUND
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+uint32_t ConcurrentDictionary<Key, Value, Hash, Shards>::_find(const Table* table, const Key& key, uint64_t hash) const
+{
+    uint32_t bucket = (uint32_t) hash & table->mask;
+
+    for (uint32_t i = 0; i < table->size && table->used[bucket]; i++)
+    {
+        if (table->keys[bucket] == key)
+        {
+            return bucket;
+        }
+
+        bucket = (bucket + 1) & table->mask;
+    }
+
+    return _NOT_FOUND;
+}
+
+/**
+ * Cerca key nella partizione senza prendere lock. La ricerca viene ripetuta finche'
+ * il contatore del seqlock e' pari e non cambia durante la ricerca.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param shard : Partizione della chiave
+ * @param key : Chiave da cercare
+ * @param hash : Hashcode della chiave
+ * @param value : Se diverso da nullptr, riceve il valore associato a key
+ * @return True se la chiave esiste, altrimenti false
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+bool ConcurrentDictionary<Key, Value, Hash, Shards>::_read(const Shard& shard, const Key& key, uint64_t hash, Value* value) const
+{
+    while (true)
+    {
+        uint32_t before = shard.sequence.load(std::memory_order_acquire);
+
+        if (before & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const Table* table = shard.table.load(std::memory_order_acquire);
+        uint32_t bucket = this->_find(table, key, hash);
+        Value found{};
+
+        if (bucket != _NOT_FOUND)
+        {
+            std::memcpy(&found, &(table->values[bucket]), sizeof(Value));
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (shard.sequence.load(std::memory_order_relaxed) != before)
+        {
+            continue;
+        }
+
+        if (bucket == _NOT_FOUND)
+        {
+            return false;
+        }
+
+        if (value != nullptr)
+        {
+            *value = found;
+        }
+
+        return true;
+    }
+}
+
+/**
+ * Inizia una scrittura nella partizione, rendendo dispari il contatore del seqlock.
+ * Deve essere chiamata tenendo il mutex della partizione.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param shard : Partizione da modificare
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+void ConcurrentDictionary<Key, Value, Hash, Shards>::_beginWrite(Shard& shard)
+{
+    shard.sequence.store(shard.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/**
+ * Termina una scrittura nella partizione, rendendo di nuovo pari il contatore del seqlock
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param shard : Partizione modificata
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+void ConcurrentDictionary<Key, Value, Hash, Shards>::_endWrite(Shard& shard)
+{
+    shard.sequence.store(shard.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/**
+ * Raddoppia la tabella della partizione. La nuova tabella viene riempita prima di
+ * essere pubblicata; quella vecchia resta valida per i lettori che la stanno ancora
+ * scandendo e viene liberata alla distruzione del dizionario.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @tparam Shards: Numero di partizioni
+ * @param shard : Partizione da far crescere
+ */
+template <class Key, class Value, class Hash, uint32_t Shards>
+void ConcurrentDictionary<Key, Value, Hash, Shards>::_resize(Shard& shard)
+{
+    Table* oldTable = shard.table.load(std::memory_order_relaxed);
+    Table* newTable = new Table(oldTable->size * 2);
+
+    for (uint32_t i = 0; i < oldTable->size; i++)
+    {
+        if (!oldTable->used[i])
+        {
+            continue;
+        }
+
+        uint32_t bucket = (uint32_t) this->_hasher(oldTable->keys[i]) & newTable->mask;
+
+        while (newTable->used[bucket])
+        {
+            bucket = (bucket + 1) & newTable->mask;
+        }
+
+        newTable->keys[bucket] = oldTable->keys[i];
+        newTable->values[bucket] = oldTable->values[i];
+        newTable->used[bucket] = 1;
+    }
+
+    shard.retired.push_back(oldTable);
+    shard.table.store(newTable, std::memory_order_release);
+}
+
+#endif // _CONCURRENTDICTIONARY_H
@@ -0,0 +1,156 @@
+#ifndef _CONTROLGROUP_H
+#define _CONTROLGROUP_H
+
+#include <cstdint>
+#include <cstring>
+
+// Se FLAT_DICTIONARY_SCALAR e' definita, viene usata la versione scalare anche
+// quando SSE2 e' disponibile (utile per confrontare le due versioni)
+#if !defined(FLAT_DICTIONARY_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define CONTROL_GROUP_SSE2
+#include <emmintrin.h>
+#endif
+
+/**
+ * Gruppo di 16 byte di controllo consecutivi di una tabella hash.
+ *
+ * Permette di confrontare in un colpo solo i 16 byte con il frammento di hash
+ * cercato e di trovare i bucket vuoti (byte con il bit alto a 1). Il risultato e' una
+ * maschera a 16 bit in cui il bit i corrisponde all'i-esimo byte del gruppo.
+ *
+ * Con SSE2 il confronto usa pcmpeqb e pmovmskb; altrimenti il gruppo viene letto
+ * come due parole a 64 bit e i byte vengono confrontati con operazioni bit a bit
+ * (SWAR). La versione viene scelta a tempo di compilazione.
+ */
+class ControlGroup
+{
+    public:
+        static const uint32_t SIZE = 16U; // Numero di byte di controllo in un gruppo
+
+    private:
+#if defined(CONTROL_GROUP_SSE2)
+        __m128i _bytes; // Byte di controllo del gruppo
+#else
+        uint64_t _low; // Primi 8 byte di controllo, il primo nel byte meno significativo
+        uint64_t _high; // Ultimi 8 byte di controllo
+#endif
+
+#if !defined(CONTROL_GROUP_SSE2)
+    private:
+        static uint64_t _load(const uint8_t* control);
+        static uint32_t _compact(uint64_t highBits);
+        static uint32_t _matchWord(uint64_t word, uint8_t fragment);
+#endif
+
+    public:
+        ControlGroup(const uint8_t* control);
+
+        uint32_t match(uint8_t fragment) const;
+        uint32_t matchEmpty() const;
+};
+
+
+/**
+ * Legge il gruppo di 16 byte di controllo che inizia in control
+ *
+ * @param control : Puntatore al primo byte del gruppo
+ */
+inline ControlGroup::ControlGroup(const uint8_t* control)
+{
+#if defined(CONTROL_GROUP_SSE2)
+    this->_bytes = _mm_loadu_si128((const __m128i*) control);
+#else
+    this->_low = _load(control);
+    this->_high = _load(control + 8);
+#endif
+}
+
+/**
+ * Restituisce la maschera dei byte uguali a fragment. La versione scalare puo'
+ * segnalare qualche falso positivo, mai un falso negativo: chi la usa deve comunque
+ * confrontare la chiave.
+ *
+ * @param fragment : Frammento di hash cercato, compreso fra 0 e 127
+ * @return Maschera a 16 bit dei byte uguali a fragment
+ */
+inline uint32_t ControlGroup::match(uint8_t fragment) const
+{
+#if defined(CONTROL_GROUP_SSE2)
+    __m128i wanted = _mm_set1_epi8((char) fragment);
+    return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(this->_bytes, wanted));
+#else
+    return _matchWord(this->_low, fragment) | (_matchWord(this->_high, fragment) << 8);
+#endif
+}
+
+/**
+ * Restituisce la maschera dei byte che indicano un bucket vuoto
+ *
+ * @return Maschera a 16 bit dei bucket vuoti
+ */
+inline uint32_t ControlGroup::matchEmpty() const
+{
+#if defined(CONTROL_GROUP_SSE2)
+    // I frammenti hanno il bit alto a 0, i bucket vuoti a 1: basta pmovmskb
+    return (uint32_t) _mm_movemask_epi8(this->_bytes);
+#else
+    const uint64_t highBits = 0x8080808080808080ULL;
+    return _compact(this->_low & highBits) | (_compact(this->_high & highBits) << 8);
+#endif
+}
+
+
+#if !defined(CONTROL_GROUP_SSE2)
+
+/**
+ * Legge 8 byte di controllo in una parola, con il primo byte nella posizione meno significativa
+ *
+ * @param control : Puntatore al primo byte
+ * @return Parola a 64 bit
+ */
+inline uint64_t ControlGroup::_load(const uint8_t* control)
+{
+    uint64_t word;
+    std::memcpy(&word, control, sizeof(word));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+
+    return word;
+}
+
+/**
+ * Trasforma una parola in cui possono essere a 1 solo i bit alti dei byte in una
+ * maschera a 8 bit, un bit per byte
+ *
+ * @param highBits : Parola con i soli bit alti dei byte
+ * @return Maschera a 8 bit
+ */
+inline uint32_t ControlGroup::_compact(uint64_t highBits)
+{
+    // La moltiplicazione porta il bit alto del byte i nel bit 56 + i
+    return (uint32_t) (((highBits >> 7) * 0x0102040810204080ULL) >> 56);
+}
+
+/**
+ * Restituisce la maschera a 8 bit dei byte di word uguali a fragment
+ *
+ * @param word : 8 byte di controllo
+ * @param fragment : Frammento di hash cercato
+ * @return Maschera a 8 bit
+ */
+inline uint32_t ControlGroup::_matchWord(uint64_t word, uint8_t fragment)
+{
+    const uint64_t lowBits = 0x0101010101010101ULL;
+    const uint64_t highBits = 0x8080808080808080ULL;
+
+    // I byte uguali a fragment diventano zero; si cercano poi i byte nulli
+    uint64_t difference = word ^ (lowBits * fragment);
+
+    return _compact((difference - lowBits) & ~difference & highBits);
+}
+
+#endif
+
+#endif // _CONTROLGROUP_H
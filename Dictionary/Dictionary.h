@@ -2,6 +2,7 @@
 #define _DICTIONARY_H
 
 #include "IDictionary.h"
+#include "Hash.h"
 #include "../LinkedList/LinkedList.h"
 
 /**
@@ -149,32 +150,50 @@ std::ostream &operator<<(std::ostream& out, const Pair<Key1, Value1> &pair)
 
 /**
  * Struttura dati che realizza il dizionario con l'utilizzo della
- * tabella hash.
+ * tabella hash ad indirizzamento aperto con scansione lineare.
  *
- * La funzione hash utilizzata e' la DJB2
+ * La capacita' della tabella e' sempre una potenza di due, cosi' il bucket di
+ * una chiave si ottiene con una maschera sui bit bassi dell'hashcode invece che
+ * con il modulo. Quando il fattore di carico supererebbe quello massimo, la
+ * tabella raddoppia e ogni associazione viene reinserita a partire dal proprio
+ * bucket nella nuova tabella.
  *
  * @tparam Key: Tipo di dato della chiave
  * @tparam Value: Tipo di dato del valore da associare alla chiave
+ * @tparam Hash: Funzione hash, deve restituire un hashcode a 64 bit
  */
-template <class Key, class Value>
+template <class Key, class Value, class Hash = DefaultHash<Key> >
 class Dictionary : public IDictionary<Key, Value>
 {
     private:
+        static const uint32_t _DEFAULT_DICT_SIZE = 16U; // Dimensioni di default del dizionario
+        static constexpr float _DEFAULT_MAX_LOAD_FACTOR = 0.75f; // Fattore di carico massimo di default
+
         Pair<Key, Value>** _dict; // Dizionario simulato come una tabella hash
 
-        int _DEFAULT_DICT_SIZE = 11ULL; // Dimensioni di default del dizionario
-        int _size; // Dimensioni massime del dizionario
+        uint32_t _size; // Dimensioni massime del dizionario, sempre potenza di due
+        uint32_t _mask; // Maschera per ottenere il bucket dall'hashcode, pari a _size - 1
         uint32_t _pairsAmount; // Numero di elementi nel dizionario
+        float _maxLoadFactor; // Fattore di carico oltre il quale la tabella raddoppia
+        Hash _hasher; // Funzione hash
 
     private:
-        uint32_t _hash(const std::string& key); // djb2 hash function
+        void _allocate(uint32_t size);
+        uint64_t _hash(const Key& key) const;
         void _resize();
 
     public:
         Dictionary();
         Dictionary(int size);
+        Dictionary(int size, float maxLoadFactor);
         ~Dictionary();
 
+        uint32_t getSize() const;
+        uint32_t getCapacity() const;
+        float getLoadFactor() const;
+        float getMaxLoadFactor() const;
+        void setMaxLoadFactor(float maxLoadFactor);
+
         bool isEmpty() const;
         int search(const Key& key);
 
@@ -185,66 +204,71 @@ class Dictionary : public IDictionary<Key, Value>
         void erase(const Key& key);
         void update(const Key& key, const Value& value);
 
-        bool isSubset(Dictionary<Key, Value>& dictionary);
+        bool isSubset(Dictionary<Key, Value, Hash>& dictionary);
 
         LinkedList<Key>* keys();
         LinkedList<Value>* values();
 
         Pair<Key, Value>* operator[](Key key);
 
-        template <class K, class V>
-        friend std::ostream& operator<<(std::ostream& out, const Dictionary<K, V>& dictionary);
+        template <class K, class V, class H>
+        friend std::ostream& operator<<(std::ostream& out, const Dictionary<K, V, H>& dictionary);
 };
 
 /**
- * Crea un dizionario vuoto con le dimensioni di default pari a 11
+ * Crea un dizionario vuoto con le dimensioni di default pari a 16
  *
  * @tparam Key : Tipo della chiave
  * @tparam Value : Tipo del valore associato alla chiave
+ * @tparam Hash : Funzione hash
  */
-template <class Key, class Value>
-Dictionary<Key, Value>::Dictionary()
-{
-    this->_size = this->_DEFAULT_DICT_SIZE;
-    this->_pairsAmount = 0;
+template <class Key, class Value, class Hash>
+Dictionary<Key, Value, Hash>::Dictionary() : Dictionary(0, _DEFAULT_MAX_LOAD_FACTOR) { }
 
-    this->_dict = new Pair<Key, Value>*[this->_DEFAULT_DICT_SIZE];
-
-    for(std::size_t i = 0; i < this->_size; i++)
-    {
-        this->_dict[i] = nullptr;
-    }
-}
+/**
+ * Crea un dizionario con dimensioni pari a size, arrotondate alla potenza di due successiva.
+ * Se size e' zero allora il dizionario avra' le dimensioni di default 16.
+ *
+ * @tparam Key : Tipo della chiave
+ * @tparam Value : Tipo del valore associato alla chiave
+ * @tparam Hash : Funzione hash
+ * @param size : Dimensioni del dizionario
+ */
+template <class Key, class Value, class Hash>
+Dictionary<Key, Value, Hash>::Dictionary(int size) : Dictionary(size, _DEFAULT_MAX_LOAD_FACTOR) { }
 
 /**
- * Crea un dizionario con dimensioni pari a size.
- * Se size e' zero allora il dizionario avra' le dimensioni di default 11.
+ * Crea un dizionario con dimensioni pari a size, arrotondate alla potenza di due successiva,
+ * e con fattore di carico massimo maxLoadFactor.
+ * Se size e' zero allora il dizionario avra' le dimensioni di default 16; se maxLoadFactor
+ * non e' compreso fra 0 e 1 esclusi, viene usato il fattore di default 0.75.
  *
  * @tparam Key : Tipo della chiave
  * @tparam Value : Tipo del valore associato alla chiave
+ * @tparam Hash : Funzione hash
  * @param size : Dimensioni del dizionario
+ * @param maxLoadFactor : Fattore di carico massimo
  */
-template <class Key, class Value>
-Dictionary<Key, Value>::Dictionary(int size)
+template <class Key, class Value, class Hash>
+Dictionary<Key, Value, Hash>::Dictionary(int size, float maxLoadFactor)
 {
-    if (size == 0)
-    {
-        this->_size = this->_DEFAULT_DICT_SIZE;
-        this->_dict = new Pair<Key, Value>*[this->_DEFAULT_DICT_SIZE];
-    }
+    uint32_t capacity = _DEFAULT_DICT_SIZE;
 
-    else
+    if (size > 0)
     {
-        this->_size = size;
-        this->_dict = new Pair<Key, Value>*[size];
+        capacity = 1;
+
+        while (capacity < (uint32_t) size)
+        {
+            capacity <<= 1;
+        }
     }
 
-    this->_pairsAmount = 0;
+    this->_maxLoadFactor = _DEFAULT_MAX_LOAD_FACTOR;
+    this->setMaxLoadFactor(maxLoadFactor);
 
-    for(std::size_t i = 0; i < this->_size; i++)
-    {
-        this->_dict[i] = nullptr;
-    }
+    this->_pairsAmount = 0;
+    this->_allocate(capacity);
 }
 
 /**
@@ -253,8 +277,8 @@ Dictionary<Key, Value>::Dictionary(int size)
  * @tparam Key : Tipo della chiave
  * @tparam Value : Tipo del valore associato alla chiave
  */
-template<class Key, class Value>
-Dictionary<Key, Value>::~Dictionary()
+template <class Key, class Value, class Hash>
+Dictionary<Key, Value, Hash>::~Dictionary()
 {
     for (std::size_t i = 0; i < this->_size; i++)
     {
@@ -270,6 +294,83 @@ Dictionary<Key, Value>::~Dictionary()
     this->_pairsAmount = 0;
 }
 
+/**
+ * Restituisce il numero di associazioni presenti nel dizionario
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @return Numero di associazioni
+ */
+template <class Key, class Value, class Hash>
+uint32_t Dictionary<Key, Value, Hash>::getSize() const
+{
+    return this->_pairsAmount;
+}
+
+/**
+ * Restituisce il numero di bucket della tabella hash
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @return Numero di bucket
+ */
+template <class Key, class Value, class Hash>
+uint32_t Dictionary<Key, Value, Hash>::getCapacity() const
+{
+    return this->_size;
+}
+
+/**
+ * Restituisce il fattore di carico attuale, cioe' il rapporto fra associazioni e bucket
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @return Fattore di carico
+ */
+template <class Key, class Value, class Hash>
+float Dictionary<Key, Value, Hash>::getLoadFactor() const
+{
+    return (float) this->_pairsAmount / (float) this->_size;
+}
+
+/**
+ * Restituisce il fattore di carico massimo
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @return Fattore di carico massimo
+ */
+template <class Key, class Value, class Hash>
+float Dictionary<Key, Value, Hash>::getMaxLoadFactor() const
+{
+    return this->_maxLoadFactor;
+}
+
+/**
+ * Imposta il fattore di carico massimo. Il nuovo valore viene ignorato se non e'
+ * compreso fra 0 e 1 esclusi; se la tabella e' gia' piu' carica, raddoppia al
+ * prossimo inserimento.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param maxLoadFactor : Nuovo fattore di carico massimo
+ */
+template <class Key, class Value, class Hash>
+void Dictionary<Key, Value, Hash>::setMaxLoadFactor(float maxLoadFactor)
+{
+    if (!(maxLoadFactor > 0.0f && maxLoadFactor < 1.0f))
+    {
+        return;
+    }
+
+    this->_maxLoadFactor = maxLoadFactor;
+}
+
 /**
  * Restituisce true se il dizionario e' vuoto, altrimenti false.
  *
@@ -278,15 +379,16 @@ Dictionary<Key, Value>::~Dictionary()
  *
  * @return True se e' vuoto, altrimenti false.
  */
-template <class Key, class Value>
-bool Dictionary<Key, Value>::isEmpty() const
+template <class Key, class Value, class Hash>
+bool Dictionary<Key, Value, Hash>::isEmpty() const
 {
     return (this->_pairsAmount == 0);
 }
 
 /**
  * Restituisce l'indice associato ad una coppia chiave-valore.
- * Se la coppia chiave-valore non esiste, restituisce -1.
+ * Se la coppia chiave-valore non esiste, restituisce l'indice della cella vuota
+ * in cui andrebbe inserita, oppure -1 se il dizionario e' pieno.
  *
  * @tparam Key: Tipo di dato della chiave
  * @tparam Value: Tipo di dato del valore associato alla chiave
@@ -294,10 +396,10 @@ bool Dictionary<Key, Value>::isEmpty() const
  * @param key: Chiave da trovare l'indice
  * @return Indice della coppia chiave-valore, oppure -1.
  */
-template<class Key, class Value>
-int Dictionary<Key, Value>::search(const Key& key)
+template <class Key, class Value, class Hash>
+int Dictionary<Key, Value, Hash>::search(const Key& key)
 {
-    uint32_t homeBucket = this->_hash(key) % this->_size;
+    uint32_t homeBucket = (uint32_t) this->_hash(key) & this->_mask;
     uint32_t actualBucket = homeBucket;
 
     do
@@ -307,7 +409,7 @@ int Dictionary<Key, Value>::search(const Key& key)
             return (int) actualBucket;
         }
 
-        actualBucket = (actualBucket + 1) % this->_size;
+        actualBucket = (actualBucket + 1) & this->_mask;
 
     } while (actualBucket != homeBucket);
 
@@ -326,12 +428,12 @@ int Dictionary<Key, Value>::search(const Key& key)
  * @param key: Chiave da cercare
  * @return True se la chiave esiste, altrimenti false
  */
-template <class Key, class Value>
-bool Dictionary<Key, Value>::has(const Key& key)
+template <class Key, class Value, class Hash>
+bool Dictionary<Key, Value, Hash>::has(const Key& key)
 {
     int index = this->search(key);
 
-    if (index > -1)
+    if (index > -1 && this->_dict[index] != nullptr)
     {
         return true;
     }
@@ -348,8 +450,8 @@ bool Dictionary<Key, Value>::has(const Key& key)
  * @param key: Chiave dell'associazione
  * @return Associazione chiave-valore
  */
-template <class Key, class Value>
-Pair<Key, Value>* Dictionary<Key, Value>::get(const Key& key)
+template <class Key, class Value, class Hash>
+Pair<Key, Value>* Dictionary<Key, Value, Hash>::get(const Key& key)
 {
     int index = this->search(key);
 
@@ -373,10 +475,10 @@ Pair<Key, Value>* Dictionary<Key, Value>::get(const Key& key)
  * @param key: Chiave da inserire
  * @param value: Valore da associare alla chiave
  */
-template <class Key, class Value>
-void Dictionary<Key, Value>::insert(const Key &key, const Value &value)
+template <class Key, class Value, class Hash>
+void Dictionary<Key, Value, Hash>::insert(const Key &key, const Value &value)
 {
-    if (this->_pairsAmount + 1 == this->_size)
+    if ((float) (this->_pairsAmount + 1) > this->_maxLoadFactor * (float) this->_size)
     {
         this->_resize();
     }
@@ -407,24 +509,51 @@ void Dictionary<Key, Value>::insert(const Key &key, const Value &value)
 }
 
 /**
- * Elimina un'associazione chiave-valore dal dizionario
+ * Elimina un'associazione chiave-valore dal dizionario.
+ *
+ * Svuotare soltanto la cella interromperebbe la sequenza di scansione delle chiavi
+ * inserite dopo di essa nello stesso cluster, che non verrebbero piu' trovate da search.
+ * Per questo le associazioni successive del cluster vengono spostate indietro nella
+ * cella liberata, quando questa si trova fra il loro bucket di partenza e la loro
+ * posizione attuale (backward-shift). Non restano lapidi, quindi la tabella non
+ * peggiora dopo molti cicli di inserimenti e cancellazioni.
  *
  * @tparam Key: Tipo di dato della chiave
  * @tparam Value: Tipo di dato del valore associato alla chiave
  *
  * @param key: Chiave dell'associazione da eliminare
  */
-template <class Key, class Value>
-void Dictionary<Key, Value>::erase(const Key& key)
+template <class Key, class Value, class Hash>
+void Dictionary<Key, Value, Hash>::erase(const Key& key)
 {
     int index = this->search(key);
 
-    if (index > -1)
+    if (index == -1 || this->_dict[index] == nullptr)
     {
-        delete this->_dict[index];
-        this->_dict[index] = nullptr;
+        return;
+    }
+
+    delete this->_dict[index];
+    this->_dict[index] = nullptr;
+    this->_pairsAmount--;
 
-        this->_pairsAmount--;
+    uint32_t hole = (uint32_t) index;
+    uint32_t next = (hole + 1) & this->_mask;
+
+    while (this->_dict[next] != nullptr)
+    {
+        uint32_t home = (uint32_t) this->_hash(this->_dict[next]->getKey()) & this->_mask;
+
+        // L'associazione puo' occupare il buco solo se il buco si trova fra il suo
+        // bucket di partenza e la sua posizione attuale
+        if (((next - home) & this->_mask) >= ((next - hole) & this->_mask))
+        {
+            this->_dict[hole] = this->_dict[next];
+            this->_dict[next] = nullptr;
+            hole = next;
+        }
+
+        next = (next + 1) & this->_mask;
     }
 }
 
@@ -439,8 +568,8 @@ void Dictionary<Key, Value>::erase(const Key& key)
  * @param key: Chiave a cui aggiornare il valore
  * @param value: Nuovo valore da associare alla chiave
  */
-template <class Key, class Value>
-void Dictionary<Key, Value>::update(const Key& key, const Value& value)
+template <class Key, class Value, class Hash>
+void Dictionary<Key, Value, Hash>::update(const Key& key, const Value& value)
 {
     this->insert(key, value);
 }
@@ -456,8 +585,8 @@ void Dictionary<Key, Value>::update(const Key& key, const Value& value)
  * @param dictionary: Sottoinsieme da verificare
  * @return True se sono sottoinsiemi, altrimenti false.
  */
-template <class Key, class Value>
-bool Dictionary<Key, Value>::isSubset(Dictionary<Key, Value>& dictionary)
+template <class Key, class Value, class Hash>
+bool Dictionary<Key, Value, Hash>::isSubset(Dictionary<Key, Value, Hash>& dictionary)
 {
     if (dictionary._pairsAmount > this->_pairsAmount)
     {
@@ -503,12 +632,12 @@ bool Dictionary<Key, Value>::isSubset(Dictionary<Key, Value>& dictionary)
  *
  * @return Lista contenente tutte le chiavi nel dizionario
  */
-template <class Key, class Value>
-LinkedList<Key>* Dictionary<Key, Value>::keys()
+template <class Key, class Value, class Hash>
+LinkedList<Key>* Dictionary<Key, Value, Hash>::keys()
 {
     LinkedList<Key>* lKeys = new LinkedList<Key>();
 
-    for (int i = 0; i < this->_size; i++)
+    for (uint32_t i = 0; i < this->_size; i++)
     {
         if (this->_dict[i] != nullptr)
         {
@@ -527,12 +656,12 @@ LinkedList<Key>* Dictionary<Key, Value>::keys()
  *
  * @return Lista contenente tutti i valori associati alle chiavi
  */
-template <class Key, class Value>
-LinkedList<Value>* Dictionary<Key, Value>::values()
+template <class Key, class Value, class Hash>
+LinkedList<Value>* Dictionary<Key, Value, Hash>::values()
 {
     LinkedList<Value>* lValues = new LinkedList<Value>();
 
-    for (int i = 0; i < this->_size; i++)
+    for (uint32_t i = 0; i < this->_size; i++)
     {
         if (this->_dict[i] != nullptr)
         {
@@ -544,19 +673,19 @@ LinkedList<Value>* Dictionary<Key, Value>::values()
 }
 
 
-template<class Key, class Value>
-Pair<Key, Value> *Dictionary<Key, Value>::operator[](Key key)
+template <class Key, class Value, class Hash>
+Pair<Key, Value>* Dictionary<Key, Value, Hash>::operator[](Key key)
 {
     return this->get(key);
 }
 
 
-template <class K, class V>
-std::ostream& operator<<(std::ostream& out, const Dictionary<K, V>& dictionary)
+template <class K, class V, class H>
+std::ostream& operator<<(std::ostream& out, const Dictionary<K, V, H>& dictionary)
 {
     out << "[ " << std::endl;
 
-    for (int i = 0; i < dictionary._size; i++)
+    for (uint32_t i = 0; i < dictionary._size; i++)
     {
         if (dictionary._dict[i])
         {
@@ -572,54 +701,79 @@ std::ostream& operator<<(std::ostream& out, const Dictionary<K, V>& dictionary)
 
 
 /**
- * Implementazione della funzione hash DJB2
+ * Alloca una tabella vuota con size bucket. size deve essere una potenza di due.
  *
- * @param key: Chiave a cui applicare l'hash
- * @return Hashcode a 32-bits
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param size : Numero di bucket
  */
-template <class Key, class Value>
-uint32_t Dictionary<Key, Value>::_hash(const std::string& key) {
-    const unsigned char *chr = (const unsigned char *)key.c_str();
-    uint32_t hash = 5381;
-    uint32_t c = *chr++;
+template <class Key, class Value, class Hash>
+void Dictionary<Key, Value, Hash>::_allocate(uint32_t size)
+{
+    this->_size = size;
+    this->_mask = size - 1;
+    this->_dict = new Pair<Key, Value>*[size];
 
-    while (c)
+    for (uint32_t i = 0; i < size; i++)
     {
-        hash = ((hash << 5) + hash) ^ c;
-        c = *chr++;
+        this->_dict[i] = nullptr;
     }
+}
 
-    return hash;
+/**
+ * Restituisce l'hashcode di una chiave
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param key: Chiave a cui applicare l'hash
+ * @return Hashcode a 64 bit
+ */
+template <class Key, class Value, class Hash>
+uint64_t Dictionary<Key, Value, Hash>::_hash(const Key& key) const
+{
+    return this->_hasher(key);
 }
 
 
 /**
- * Aumenta di un fattore doppio le dimensioni del dizionario
+ * Aumenta di un fattore doppio le dimensioni del dizionario. Ogni associazione
+ * viene spostata nel bucket calcolato con la nuova maschera, cosi' le ricerche
+ * successive partono dal bucket corretto. Le coppie non vengono copiate: si
+ * spostano solo i puntatori.
  *
  * @tparam Key: Tipo di dato della chiave
  * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
  */
-template <class Key, class Value>
-void Dictionary<Key, Value>::_resize()
+template <class Key, class Value, class Hash>
+void Dictionary<Key, Value, Hash>::_resize()
 {
-    Pair<Key, Value>** newDict = new Pair<Key, Value>*[this->_size * 2];
+    Pair<Key, Value>** oldDict = this->_dict;
+    uint32_t oldSize = this->_size;
 
-    for (int i = 0; i < this->_size * 2; i++)
-    {
-        newDict[i] = nullptr;
-    }
+    this->_allocate(oldSize * 2);
 
-    for (int i = 0; i < this->_size; i++)
+    for (uint32_t i = 0; i < oldSize; i++)
     {
-        newDict[i] = this->_dict[i];
-        this->_dict[i] = nullptr;
-    }
+        if (oldDict[i] == nullptr)
+        {
+            continue;
+        }
 
-    delete[] this->_dict;
-    this->_dict = nullptr;
+        uint32_t bucket = (uint32_t) this->_hash(oldDict[i]->getKey()) & this->_mask;
+
+        // Le chiavi sono tutte distinte: basta trovare la prima cella libera
+        while (this->_dict[bucket] != nullptr)
+        {
+            bucket = (bucket + 1) & this->_mask;
+        }
+
+        this->_dict[bucket] = oldDict[i];
+    }
 
-    this->_dict = newDict;
-    this->_size *= 2;
+    delete[] oldDict;
 }
 
 
@@ -0,0 +1,660 @@
+#ifndef _FLATDICTIONARY_H
+#define _FLATDICTIONARY_H
+
+#include "Hash.h"
+#include "ControlGroup.h"
+#include "../Lib/Bits.h"
+
+#include <cstdint>
+#include <iostream>
+#include <utility>
+
+/**
+ * Associazione chiave-valore memorizzata direttamente nella tabella di FlatDictionary
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ */
+template <class Key, class Value>
+class FlatEntry
+{
+    public:
+        Key key; // Chiave
+        Value value; // Valore
+};
+
+
+/**
+ * Dizionario realizzato con una tabella hash "piatta" ad indirizzamento aperto con
+ * scansione lineare, nello stile delle Swiss table.
+ *
+ * Chiavi e valori sono memorizzati direttamente in un array di FlatEntry, senza
+ * un'allocazione per ogni associazione. Accanto alla tabella c'e' un array di byte
+ * di controllo, uno per bucket: 0x80 indica un bucket vuoto, altrimenti il byte
+ * contiene i 7 bit alti dell'hashcode della chiave. Durante la ricerca si confronta
+ * prima il byte di controllo e solo se coincide si legge e confronta la chiave, quindi
+ * la scansione tocca quasi sempre solo l'array dei byte di controllo, molto compatto.
+ *
+ * La scansione procede a gruppi di 16 byte di controllo (ControlGroup): con un solo
+ * confronto SSE2 si trovano tutti i bucket del gruppo con lo stesso frammento e il primo
+ * bucket vuoto, che termina la ricerca. Perche' un gruppo possa iniziare in qualunque
+ * bucket, i primi 15 byte di controllo sono ripetuti in fondo all'array.
+ *
+ * La cancellazione non lascia lapidi (tombstone): gli elementi successivi del cluster
+ * vengono spostati indietro finche' non sono di nuovo il piu' vicino possibile al
+ * proprio bucket (backward-shift), quindi le ricerche non si allungano dopo molte
+ * cancellazioni.
+ *
+ * La capacita' e' sempre una potenza di due, almeno 16, e la tabella raddoppia quando
+ * il fattore di carico supererebbe 3/4. Key e Value devono avere un costruttore di default.
+ * I riferimenti e i puntatori restituiti restano validi fino al prossimo inserimento
+ * o cancellazione.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash, deve restituire un hashcode a 64 bit
+ */
+template <class Key, class Value, class Hash = DefaultHash<Key> >
+class FlatDictionary
+{
+    public:
+        typedef FlatEntry<Key, Value> Entry;
+
+    private:
+        static const uint8_t _EMPTY = 0x80; // Byte di controllo di un bucket vuoto
+        static const uint32_t _DEFAULT_SIZE = 16U; // Capacita' minima e di default
+        static const uint32_t _NOT_FOUND = UINT32_MAX; // Bucket di una chiave inesistente
+
+        uint8_t* _control; // Byte di controllo di ogni bucket, seguiti dalla copia dei primi 15
+        Entry* _entries; // Associazioni memorizzate nella tabella
+        uint32_t _size; // Numero di bucket, sempre potenza di due
+        uint32_t _mask; // Maschera per ottenere il bucket dall'hashcode, pari a _size - 1
+        uint32_t _pairsAmount; // Numero di associazioni presenti
+        Hash _hasher; // Funzione hash
+
+    private:
+        static uint8_t _fragment(uint64_t hash);
+
+        void _allocate(uint32_t size);
+        void _setControl(uint32_t bucket, uint8_t control);
+        uint32_t _findEmpty(uint64_t hash) const;
+        void _release();
+        void _resize();
+        uint32_t _find(const Key& key, uint64_t hash) const;
+        uint32_t _place(const Key& key, uint64_t hash);
+
+    public:
+        FlatDictionary();
+        FlatDictionary(uint32_t size);
+        FlatDictionary(const FlatDictionary<Key, Value, Hash>& source);
+        ~FlatDictionary();
+
+        FlatDictionary<Key, Value, Hash>& operator=(const FlatDictionary<Key, Value, Hash>& source);
+
+        bool isEmpty() const;
+        uint32_t getSize() const;
+        uint32_t getCapacity() const;
+
+        bool has(const Key& key) const;
+        Value* get(const Key& key);
+        const Value* get(const Key& key) const;
+
+        void insert(const Key& key, const Value& value);
+        bool erase(const Key& key);
+        void clear();
+
+        Value& operator[](const Key& key);
+
+        template <class K, class V, class H>
+        friend std::ostream& operator<<(std::ostream& out, const FlatDictionary<K, V, H>& dictionary);
+};
+
+
+/**
+ * Crea un dizionario vuoto con capacita' di default pari a 16
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ */
+template <class Key, class Value, class Hash>
+FlatDictionary<Key, Value, Hash>::FlatDictionary() : FlatDictionary(_DEFAULT_SIZE) { }
+
+/**
+ * Crea un dizionario vuoto con capacita' pari a size, arrotondata alla potenza di due
+ * successiva. La capacita' non e' mai minore di 16.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param size : Capacita' iniziale
+ */
+template <class Key, class Value, class Hash>
+FlatDictionary<Key, Value, Hash>::FlatDictionary(uint32_t size)
+{
+    uint32_t capacity = _DEFAULT_SIZE;
+
+    while (capacity < size)
+    {
+        capacity <<= 1;
+    }
+
+    this->_pairsAmount = 0;
+    this->_allocate(capacity);
+}
+
+/**
+ * Costruttore di copia
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param source : Dizionario da copiare
+ */
+template <class Key, class Value, class Hash>
+FlatDictionary<Key, Value, Hash>::FlatDictionary(const FlatDictionary<Key, Value, Hash>& source)
+{
+    this->_hasher = source._hasher;
+    this->_pairsAmount = source._pairsAmount;
+    this->_allocate(source._size);
+
+    for (uint32_t i = 0; i < this->_size; i++)
+    {
+        this->_setControl(i, source._control[i]);
+        this->_entries[i] = source._entries[i];
+    }
+}
+
+/**
+ * Distruttore
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ */
+template <class Key, class Value, class Hash>
+FlatDictionary<Key, Value, Hash>::~FlatDictionary()
+{
+    this->_release();
+}
+
+/**
+ * Operatore di assegnamento
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param source : Dizionario da copiare
+ * @return Questo dizionario
+ */
+template <class Key, class Value, class Hash>
+FlatDictionary<Key, Value, Hash>& FlatDictionary<Key, Value, Hash>::operator=(const FlatDictionary<Key, Value, Hash>& source)
+{
+    if (this != &source)
+    {
+        this->_release();
+
+        this->_hasher = source._hasher;
+        this->_pairsAmount = source._pairsAmount;
+        this->_allocate(source._size);
+
+        for (uint32_t i = 0; i < this->_size; i++)
+        {
+            this->_setControl(i, source._control[i]);
+            this->_entries[i] = source._entries[i];
+        }
+    }
+
+    return *this;
+}
+
+/**
+ * Restituisce true se il dizionario e' vuoto, altrimenti false
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @return True se e' vuoto, altrimenti false
+ */
+template <class Key, class Value, class Hash>
+bool FlatDictionary<Key, Value, Hash>::isEmpty() const
+{
+    return (this->_pairsAmount == 0);
+}
+
+/**
+ * Restituisce il numero di associazioni presenti nel dizionario
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @return Numero di associazioni
+ */
+template <class Key, class Value, class Hash>
+uint32_t FlatDictionary<Key, Value, Hash>::getSize() const
+{
+    return this->_pairsAmount;
+}
+
+/**
+ * Restituisce il numero di bucket della tabella
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @return Numero di bucket
+ */
+template <class Key, class Value, class Hash>
+uint32_t FlatDictionary<Key, Value, Hash>::getCapacity() const
+{
+    return this->_size;
+}
+
+/**
+ * Restituisce true se la chiave key esiste all'interno del dizionario, altrimenti false
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param key : Chiave da cercare
+ * @return True se la chiave esiste, altrimenti false
+ */
+template <class Key, class Value, class Hash>
+bool FlatDictionary<Key, Value, Hash>::has(const Key& key) const
+{
+    return (this->_find(key, this->_hasher(key)) != _NOT_FOUND);
+}
+
+/**
+ * Restituisce il puntatore al valore associato a key, oppure nullptr se key non esiste
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param key : Chiave dell'associazione
+ * @return Puntatore al valore, oppure nullptr
+ */
+template <class Key, class Value, class Hash>
+Value* FlatDictionary<Key, Value, Hash>::get(const Key& key)
+{
+    uint32_t bucket = this->_find(key, this->_hasher(key));
+
+    if (bucket == _NOT_FOUND)
+    {
+        return nullptr;
+    }
+
+    return &(this->_entries[bucket].value);
+}
+
+/**
+ * Restituisce il puntatore al valore associato a key, oppure nullptr se key non esiste
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param key : Chiave dell'associazione
+ * @return Puntatore al valore, oppure nullptr
+ */
+template <class Key, class Value, class Hash>
+const Value* FlatDictionary<Key, Value, Hash>::get(const Key& key) const
+{
+    uint32_t bucket = this->_find(key, this->_hasher(key));
+
+    if (bucket == _NOT_FOUND)
+    {
+        return nullptr;
+    }
+
+    return &(this->_entries[bucket].value);
+}
+
+/**
+ * Inserisce un'associazione chiave-valore all'interno del dizionario.
+ * Se nel dizionario esiste key, allora viene aggiornato il valore a cui e' associata.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param key : Chiave da inserire
+ * @param value : Valore da associare alla chiave
+ */
+template <class Key, class Value, class Hash>
+void FlatDictionary<Key, Value, Hash>::insert(const Key& key, const Value& value)
+{
+    uint32_t bucket = this->_place(key, this->_hasher(key));
+    this->_entries[bucket].value = value;
+}
+
+/**
+ * Elimina l'associazione con chiave key. I successivi elementi del cluster vengono
+ * spostati indietro nel bucket liberato, se questo li avvicina al loro bucket
+ * di partenza, cosi' nessuna ricerca viene interrotta dal buco.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param key : Chiave dell'associazione da eliminare
+ * @return True se l'associazione esisteva, altrimenti false
+ */
+template <class Key, class Value, class Hash>
+bool FlatDictionary<Key, Value, Hash>::erase(const Key& key)
+{
+    uint32_t hole = this->_find(key, this->_hasher(key));
+
+    if (hole == _NOT_FOUND)
+    {
+        return false;
+    }
+
+    uint32_t next = (hole + 1) & this->_mask;
+
+    while (this->_control[next] != _EMPTY)
+    {
+        uint32_t home = (uint32_t) this->_hasher(this->_entries[next].key) & this->_mask;
+
+        // L'elemento puo' occupare il buco solo se il buco si trova fra il suo bucket
+        // di partenza e la sua posizione attuale
+        if (((next - home) & this->_mask) >= ((next - hole) & this->_mask))
+        {
+            this->_setControl(hole, this->_control[next]);
+            this->_entries[hole] = std::move(this->_entries[next]);
+            hole = next;
+        }
+
+        next = (next + 1) & this->_mask;
+    }
+
+    this->_setControl(hole, _EMPTY);
+    this->_entries[hole] = Entry();
+    this->_pairsAmount--;
+
+    return true;
+}
+
+/**
+ * Elimina tutte le associazioni, mantenendo la capacita' attuale
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ */
+template <class Key, class Value, class Hash>
+void FlatDictionary<Key, Value, Hash>::clear()
+{
+    for (uint32_t i = 0; i < this->_size; i++)
+    {
+        if (this->_control[i] != _EMPTY)
+        {
+            this->_setControl(i, _EMPTY);
+            this->_entries[i] = Entry();
+        }
+    }
+
+    this->_pairsAmount = 0;
+}
+
+/**
+ * Restituisce il riferimento al valore associato a key. Se key non esiste, viene
+ * inserita con il valore di default di Value.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param key : Chiave dell'associazione
+ * @return Riferimento al valore
+ */
+template <class Key, class Value, class Hash>
+Value& FlatDictionary<Key, Value, Hash>::operator[](const Key& key)
+{
+    uint32_t bucket = this->_place(key, this->_hasher(key));
+    return this->_entries[bucket].value;
+}
+
+template <class K, class V, class H>
+std::ostream& operator<<(std::ostream& out, const FlatDictionary<K, V, H>& dictionary)
+{
+    out << "[ " << std::endl;
+
+    for (uint32_t i = 0; i < dictionary._size; i++)
+    {
+        if (dictionary._control[i] != FlatDictionary<K, V, H>::_EMPTY)
+        {
+            out << "  Index: " << i << " -> { \"" << dictionary._entries[i].key << "\": " << dictionary._entries[i].value << " }" << std::endl;
+        }
+    }
+
+    out << "]" << std::endl;
+
+    return out;
+}
+
+
+/**
+ * Restituisce il byte di controllo di una chiave, cioe' i 7 bit alti del suo hashcode.
+ * I bit bassi sono gia' usati per scegliere il bucket, quindi i due valori sono indipendenti.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param hash : Hashcode della chiave
+ * @return Byte di controllo, compreso fra 0 e 127
+ */
+template <class Key, class Value, class Hash>
+uint8_t FlatDictionary<Key, Value, Hash>::_fragment(uint64_t hash)
+{
+    return (uint8_t) (hash >> 57);
+}
+
+/**
+ * Alloca una tabella vuota con size bucket. size deve essere una potenza di due.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param size : Numero di bucket
+ */
+template <class Key, class Value, class Hash>
+void FlatDictionary<Key, Value, Hash>::_allocate(uint32_t size)
+{
+    this->_size = size;
+    this->_mask = size - 1;
+    this->_control = new uint8_t[size + ControlGroup::SIZE - 1];
+    this->_entries = new Entry[size]();
+
+    for (uint32_t i = 0; i < size + ControlGroup::SIZE - 1; i++)
+    {
+        this->_control[i] = _EMPTY;
+    }
+}
+
+/**
+ * Imposta il byte di controllo di un bucket, aggiornandone anche la copia in fondo
+ * all'array se il bucket e' fra i primi 15
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param bucket : Bucket da aggiornare
+ * @param control : Nuovo byte di controllo
+ */
+template <class Key, class Value, class Hash>
+void FlatDictionary<Key, Value, Hash>::_setControl(uint32_t bucket, uint8_t control)
+{
+    this->_control[bucket] = control;
+
+    if (bucket < ControlGroup::SIZE - 1)
+    {
+        this->_control[this->_size + bucket] = control;
+    }
+}
+
+/**
+ * Libera la memoria della tabella
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ */
+template <class Key, class Value, class Hash>
+void FlatDictionary<Key, Value, Hash>::_release()
+{
+    delete[] this->_control;
+    delete[] this->_entries;
+
+    this->_control = nullptr;
+    this->_entries = nullptr;
+}
+
+/**
+ * Raddoppia la capacita' della tabella, spostando ogni associazione nel bucket
+ * calcolato con la nuova maschera
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ */
+template <class Key, class Value, class Hash>
+void FlatDictionary<Key, Value, Hash>::_resize()
+{
+    uint8_t* oldControl = this->_control;
+    Entry* oldEntries = this->_entries;
+    uint32_t oldSize = this->_size;
+
+    this->_allocate(oldSize * 2);
+
+    for (uint32_t i = 0; i < oldSize; i++)
+    {
+        if (oldControl[i] == _EMPTY)
+        {
+            continue;
+        }
+
+        // Le chiavi sono tutte distinte: basta trovare il primo bucket libero
+        uint32_t bucket = this->_findEmpty(this->_hasher(oldEntries[i].key));
+
+        this->_setControl(bucket, oldControl[i]);
+        this->_entries[bucket] = std::move(oldEntries[i]);
+    }
+
+    delete[] oldControl;
+    delete[] oldEntries;
+}
+
+/**
+ * Restituisce il bucket che contiene key, oppure _NOT_FOUND. La scansione parte dal
+ * bucket di partenza della chiave e si ferma al primo bucket vuoto, esaminando 16
+ * bucket alla volta: vengono confrontate solo le chiavi dei bucket con lo stesso
+ * frammento che precedono il primo bucket vuoto del gruppo.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param key : Chiave da cercare
+ * @param hash : Hashcode della chiave
+ * @return Bucket della chiave, oppure _NOT_FOUND
+ */
+template <class Key, class Value, class Hash>
+uint32_t FlatDictionary<Key, Value, Hash>::_find(const Key& key, uint64_t hash) const
+{
+    uint8_t fragment = _fragment(hash);
+    uint32_t start = (uint32_t) hash & this->_mask;
+
+    while (true)
+    {
+        ControlGroup group(this->_control + start);
+        uint32_t matches = group.match(fragment);
+        uint32_t empty = group.matchEmpty();
+
+        // Scarto i candidati successivi al primo bucket vuoto
+        if (empty != 0)
+        {
+            matches &= (empty & (0U - empty)) - 1;
+        }
+
+        while (matches != 0)
+        {
+            uint32_t bucket = (start + countTrailingZeros(matches)) & this->_mask;
+
+            if (this->_entries[bucket].key == key)
+            {
+                return bucket;
+            }
+
+            matches &= matches - 1;
+        }
+
+        if (empty != 0)
+        {
+            return _NOT_FOUND;
+        }
+
+        start = (start + ControlGroup::SIZE) & this->_mask;
+    }
+}
+
+/**
+ * Restituisce il primo bucket vuoto a partire dal bucket di partenza di hash.
+ * La tabella non e' mai piena, quindi un bucket vuoto esiste sempre.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param hash : Hashcode della chiave
+ * @return Primo bucket vuoto
+ */
+template <class Key, class Value, class Hash>
+uint32_t FlatDictionary<Key, Value, Hash>::_findEmpty(uint64_t hash) const
+{
+    uint32_t start = (uint32_t) hash & this->_mask;
+
+    while (true)
+    {
+        uint32_t empty = ControlGroup(this->_control + start).matchEmpty();
+
+        if (empty != 0)
+        {
+            return (start + countTrailingZeros(empty)) & this->_mask;
+        }
+
+        start = (start + ControlGroup::SIZE) & this->_mask;
+    }
+}
+
+/**
+ * Restituisce il bucket che contiene key. Se key non esiste, la inserisce con il
+ * valore di default di Value, raddoppiando prima la tabella se necessario.
+ *
+ * @tparam Key: Tipo di dato della chiave
+ * @tparam Value: Tipo di dato del valore associato alla chiave
+ * @tparam Hash: Funzione hash
+ * @param key : Chiave da cercare o inserire
+ * @param hash : Hashcode della chiave
+ * @return Bucket della chiave
+ */
+template <class Key, class Value, class Hash>
+uint32_t FlatDictionary<Key, Value, Hash>::_place(const Key& key, uint64_t hash)
+{
+    uint32_t bucket = this->_find(key, hash);
+
+    if (bucket != _NOT_FOUND)
+    {
+        return bucket;
+    }
+
+    if ((uint64_t) (this->_pairsAmount + 1) * 4 > (uint64_t) this->_size * 3)
+    {
+        this->_resize();
+    }
+
+    // La chiave non esiste, quindi va nel primo bucket vuoto a partire da quello di partenza
+    bucket = this->_findEmpty(hash);
+
+    this->_setControl(bucket, _fragment(hash));
+    this->_entries[bucket].key = key;
+    this->_pairsAmount++;
+
+    return bucket;
+}
+
+#endif // _FLATDICTIONARY_H
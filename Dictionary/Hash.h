@@ -0,0 +1,105 @@
+#ifndef _HASH_H
+#define _HASH_H
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+/**
+ * Mescola i bit di un valore a 64 bit (finalizzatore di SplitMix64).
+ *
+ * Ogni bit dell'ingresso influenza tutti i bit dell'uscita, quindi anche chiavi
+ * consecutive come 0, 1, 2, ... producono hashcode ben distribuiti nei bit bassi,
+ * che sono quelli usati per scegliere il bucket in una tabella con capacita'
+ * potenza di due.
+ *
+ * @param value : Valore da mescolare
+ * @return Hashcode a 64 bit
+ */
+inline uint64_t hashMix(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+
+    return value;
+}
+
+/**
+ * Calcola l'hashcode di una sequenza di byte con la funzione FNV-1a a 64 bit,
+ * mescolando poi il risultato con hashMix.
+ *
+ * @param data : Byte da cui calcolare l'hash
+ * @param length : Numero di byte
+ * @return Hashcode a 64 bit
+ */
+inline uint64_t hashBytes(const void* data, std::size_t length)
+{
+    const unsigned char* bytes = (const unsigned char*) data;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (std::size_t i = 0; i < length; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hashMix(hash);
+}
+
+
+/**
+ * Funzione hash di default usata dalle tabelle hash.
+ *
+ * Per i tipi interi e per ogni tipo supportato da std::hash, il valore di std::hash
+ * viene mescolato con hashMix: std::hash sugli interi e' spesso l'identita' e da
+ * solo concentrerebbe chiavi vicine negli stessi bucket.
+ *
+ * @tparam Key : Tipo della chiave
+ */
+template <class Key>
+class DefaultHash
+{
+    public:
+        uint64_t operator()(const Key& key) const;
+};
+
+/**
+ * Restituisce l'hashcode della chiave
+ *
+ * @tparam Key : Tipo della chiave
+ * @param key : Chiave a cui applicare l'hash
+ * @return Hashcode a 64 bit
+ */
+template <class Key>
+uint64_t DefaultHash<Key>::operator()(const Key& key) const
+{
+    return hashMix((uint64_t) std::hash<Key>()(key));
+}
+
+
+/**
+ * Funzione hash di default per le stringhe: FNV-1a a 64 bit sui caratteri
+ */
+template <>
+class DefaultHash<std::string>
+{
+    public:
+        uint64_t operator()(const std::string& key) const;
+};
+
+/**
+ * Restituisce l'hashcode della stringa
+ *
+ * @param key : Stringa a cui applicare l'hash
+ * @return Hashcode a 64 bit
+ */
+inline uint64_t DefaultHash<std::string>::operator()(const std::string& key) const
+{
+    return hashBytes(key.data(), key.size());
+}
+
+#endif // _HASH_H
@@ -0,0 +1,347 @@
+#ifndef _ASTAR_H
+#define _ASTAR_H
+
+#include "Graph.h"
+#include "Dijkstra.h"
+#include "ShortestPath.h"
+#include "ShortestPathTree.h"
+#include "../PriorityQueue/IndexedPriorityQueue.h"
+
+#include <cmath>
+#include <vector>
+
+/**
+ * Euristica nulla: con questa euristica A* si comporta come Dijkstra fermato sulla
+ * destinazione.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class ZeroHeuristic
+{
+    public:
+        TLinkWeight operator()(uint32_t node, uint32_t target) const;
+};
+
+/**
+ * Restituisce sempre zero
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @param target : Id della destinazione
+ * @return Zero
+ */
+template <class TLinkWeight>
+TLinkWeight ZeroHeuristic<TLinkWeight>::operator()(uint32_t node, uint32_t target) const
+{
+    return TLinkWeight();
+}
+
+
+/**
+ * Coordinate di un punto nel piano, utilizzabili come etichetta dei nodi per EuclideanHeuristic
+ */
+class GraphPoint
+{
+    public:
+        double x; // Ascissa
+        double y; // Ordinata
+};
+
+
+/**
+ * Euristica che stima la distanza fra due nodi con la distanza euclidea fra le loro
+ * etichette, che devono avere i campi x e y (ad esempio GraphPoint).
+ *
+ * L'euristica e' ammissibile se ogni arco pesa almeno scale volte la distanza euclidea
+ * fra i suoi estremi. Con pesi interi la stima viene troncata, restando per difetto.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+class EuclideanHeuristic
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+
+    private:
+        const TGraph& _graph; // Grafo da cui leggere le coordinate
+        double _scale; // Peso minimo di un arco per unita' di distanza
+
+    public:
+        EuclideanHeuristic(const TGraph& graph);
+        EuclideanHeuristic(const TGraph& graph, double scale);
+
+        LinkWeight operator()(uint32_t node, uint32_t target) const;
+};
+
+/**
+ * Crea un'euristica con fattore di scala unitario. Il grafo deve sopravvivere all'euristica.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo da cui leggere le coordinate
+ */
+template <class TGraph>
+EuclideanHeuristic<TGraph>::EuclideanHeuristic(const TGraph& graph) : EuclideanHeuristic(graph, 1.0) { }
+
+/**
+ * Crea un'euristica che moltiplica la distanza euclidea per scale
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo da cui leggere le coordinate
+ * @param scale : Peso minimo di un arco per unita' di distanza
+ */
+template <class TGraph>
+EuclideanHeuristic<TGraph>::EuclideanHeuristic(const TGraph& graph, double scale) : _graph(graph)
+{
+    this->_scale = scale;
+}
+
+/**
+ * Stima il costo del cammino minimo da node a target
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Id del nodo
+ * @param target : Id della destinazione
+ * @return Stima per difetto del costo del cammino
+ */
+template <class TGraph>
+typename EuclideanHeuristic<TGraph>::LinkWeight EuclideanHeuristic<TGraph>::operator()(uint32_t node, uint32_t target) const
+{
+    auto from = this->_graph.getLabel(GraphNode(node));
+    auto to = this->_graph.getLabel(GraphNode(target));
+
+    double dx = from.x - to.x;
+    double dy = from.y - to.y;
+
+    return (LinkWeight) (this->_scale * std::sqrt(dx * dx + dy * dy));
+}
+
+
+/**
+ * Motore per la ricerca del cammino minimo fra due nodi con l'algoritmo A*.
+ *
+ * E' l'algoritmo di Dijkstra in cui i nodi vengono estratti in ordine di distanza dalla
+ * sorgente piu' la stima dell'euristica verso la destinazione: i nodi che si allontanano
+ * dalla destinazione vengono rimandati e la ricerca si ferma appena la destinazione viene
+ * estratta dalla coda. L'euristica deve essere ammissibile, cioe' non deve mai sovrastimare
+ * la distanza dalla destinazione; se non e' anche consistente un nodo gia' estratto puo'
+ * essere riaperto quando si trova un cammino piu' corto verso di lui.
+ *
+ * Come Dijkstra, il motore conserva le sue strutture fra una chiamata e l'altra e ripristina
+ * solo i nodi toccati dall'esecuzione precedente.
+ *
+ * @tparam TGraph : Tipo del grafo su cui eseguire l'algoritmo
+ * @tparam THeuristic : Tipo dell'euristica, con operator()(nodo, destinazione)
+ */
+template <class TGraph, class THeuristic>
+class AStar
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+        typedef ShortestPath<LinkWeight> Path;
+        typedef ShortestPathTree<LinkWeight> Tree;
+        typedef IndexedPriorityQueue< DijkstraEntry<LinkWeight> > Queue;
+        typedef typename Queue::Handle Handle;
+
+    private:
+        const TGraph& _graph; // Grafo su cui calcolare i cammini
+        THeuristic _heuristic; // Stima della distanza dalla destinazione
+        Tree _tree; // Distanze dalla sorgente e padri dei nodi toccati
+        Queue _queue; // Nodi aperti, ordinati per distanza piu' stima
+        std::vector<Handle> _handles; // Handle nella coda di ogni nodo
+        std::vector<uint32_t> _touched; // Nodi a cui e' stata assegnata una distanza nell'ultima esecuzione
+        Path _path; // Cammino trovato nell'ultima esecuzione
+        uint32_t _settledAmount; // Numero di nodi estratti dalla coda nell'ultima esecuzione
+
+    private:
+        void _prepare();
+
+    public:
+        AStar(const TGraph& graph, const THeuristic& heuristic);
+
+        const Path& run(const GraphNode& source, const GraphNode& target);
+
+        const Path& getPath() const;
+        uint32_t getSettledAmount() const;
+};
+
+
+/**
+ * Crea un motore A* sul grafo dato. Il grafo deve sopravvivere al motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @tparam THeuristic : Tipo dell'euristica
+ * @param graph : Grafo su cui calcolare i cammini minimi
+ * @param heuristic : Euristica ammissibile verso la destinazione
+ */
+template <class TGraph, class THeuristic>
+AStar<TGraph, THeuristic>::AStar(const TGraph& graph, const THeuristic& heuristic) : _graph(graph), _heuristic(heuristic)
+{
+    this->_settledAmount = 0;
+}
+
+/**
+ * Calcola il cammino minimo da source a target
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @tparam THeuristic : Tipo dell'euristica
+ * @param source : Nodo sorgente
+ * @param target : Nodo di arrivo
+ * @return Cammino minimo, non trovato se target non e' raggiungibile; valido fino alla prossima esecuzione
+ */
+template <class TGraph, class THeuristic>
+const typename AStar<TGraph, THeuristic>::Path& AStar<TGraph, THeuristic>::run(const GraphNode& source, const GraphNode& target)
+{
+    this->_prepare();
+
+    if (!this->_graph.isNodeEnabled(source) || !this->_graph.isNodeEnabled(target))
+    {
+        return this->_path;
+    }
+
+    uint32_t s = source.getId();
+    uint32_t t = target.getId();
+    DijkstraEntry<LinkWeight> entry;
+
+    this->_tree.setSource(s);
+    this->_tree.setDistance(s, LinkWeight(), Tree::NO_PARENT);
+    this->_touched.push_back(s);
+
+    entry.distance = this->_heuristic(s, t);
+    entry.node = s;
+    this->_handles[s] = this->_queue.push(entry);
+
+    while (!this->_queue.isEmpty())
+    {
+        uint32_t u = this->_queue.min().node;
+
+        this->_queue.deleteMin();
+        this->_handles[u] = Queue::NULL_HANDLE;
+        this->_tree.settle(u);
+        this->_settledAmount++;
+
+        if (u == t)
+        {
+            break;
+        }
+
+        LinkWeight distanceU = this->_tree.getTentativeDistance(u);
+
+        for (auto link : this->_graph.getOutLinks(GraphNode(u)))
+        {
+            uint32_t v = link.id;
+            LinkWeight candidate = distanceU + link.weight;
+            LinkWeight current = this->_tree.getTentativeDistance(v);
+
+            if (!(candidate < current))
+            {
+                continue;
+            }
+
+            if (current == Tree::infinity())
+            {
+                this->_touched.push_back(v);
+            }
+
+            // Un nodo gia' estratto con un cammino piu' lungo viene riaperto
+            else if (this->_tree.isReachable(v))
+            {
+                this->_tree.reset(v);
+            }
+
+            this->_tree.setDistance(v, candidate, u);
+
+            entry.distance = candidate + this->_heuristic(v, t);
+            entry.node = v;
+
+            if (this->_handles[v] == Queue::NULL_HANDLE)
+            {
+                this->_handles[v] = this->_queue.push(entry);
+            }
+
+            else
+            {
+                this->_queue.decreaseKey(this->_handles[v], entry);
+            }
+        }
+    }
+
+    if (!this->_tree.isReachable(t))
+    {
+        return this->_path;
+    }
+
+    for (uint32_t current = t; current != Tree::NO_PARENT; current = this->_tree.getTentativeParent(current))
+    {
+        this->_path.append(current);
+    }
+
+    this->_path.reverse(0);
+    this->_path.setCost(this->_tree.getDistance(t));
+
+    return this->_path;
+}
+
+/**
+ * Restituisce il cammino trovato nell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @tparam THeuristic : Tipo dell'euristica
+ * @return Cammino minimo
+ */
+template <class TGraph, class THeuristic>
+const typename AStar<TGraph, THeuristic>::Path& AStar<TGraph, THeuristic>::getPath() const
+{
+    return this->_path;
+}
+
+/**
+ * Restituisce il numero di nodi estratti dalla coda nell'ultima esecuzione, contando
+ * piu' volte i nodi riaperti
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @tparam THeuristic : Tipo dell'euristica
+ * @return Numero di nodi estratti
+ */
+template <class TGraph, class THeuristic>
+uint32_t AStar<TGraph, THeuristic>::getSettledAmount() const
+{
+    return this->_settledAmount;
+}
+
+
+/**
+ * Prepara le strutture di supporto per una nuova esecuzione. Se le dimensioni del grafo
+ * non sono cambiate, vengono ripristinati solo i nodi toccati dall'esecuzione precedente.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @tparam THeuristic : Tipo dell'euristica
+ */
+template <class TGraph, class THeuristic>
+void AStar<TGraph, THeuristic>::_prepare()
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+
+    if (this->_tree.getSize() != size)
+    {
+        this->_tree.resize(size);
+        this->_handles.assign(size, Queue::NULL_HANDLE);
+    }
+
+    else
+    {
+        for (std::size_t i = 0; i < this->_touched.size(); i++)
+        {
+            this->_tree.reset(this->_touched[i]);
+            this->_handles[this->_touched[i]] = Queue::NULL_HANDLE;
+        }
+    }
+
+    this->_touched.clear();
+    this->_queue.clear();
+    this->_path.clear();
+    this->_settledAmount = 0;
+}
+
+#endif // _ASTAR_H
@@ -0,0 +1,327 @@
+#ifndef _BIDIRECTIONALDIJKSTRA_H
+#define _BIDIRECTIONALDIJKSTRA_H
+
+#include "Graph.h"
+#include "Dijkstra.h"
+#include "ShortestPath.h"
+#include "ShortestPathTree.h"
+#include "../PriorityQueue/IndexedPriorityQueue.h"
+
+#include <vector>
+
+/**
+ * Motore per la ricerca del cammino minimo fra due nodi con l'algoritmo di Dijkstra
+ * bidirezionale.
+ *
+ * Due ricerche procedono alternandosi: una in avanti dalla sorgente sugli archi uscenti e
+ * una all'indietro dalla destinazione sugli archi entranti. Ogni volta che un arco collega
+ * un nodo raggiunto da una ricerca con uno raggiunto dall'altra, viene aggiornato il miglior
+ * cammino trovato; le ricerche si fermano quando la somma dei minimi delle due code non e'
+ * inferiore al suo costo. Le due ricerche esplorano circa due palle di raggio meta' della
+ * distanza invece di una sola palla di raggio pieno.
+ *
+ * Come Dijkstra, il motore conserva le sue strutture fra una chiamata e l'altra e ripristina
+ * solo i nodi toccati dall'esecuzione precedente.
+ *
+ * @tparam TGraph : Tipo del grafo su cui eseguire l'algoritmo, con getOutLinks e getInLinks
+ */
+template <class TGraph>
+class BidirectionalDijkstra
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+        typedef ShortestPath<LinkWeight> Path;
+        typedef ShortestPathTree<LinkWeight> Tree;
+        typedef IndexedPriorityQueue< DijkstraEntry<LinkWeight> > Queue;
+        typedef typename Queue::Handle Handle;
+
+    private:
+        static const uint32_t _FORWARD = 0; // Ricerca dalla sorgente
+        static const uint32_t _BACKWARD = 1; // Ricerca dalla destinazione
+
+        const TGraph& _graph; // Grafo su cui calcolare i cammini
+        Tree _trees[2]; // Distanze e padri delle due ricerche
+        Queue _queues[2]; // Nodi da processare delle due ricerche
+        std::vector<Handle> _handles[2]; // Handle nelle code di ogni nodo
+        std::vector<uint32_t> _touched[2]; // Nodi toccati da ciascuna ricerca nell'ultima esecuzione
+        Path _path; // Cammino trovato nell'ultima esecuzione
+        uint32_t _settledAmount; // Numero di nodi etichettati dalle due ricerche nell'ultima esecuzione
+
+    private:
+        void _prepare();
+        template <class TRange>
+        void _step(uint32_t side, const TRange& links, uint32_t u, LinkWeight& best, uint32_t& meetFrom, uint32_t& meetTo);
+        void _buildPath(uint32_t meetFrom, uint32_t meetTo, LinkWeight cost);
+
+    public:
+        BidirectionalDijkstra(const TGraph& graph);
+
+        const Path& run(const GraphNode& source, const GraphNode& target);
+
+        const Path& getPath() const;
+        uint32_t getSettledAmount() const;
+};
+
+template <class TGraph>
+const uint32_t BidirectionalDijkstra<TGraph>::_FORWARD;
+
+template <class TGraph>
+const uint32_t BidirectionalDijkstra<TGraph>::_BACKWARD;
+
+
+/**
+ * Crea un motore di Dijkstra bidirezionale sul grafo dato. Il grafo deve sopravvivere al motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo su cui calcolare i cammini minimi
+ */
+template <class TGraph>
+BidirectionalDijkstra<TGraph>::BidirectionalDijkstra(const TGraph& graph) : _graph(graph)
+{
+    this->_settledAmount = 0;
+}
+
+/**
+ * Calcola il cammino minimo da source a target
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param source : Nodo sorgente
+ * @param target : Nodo di arrivo
+ * @return Cammino minimo, non trovato se target non e' raggiungibile; valido fino alla prossima esecuzione
+ */
+template <class TGraph>
+const typename BidirectionalDijkstra<TGraph>::Path& BidirectionalDijkstra<TGraph>::run(const GraphNode& source, const GraphNode& target)
+{
+    this->_prepare();
+
+    if (!this->_graph.isNodeEnabled(source) || !this->_graph.isNodeEnabled(target))
+    {
+        return this->_path;
+    }
+
+    uint32_t ends[2] = { source.getId(), target.getId() };
+    DijkstraEntry<LinkWeight> entry;
+
+    for (uint32_t side = _FORWARD; side <= _BACKWARD; side++)
+    {
+        this->_trees[side].setSource(ends[side]);
+        this->_trees[side].setDistance(ends[side], LinkWeight(), Tree::NO_PARENT);
+        this->_touched[side].push_back(ends[side]);
+
+        entry.distance = LinkWeight();
+        entry.node = ends[side];
+        this->_handles[side][ends[side]] = this->_queues[side].push(entry);
+    }
+
+    LinkWeight best = Tree::infinity(); // Costo del miglior cammino trovato
+    uint32_t meetFrom = Tree::NO_PARENT; // Ultimo nodo della ricerca in avanti sul miglior cammino
+    uint32_t meetTo = Tree::NO_PARENT; // Primo nodo della ricerca all'indietro sul miglior cammino
+
+    if (ends[_FORWARD] == ends[_BACKWARD])
+    {
+        best = LinkWeight();
+        meetFrom = ends[_FORWARD];
+        meetTo = ends[_BACKWARD];
+    }
+
+    // Quando una coda si svuota, tutti i cammini passanti per quella ricerca sono gia' stati visti
+    while (!this->_queues[_FORWARD].isEmpty() && !this->_queues[_BACKWARD].isEmpty())
+    {
+        LinkWeight forwardMin = this->_queues[_FORWARD].min().distance;
+        LinkWeight backwardMin = this->_queues[_BACKWARD].min().distance;
+
+        // Nessun cammino non ancora visto puo' costare meno di forwardMin + backwardMin
+        if (best != Tree::infinity() && !(forwardMin + backwardMin < best))
+        {
+            break;
+        }
+
+        // Avanza la ricerca con la frontiera piu' vicina
+        if (!(backwardMin < forwardMin))
+        {
+            uint32_t u = this->_queues[_FORWARD].min().node;
+            this->_step(_FORWARD, this->_graph.getOutLinks(GraphNode(u)), u, best, meetFrom, meetTo);
+        }
+
+        else
+        {
+            uint32_t u = this->_queues[_BACKWARD].min().node;
+            this->_step(_BACKWARD, this->_graph.getInLinks(GraphNode(u)), u, best, meetFrom, meetTo);
+        }
+    }
+
+    if (best != Tree::infinity())
+    {
+        this->_buildPath(meetFrom, meetTo, best);
+    }
+
+    return this->_path;
+}
+
+/**
+ * Restituisce il cammino trovato nell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Cammino minimo
+ */
+template <class TGraph>
+const typename BidirectionalDijkstra<TGraph>::Path& BidirectionalDijkstra<TGraph>::getPath() const
+{
+    return this->_path;
+}
+
+/**
+ * Restituisce il numero di nodi etichettati dalle due ricerche nell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di nodi etichettati
+ */
+template <class TGraph>
+uint32_t BidirectionalDijkstra<TGraph>::getSettledAmount() const
+{
+    return this->_settledAmount;
+}
+
+
+/**
+ * Prepara le strutture di supporto per una nuova esecuzione. Se le dimensioni del grafo
+ * non sono cambiate, vengono ripristinati solo i nodi toccati dall'esecuzione precedente.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void BidirectionalDijkstra<TGraph>::_prepare()
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+
+    for (uint32_t side = _FORWARD; side <= _BACKWARD; side++)
+    {
+        if (this->_trees[side].getSize() != size)
+        {
+            this->_trees[side].resize(size);
+            this->_handles[side].assign(size, Queue::NULL_HANDLE);
+        }
+
+        else
+        {
+            for (std::size_t i = 0; i < this->_touched[side].size(); i++)
+            {
+                this->_trees[side].reset(this->_touched[side][i]);
+                this->_handles[side][this->_touched[side][i]] = Queue::NULL_HANDLE;
+            }
+        }
+
+        this->_touched[side].clear();
+        this->_queues[side].clear();
+    }
+
+    this->_path.clear();
+    this->_settledAmount = 0;
+}
+
+/**
+ * Estrae il nodo u dalla coda di una ricerca e ne rilassa gli archi. Se l'altro estremo
+ * di un arco e' gia' stato raggiunto dall'altra ricerca, aggiorna il miglior cammino.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @tparam TRange : Tipo dell'intervallo di archi (uscenti in avanti, entranti all'indietro)
+ * @param side : Ricerca da far avanzare
+ * @param links : Archi da rilassare
+ * @param u : Nodo in testa alla coda della ricerca
+ * @param best : Costo del miglior cammino trovato
+ * @param meetFrom : Ultimo nodo della ricerca in avanti sul miglior cammino
+ * @param meetTo : Primo nodo della ricerca all'indietro sul miglior cammino
+ */
+template <class TGraph>
+template <class TRange>
+void BidirectionalDijkstra<TGraph>::_step(uint32_t side, const TRange& links, uint32_t u, LinkWeight& best, uint32_t& meetFrom, uint32_t& meetTo)
+{
+    Tree& tree = this->_trees[side];
+    const Tree& other = this->_trees[1 - side];
+    Queue& queue = this->_queues[side];
+    DijkstraEntry<LinkWeight> entry;
+
+    LinkWeight distanceU = queue.min().distance;
+
+    queue.deleteMin();
+    this->_handles[side][u] = Queue::NULL_HANDLE;
+    tree.settle(u);
+    this->_settledAmount++;
+
+    for (auto link : links)
+    {
+        uint32_t v = link.id;
+        LinkWeight candidate = distanceU + link.weight;
+        LinkWeight otherDistance = other.getTentativeDistance(v);
+
+        if (otherDistance != Tree::infinity() && candidate + otherDistance < best)
+        {
+            best = candidate + otherDistance;
+            meetFrom = (side == _FORWARD) ? u : v;
+            meetTo = (side == _FORWARD) ? v : u;
+        }
+
+        if (tree.isReachable(v))
+        {
+            continue;
+        }
+
+        LinkWeight current = tree.getTentativeDistance(v);
+
+        if (candidate < current)
+        {
+            if (current == Tree::infinity())
+            {
+                this->_touched[side].push_back(v);
+            }
+
+            tree.setDistance(v, candidate, u);
+
+            entry.distance = candidate;
+            entry.node = v;
+
+            if (this->_handles[side][v] == Queue::NULL_HANDLE)
+            {
+                this->_handles[side][v] = queue.push(entry);
+            }
+
+            else
+            {
+                queue.decreaseKey(this->_handles[side][v], entry);
+            }
+        }
+    }
+}
+
+/**
+ * Ricostruisce il cammino: dalla sorgente a meetFrom con i padri della ricerca in avanti,
+ * poi da meetTo alla destinazione con i padri della ricerca all'indietro.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param meetFrom : Ultimo nodo della ricerca in avanti sul cammino
+ * @param meetTo : Primo nodo della ricerca all'indietro sul cammino
+ * @param cost : Costo del cammino
+ */
+template <class TGraph>
+void BidirectionalDijkstra<TGraph>::_buildPath(uint32_t meetFrom, uint32_t meetTo, LinkWeight cost)
+{
+    for (uint32_t current = meetFrom; current != Tree::NO_PARENT; current = this->_trees[_FORWARD].getTentativeParent(current))
+    {
+        this->_path.append(current);
+    }
+
+    this->_path.reverse(0);
+
+    // Se sorgente e destinazione coincidono, il cammino e' il solo nodo di partenza
+    if (meetTo != meetFrom)
+    {
+        for (uint32_t current = meetTo; current != Tree::NO_PARENT; current = this->_trees[_BACKWARD].getTentativeParent(current))
+        {
+            this->_path.append(current);
+        }
+    }
+
+    this->_path.setCost(cost);
+}
+
+#endif // _BIDIRECTIONALDIJKSTRA_H
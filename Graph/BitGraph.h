@@ -0,0 +1,955 @@
+#ifndef _BITGRAPH_H
+#define _BITGRAPH_H
+
+#include "Graph.h"
+#include "../Lib/BitSet.h"
+#include "../Lib/BitIntersection.h"
+#include "../Lib/Bits.h"
+
+#include <iostream>
+#include <vector>
+
+/**
+ * Iteratore sugli archi uscenti di un nodo di un BitGraph: scorre la riga della matrice
+ * di adiacenza una parola a 64 bit alla volta, salta le parole nulle e trova il prossimo
+ * arco con countTrailingZeros. Tutti gli archi hanno peso 1.
+ */
+class BitRowIterator
+{
+    private:
+        const uint64_t* _words; // Parole della riga
+        uint32_t _wordIndex; // Parola corrente
+        uint32_t _wordAmount; // Numero di parole della riga
+        uint64_t _word; // Bit della parola corrente non ancora visitati
+
+    private:
+        void _skipEmpty();
+
+    public:
+        BitRowIterator(const uint64_t* words, uint32_t wordIndex, uint32_t wordAmount);
+
+        GraphNeighbour<uint32_t> operator*() const;
+        BitRowIterator& operator++();
+        bool operator!=(const BitRowIterator& it) const;
+};
+
+
+/**
+ * Iteratore sugli archi entranti in un nodo di un BitGraph: scorre la colonna della
+ * matrice di adiacenza controllando un bit per riga, quindi costa O(V).
+ * Tutti gli archi hanno peso 1.
+ */
+class BitColumnIterator
+{
+    private:
+        const uint64_t* _matrix; // Matrice di adiacenza
+        uint32_t _wordsPerRow; // Parole di ogni riga
+        uint32_t _column; // Nodo di arrivo degli archi
+        uint32_t _row; // Riga corrente
+        uint32_t _size; // Numero di righe
+
+    private:
+        bool _hasLink() const;
+
+    public:
+        BitColumnIterator(const uint64_t* matrix, uint32_t wordsPerRow, uint32_t column, uint32_t row, uint32_t size);
+
+        GraphNeighbour<uint32_t> operator*() const;
+        BitColumnIterator& operator++();
+        bool operator!=(const BitColumnIterator& it) const;
+};
+
+
+/**
+ * Grafo orientato non pesato rappresentato da una matrice di adiacenza di bit: ogni
+ * arco occupa un solo bit e ogni riga e' un vettore di parole a 64 bit. Un grafo con
+ * 50000 nodi occupa circa 300 MB, contro le decine di GB delle celle LinkInfo del Graph.
+ *
+ * isLinkActive() legge un bit; il grado uscente e la scansione dei vicini usano popCount
+ * e countTrailingZeros parola per parola. L'intersezione fra due insiemi di vicini e'
+ * un AND fra due righe seguito dal conteggio dei bit (intersectionCount, con AVX2 se
+ * disponibile): su questa operazione si basano countCommonNeighbours() e countTriangles().
+ *
+ * Gli archi non hanno peso: addLink() ignora il peso ricevuto, getWeight() e gli iteratori
+ * restituiscono sempre 1, cosi' che il grafo si possa usare con gli algoritmi sui grafi pesati.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ */
+template <class TNodeLabel>
+class BitGraph : public IGraph<GraphNode, TNodeLabel, Link<GraphNode>, uint32_t>
+{
+    public:
+        typedef ::Link<GraphNode> Link;
+        typedef LinkedList<uint32_t> GraphNodeList;
+        typedef TNodeLabel NodeLabel;
+        typedef uint32_t LinkWeight;
+        typedef LinkRange<BitRowIterator> OutLinkRange;
+        typedef LinkRange<BitColumnIterator> InLinkRange;
+
+    private:
+        uint32_t _gSize; // Numero massimo di nodi inseribili nel grafo
+        uint32_t _wordsPerRow; // Parole a 64 bit di ogni riga della matrice
+        uint32_t _nodeAmount; // Numero di nodi presenti attualmente nel grafo
+        uint32_t _linkAmount; // Numero di archi presenti attualmente nel grafo
+
+        BitSet _enabled; // Nodi attivi
+        std::vector<TNodeLabel> _labels; // Etichetta di ogni nodo
+        std::vector<uint64_t> _matrix; // Matrice di adiacenza, una riga di _wordsPerRow parole per nodo
+
+    private:
+        const uint64_t* _row(uint32_t id) const;
+        uint64_t* _row(uint32_t id);
+
+    public:
+        BitGraph(uint32_t size);
+
+        uint32_t getNodeAmount() const;
+        uint32_t getLinkAmount() const;
+        uint32_t getMaxNodeAmount() const;
+
+        void create();
+
+        bool isEmpty() const;
+        bool isNodeEnabled(const GraphNode& node) const;
+        bool isLinkActive(const GraphNode& from, const GraphNode& to) const;
+
+        TNodeLabel getLabel(const GraphNode& node) const;
+        uint32_t getWeight(const GraphNode& from, const GraphNode& to) const;
+
+        void addNode(GraphNode& node, TNodeLabel label);
+        void addNode(GraphNode& node);
+        void addLink(GraphNode& from, GraphNode& to, uint32_t weight);
+        void addLink(GraphNode& from, GraphNode& to);
+
+        void eraseNode(GraphNode& node);
+        void eraseLink(GraphNode& from, GraphNode& to);
+
+        void setLabel(GraphNode& node, TNodeLabel label);
+        void setWeight(GraphNode& from, GraphNode& to, uint32_t weight);
+
+        GraphNodeList getAdjacentToANode(const GraphNode& node) const;
+        GraphNodeList getAdjacentFromANode(const GraphNode& node) const;
+
+        OutLinkRange getOutLinks(const GraphNode& node) const;
+        InLinkRange getInLinks(const GraphNode& node) const;
+
+        uint32_t getDegreeTo(const GraphNode& node) const;
+        uint32_t getDegreeFrom(const GraphNode& node) const;
+
+        GraphNodeList getAdjacentNode(const GraphNode& node) const;
+        GraphNodeList getAllNodes() const;
+
+        uint32_t countCommonNeighbours(const GraphNode& first, const GraphNode& second) const;
+        GraphNodeList getCommonNeighbours(const GraphNode& first, const GraphNode& second) const;
+        uint64_t countTriangles() const;
+
+        template <class TypeNodeLabel>
+        friend std::ostream& operator<<(std::ostream&, const BitGraph<TypeNodeLabel>& graph);
+};
+
+
+/**
+ * Crea un iteratore che parte dalla parola wordIndex della riga e si posiziona sul
+ * primo arco presente
+ *
+ * @param words : Parole della riga
+ * @param wordIndex : Parola da cui iniziare
+ * @param wordAmount : Numero di parole della riga
+ */
+inline BitRowIterator::BitRowIterator(const uint64_t* words, uint32_t wordIndex, uint32_t wordAmount)
+{
+    this->_words = words;
+    this->_wordIndex = wordIndex;
+    this->_wordAmount = wordAmount;
+    this->_word = (wordIndex < wordAmount) ? words[wordIndex] : 0;
+
+    this->_skipEmpty();
+}
+
+/**
+ * Restituisce l'arco corrente
+ *
+ * @return Vicino e peso dell'arco
+ */
+inline GraphNeighbour<uint32_t> BitRowIterator::operator*() const
+{
+    GraphNeighbour<uint32_t> neighbour;
+
+    neighbour.id = this->_wordIndex * BitSet::WORD_BITS + countTrailingZeros(this->_word);
+    neighbour.weight = 1;
+
+    return neighbour;
+}
+
+/**
+ * Avanza all'arco successivo
+ *
+ * @return Iteratore aggiornato
+ */
+inline BitRowIterator& BitRowIterator::operator++()
+{
+    this->_word &= this->_word - 1; // Tolgo il bit appena visitato
+    this->_skipEmpty();
+
+    return *this;
+}
+
+/**
+ * Restituisce true se i due iteratori puntano ad archi diversi
+ *
+ * @param it : Iteratore da confrontare
+ * @return True se gli iteratori sono diversi, altrimenti false
+ */
+inline bool BitRowIterator::operator!=(const BitRowIterator& it) const
+{
+    return (this->_wordIndex != it._wordIndex || this->_word != it._word);
+}
+
+/**
+ * Salta le parole senza archi; a fine riga l'iteratore ha _wordIndex uguale a _wordAmount
+ */
+inline void BitRowIterator::_skipEmpty()
+{
+    while (this->_word == 0 && this->_wordIndex < this->_wordAmount)
+    {
+        this->_wordIndex++;
+
+        if (this->_wordIndex < this->_wordAmount)
+        {
+            this->_word = this->_words[this->_wordIndex];
+        }
+    }
+}
+
+
+/**
+ * Crea un iteratore sulla colonna column che si posiziona sul primo arco a partire dalla riga row
+ *
+ * @param matrix : Matrice di adiacenza
+ * @param wordsPerRow : Parole di ogni riga
+ * @param column : Nodo di arrivo degli archi
+ * @param row : Riga da cui iniziare
+ * @param size : Numero di righe
+ */
+inline BitColumnIterator::BitColumnIterator(const uint64_t* matrix, uint32_t wordsPerRow, uint32_t column, uint32_t row, uint32_t size)
+{
+    this->_matrix = matrix;
+    this->_wordsPerRow = wordsPerRow;
+    this->_column = column;
+    this->_row = row;
+    this->_size = size;
+
+    while (this->_row < this->_size && !this->_hasLink())
+    {
+        this->_row++;
+    }
+}
+
+/**
+ * Restituisce l'arco corrente
+ *
+ * @return Vicino e peso dell'arco
+ */
+inline GraphNeighbour<uint32_t> BitColumnIterator::operator*() const
+{
+    GraphNeighbour<uint32_t> neighbour;
+
+    neighbour.id = this->_row;
+    neighbour.weight = 1;
+
+    return neighbour;
+}
+
+/**
+ * Avanza all'arco successivo
+ *
+ * @return Iteratore aggiornato
+ */
+inline BitColumnIterator& BitColumnIterator::operator++()
+{
+    do
+    {
+        this->_row++;
+    } while (this->_row < this->_size && !this->_hasLink());
+
+    return *this;
+}
+
+/**
+ * Restituisce true se i due iteratori puntano ad archi diversi
+ *
+ * @param it : Iteratore da confrontare
+ * @return True se gli iteratori sono diversi, altrimenti false
+ */
+inline bool BitColumnIterator::operator!=(const BitColumnIterator& it) const
+{
+    return (this->_row != it._row);
+}
+
+/**
+ * Restituisce true se la riga corrente ha un arco verso la colonna
+ *
+ * @return True se l'arco esiste, altrimenti false
+ */
+inline bool BitColumnIterator::_hasLink() const
+{
+    uint64_t word = this->_matrix[(uint64_t) this->_row * this->_wordsPerRow + this->_column / BitSet::WORD_BITS];
+    return (word >> (this->_column % BitSet::WORD_BITS)) & 1ULL;
+}
+
+
+/**
+ * Crea un grafo vuoto che puo' contenere al piu' size nodi.
+ * La matrice di adiacenza occupa size * size bit.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param size : Numero massimo di nodi
+ */
+template <class TNodeLabel>
+BitGraph<TNodeLabel>::BitGraph(uint32_t size) : _enabled(size), _labels(size)
+{
+    this->_gSize = size;
+    this->_wordsPerRow = (size + BitSet::WORD_BITS - 1) / BitSet::WORD_BITS;
+    this->_nodeAmount = 0;
+    this->_linkAmount = 0;
+
+    this->_matrix.assign((std::size_t) size * this->_wordsPerRow, 0);
+}
+
+/**
+ * Restituisce il numero di nodi presenti nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @return Numero di nodi
+ */
+template <class TNodeLabel>
+uint32_t BitGraph<TNodeLabel>::getNodeAmount() const
+{
+    return this->_nodeAmount;
+}
+
+/**
+ * Restituisce il numero di archi presenti nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @return Numero di archi
+ */
+template <class TNodeLabel>
+uint32_t BitGraph<TNodeLabel>::getLinkAmount() const
+{
+    return this->_linkAmount;
+}
+
+/**
+ * Restituisce il numero massimo di nodi inseribili nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @return Numero massimo di nodi
+ */
+template <class TNodeLabel>
+uint32_t BitGraph<TNodeLabel>::getMaxNodeAmount() const
+{
+    return this->_gSize;
+}
+
+/**
+ * Non fa nulla: il grafo e' gia' pronto dopo la costruzione
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ */
+template <class TNodeLabel>
+void BitGraph<TNodeLabel>::create() { }
+
+/**
+ * Restituisce true se il grafo e' vuoto, altrimenti false.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @return True se il grafo e' vuoto, altrimenti false.
+ */
+template <class TNodeLabel>
+bool BitGraph<TNodeLabel>::isEmpty() const
+{
+    return (this->_nodeAmount == 0);
+}
+
+/**
+ * Restituisce true se il nodo e' attivo, altrimenti false.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo da controllare
+ * @return True se il nodo e' attivo, altrimenti false.
+ */
+template <class TNodeLabel>
+bool BitGraph<TNodeLabel>::isNodeEnabled(const GraphNode& node) const
+{
+    return (node.getId() < this->_gSize && this->_enabled.test(node.getId()));
+}
+
+/**
+ * Restituisce true se l'arco e' attivo, altrimenti false. Legge un solo bit.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param from : Nodo di partenza
+ * @param to: Nodo di arrivo
+ * @return True se l'arco e' attivo, altrimenti false.
+ */
+template <class TNodeLabel>
+bool BitGraph<TNodeLabel>::isLinkActive(const GraphNode& from, const GraphNode& to) const
+{
+    if (!this->isNodeEnabled(from) || !this->isNodeEnabled(to))
+    {
+        return false;
+    }
+
+    uint32_t toId = to.getId();
+
+    return (this->_row(from.getId())[toId / BitSet::WORD_BITS] >> (toId % BitSet::WORD_BITS)) & 1ULL;
+}
+
+/**
+ * Restituisce l'etichetta contenuta nel nodo.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo a cui leggere l'etichetta
+ * @return Etichetta del nodo.
+ */
+template <class TNodeLabel>
+TNodeLabel BitGraph<TNodeLabel>::getLabel(const GraphNode& node) const
+{
+    if (this->isNodeEnabled(node))
+    {
+        return this->_labels[node.getId()];
+    }
+
+    return TNodeLabel();
+}
+
+/**
+ * Restituisce il peso dell'arco: 1 se l'arco esiste, altrimenti 0.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param from: Nodo di partenza
+ * @param to: Nodo di arrivo
+ * @return Peso dell'arco che va da from a to
+ */
+template <class TNodeLabel>
+uint32_t BitGraph<TNodeLabel>::getWeight(const GraphNode& from, const GraphNode& to) const
+{
+    return this->isLinkActive(from, to) ? 1 : 0;
+}
+
+/**
+ * Aggiungo un nodo nel grafo con una sua etichetta, usando il primo id libero.
+ *
+ * Se ho raggiunto il limite massimo di nodi, il nuovo nodo non verra'
+ * inserito nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo da aggiungere
+ * @param label : Etichetta del nodo
+ */
+template <class TNodeLabel>
+void BitGraph<TNodeLabel>::addNode(GraphNode& node, TNodeLabel label)
+{
+    if (this->_nodeAmount >= this->_gSize)
+    {
+        return; // Ho superato il numero massimo di nodi consentiti
+    }
+
+    const uint64_t* words = this->_enabled.getWords();
+
+    for (uint32_t w = 0; w < this->_enabled.getWordAmount(); w++)
+    {
+        if (~words[w] != 0)
+        {
+            // Il primo bit a zero della parola e' il primo id libero
+            uint32_t id = w * BitSet::WORD_BITS + countTrailingZeros(~words[w]);
+
+            node.setId(id);
+            this->_enabled.set(id);
+            this->_labels[id] = label;
+            this->_nodeAmount++;
+
+            break;
+        }
+    }
+}
+
+/**
+ * Aggiungo un nodo nel grafo senza specificare un'etichetta
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo da aggiungere
+ */
+template <class TNodeLabel>
+void BitGraph<TNodeLabel>::addNode(GraphNode& node)
+{
+    this->addNode(node, TNodeLabel());
+}
+
+/**
+ * Aggiunge un arco che va da from a to. Il grafo non e' pesato: weight viene ignorato.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @param weight : Peso dell'arco, ignorato
+ */
+template <class TNodeLabel>
+void BitGraph<TNodeLabel>::addLink(GraphNode& from, GraphNode& to, uint32_t weight)
+{
+    this->addLink(from, to);
+}
+
+/**
+ * Aggiunge un arco che va da from a to. Se l'arco esiste gia', il grafo non cambia.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ */
+template <class TNodeLabel>
+void BitGraph<TNodeLabel>::addLink(GraphNode& from, GraphNode& to)
+{
+    if (!this->isNodeEnabled(from) || !this->isNodeEnabled(to))
+    {
+        return;
+    }
+
+    uint32_t toId = to.getId();
+    uint64_t& word = this->_row(from.getId())[toId / BitSet::WORD_BITS];
+    uint64_t bit = 1ULL << (toId % BitSet::WORD_BITS);
+
+    if ((word & bit) == 0)
+    {
+        word |= bit;
+        this->_linkAmount++;
+    }
+}
+
+/**
+ * Elimina un nodo dal grafo insieme ai suoi archi entranti e uscenti
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo da cancellare
+ */
+template <class TNodeLabel>
+void BitGraph<TNodeLabel>::eraseNode(GraphNode& node)
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return;
+    }
+
+    uint32_t id = node.getId();
+    uint32_t wordIndex = id / BitSet::WORD_BITS;
+    uint64_t bit = 1ULL << (id % BitSet::WORD_BITS);
+
+    // Elimino gli archi entranti, compreso l'eventuale cappio
+    for (uint32_t i = this->_enabled.nextSet(0); i < this->_gSize; i = this->_enabled.nextSet(i + 1))
+    {
+        uint64_t& word = this->_row(i)[wordIndex];
+
+        if (word & bit)
+        {
+            word &= ~bit;
+            this->_linkAmount--;
+        }
+    }
+
+    // Elimino gli archi uscenti
+    uint64_t* row = this->_row(id);
+
+    for (uint32_t w = 0; w < this->_wordsPerRow; w++)
+    {
+        this->_linkAmount -= popCount(row[w]);
+        row[w] = 0;
+    }
+
+    this->_enabled.reset(id);
+    this->_labels[id] = TNodeLabel();
+    this->_nodeAmount--;
+}
+
+/**
+ * Cancella un arco che va da from a to.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ */
+template <class TNodeLabel>
+void BitGraph<TNodeLabel>::eraseLink(GraphNode& from, GraphNode& to)
+{
+    if (!this->isLinkActive(from, to))
+    {
+        return;
+    }
+
+    uint32_t toId = to.getId();
+
+    this->_row(from.getId())[toId / BitSet::WORD_BITS] &= ~(1ULL << (toId % BitSet::WORD_BITS));
+    this->_linkAmount--;
+}
+
+/**
+ * Imposta un'etichetta ad un nodo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo a cui aggiungere un'etichetta
+ * @param label : Etichetta da aggiungere
+ */
+template <class TNodeLabel>
+void BitGraph<TNodeLabel>::setLabel(GraphNode& node, TNodeLabel label)
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return;
+    }
+
+    this->_labels[node.getId()] = label;
+}
+
+/**
+ * Non fa nulla: gli archi del grafo hanno sempre peso 1
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @param weight : Peso dell'arco, ignorato
+ */
+template <class TNodeLabel>
+void BitGraph<TNodeLabel>::setWeight(GraphNode& from, GraphNode& to, uint32_t weight) { }
+
+/**
+ * Restituisce una lista di id di nodi che sono puntati da node.
+ * Se node non esiste, allora restituisce una lista vuota.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo da cui ricavare la lista
+ * @return Lista di id di nodi che sono puntati da node
+ */
+template <class TNodeLabel>
+typename BitGraph<TNodeLabel>::GraphNodeList BitGraph<TNodeLabel>::getAdjacentToANode(const GraphNode& node) const
+{
+    GraphNodeList nodes;
+
+    for (auto link : this->getOutLinks(node))
+    {
+        nodes.append(link.id);
+    }
+
+    return nodes;
+}
+
+/**
+ * Restituisce una lista di id di nodi che puntano a node.
+ * Se node non esiste, allora restituisce una lista vuota.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo da cui ricavare la lista
+ * @return Lista di id di nodi che puntano a node
+ */
+template <class TNodeLabel>
+typename BitGraph<TNodeLabel>::GraphNodeList BitGraph<TNodeLabel>::getAdjacentFromANode(const GraphNode& node) const
+{
+    GraphNodeList nodes;
+
+    for (auto link : this->getInLinks(node))
+    {
+        nodes.append(link.id);
+    }
+
+    return nodes;
+}
+
+/**
+ * Restituisce l'intervallo degli archi uscenti da node, senza allocare memoria.
+ * Se node non esiste, allora l'intervallo e' vuoto.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo di partenza
+ * @return Intervallo degli archi uscenti
+ */
+template <class TNodeLabel>
+typename BitGraph<TNodeLabel>::OutLinkRange BitGraph<TNodeLabel>::getOutLinks(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return OutLinkRange(BitRowIterator(nullptr, 0, 0), BitRowIterator(nullptr, 0, 0));
+    }
+
+    const uint64_t* row = this->_row(node.getId());
+
+    return OutLinkRange(BitRowIterator(row, 0, this->_wordsPerRow),
+                        BitRowIterator(row, this->_wordsPerRow, this->_wordsPerRow));
+}
+
+/**
+ * Restituisce l'intervallo degli archi entranti in node, senza allocare memoria.
+ * La scansione controlla un bit per ogni nodo del grafo.
+ * Se node non esiste, allora l'intervallo e' vuoto.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo di arrivo
+ * @return Intervallo degli archi entranti
+ */
+template <class TNodeLabel>
+typename BitGraph<TNodeLabel>::InLinkRange BitGraph<TNodeLabel>::getInLinks(const GraphNode& node) const
+{
+    uint32_t id = node.getId();
+    uint32_t size = this->isNodeEnabled(node) ? this->_gSize : 0;
+
+    return InLinkRange(BitColumnIterator(this->_matrix.data(), this->_wordsPerRow, id, 0, size),
+                       BitColumnIterator(this->_matrix.data(), this->_wordsPerRow, id, size, size));
+}
+
+/**
+ * Restituisce il numero di archi uscenti dal nodo, contando i bit della sua riga
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo a cui calcolare il numero di archi uscenti
+ * @return numero di archi uscenti dal nodo
+ */
+template <class TNodeLabel>
+uint32_t BitGraph<TNodeLabel>::getDegreeTo(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return 0;
+    }
+
+    const uint64_t* row = this->_row(node.getId());
+    uint32_t degree = 0;
+
+    for (uint32_t w = 0; w < this->_wordsPerRow; w++)
+    {
+        degree += popCount(row[w]);
+    }
+
+    return degree;
+}
+
+/**
+ * Restituisce il numero di archi entranti nel nodo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo a cui calcolare il numero di archi entranti
+ * @return numero di archi entranti nel nodo
+ */
+template <class TNodeLabel>
+uint32_t BitGraph<TNodeLabel>::getDegreeFrom(const GraphNode& node) const
+{
+    uint32_t degree = 0;
+    auto links = this->getInLinks(node);
+
+    for (auto it = links.begin(); it != links.end(); ++it)
+    {
+        degree++;
+    }
+
+    return degree;
+}
+
+/**
+ * Restituisce la lista degli id dei nodi collegati a node da un arco entrante o uscente,
+ * senza ripetizioni
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param node : Nodo di cui trovare i vicini
+ * @return Lista di id dei nodi adiacenti a node
+ */
+template <class TNodeLabel>
+typename BitGraph<TNodeLabel>::GraphNodeList BitGraph<TNodeLabel>::getAdjacentNode(const GraphNode& node) const
+{
+    GraphNodeList adjacentNodes;
+
+    for (auto link : this->getOutLinks(node))
+    {
+        adjacentNodes.append(link.id);
+    }
+
+    // Aggiungo i nodi entranti che non sono gia' stati inseriti come nodi uscenti
+    for (auto link : this->getInLinks(node))
+    {
+        if (!this->isLinkActive(node, GraphNode(link.id)))
+        {
+            adjacentNodes.append(link.id);
+        }
+    }
+
+    return adjacentNodes;
+}
+
+/**
+ * Restituisce una lista contenente gli id di tutti i nodi presenti nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @return Lista di id dei nodi del grafo
+ */
+template <class TNodeLabel>
+typename BitGraph<TNodeLabel>::GraphNodeList BitGraph<TNodeLabel>::getAllNodes() const
+{
+    GraphNodeList nodes;
+
+    for (uint32_t i = this->_enabled.nextSet(0); i < this->_gSize; i = this->_enabled.nextSet(i + 1))
+    {
+        nodes.append(i);
+    }
+
+    return nodes;
+}
+
+/**
+ * Restituisce il numero di nodi puntati sia da first che da second, con un AND fra le
+ * due righe della matrice
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param first : Primo nodo
+ * @param second : Secondo nodo
+ * @return Numero di vicini in comune
+ */
+template <class TNodeLabel>
+uint32_t BitGraph<TNodeLabel>::countCommonNeighbours(const GraphNode& first, const GraphNode& second) const
+{
+    if (!this->isNodeEnabled(first) || !this->isNodeEnabled(second))
+    {
+        return 0;
+    }
+
+    return (uint32_t) intersectionCount(this->_row(first.getId()), this->_row(second.getId()), this->_wordsPerRow);
+}
+
+/**
+ * Restituisce la lista, in ordine crescente di id, dei nodi puntati sia da first che da second
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param first : Primo nodo
+ * @param second : Secondo nodo
+ * @return Lista dei vicini in comune
+ */
+template <class TNodeLabel>
+typename BitGraph<TNodeLabel>::GraphNodeList BitGraph<TNodeLabel>::getCommonNeighbours(const GraphNode& first, const GraphNode& second) const
+{
+    GraphNodeList nodes;
+
+    if (!this->isNodeEnabled(first) || !this->isNodeEnabled(second))
+    {
+        return nodes;
+    }
+
+    const uint64_t* firstRow = this->_row(first.getId());
+    const uint64_t* secondRow = this->_row(second.getId());
+
+    for (uint32_t w = 0; w < this->_wordsPerRow; w++)
+    {
+        uint64_t word = firstRow[w] & secondRow[w];
+
+        while (word != 0)
+        {
+            nodes.append(w * BitSet::WORD_BITS + countTrailingZeros(word));
+            word &= word - 1;
+        }
+    }
+
+    return nodes;
+}
+
+/**
+ * Conta le terne di nodi u < v < w con archi u -> v, u -> w e v -> w. Se il grafo e'
+ * simmetrico (ogni arco ha il suo inverso, cioe' rappresenta un grafo non orientato)
+ * il risultato e' il numero di triangoli, ognuno contato una sola volta. I cappi sono ignorati.
+ *
+ * Per ogni arco u -> v con u < v, i nodi w > v comuni alle due righe si contano con un
+ * AND fra le righe a partire dalla parola che contiene v.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @return Numero di triangoli
+ */
+template <class TNodeLabel>
+uint64_t BitGraph<TNodeLabel>::countTriangles() const
+{
+    uint64_t triangles = 0;
+
+    for (uint32_t u = this->_enabled.nextSet(0); u < this->_gSize; u = this->_enabled.nextSet(u + 1))
+    {
+        const uint64_t* uRow = this->_row(u);
+        BitRowIterator end(uRow, this->_wordsPerRow, this->_wordsPerRow);
+
+        // I vicini v > u stanno dalla parola di u in poi
+        for (BitRowIterator it(uRow, u / BitSet::WORD_BITS, this->_wordsPerRow); it != end; ++it)
+        {
+            uint32_t v = (*it).id;
+
+            if (v <= u)
+            {
+                continue;
+            }
+
+            const uint64_t* vRow = this->_row(v);
+            uint32_t wordIndex = v / BitSet::WORD_BITS;
+            uint32_t shift = v % BitSet::WORD_BITS;
+            uint64_t above = (shift == BitSet::WORD_BITS - 1) ? 0 : (~0ULL << (shift + 1)); // Bit dei nodi w > v
+
+            triangles += popCount(uRow[wordIndex] & vRow[wordIndex] & above);
+            triangles += intersectionCount(uRow + wordIndex + 1, vRow + wordIndex + 1, this->_wordsPerRow - wordIndex - 1);
+        }
+    }
+
+    return triangles;
+}
+
+/**
+ * Restituisce la riga della matrice di adiacenza del nodo id
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param id : Id del nodo
+ * @return Puntatore alla prima parola della riga
+ */
+template <class TNodeLabel>
+const uint64_t* BitGraph<TNodeLabel>::_row(uint32_t id) const
+{
+    return this->_matrix.data() + (std::size_t) id * this->_wordsPerRow;
+}
+
+/**
+ * Restituisce la riga della matrice di adiacenza del nodo id
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @param id : Id del nodo
+ * @return Puntatore alla prima parola della riga
+ */
+template <class TNodeLabel>
+uint64_t* BitGraph<TNodeLabel>::_row(uint32_t id)
+{
+    return this->_matrix.data() + (std::size_t) id * this->_wordsPerRow;
+}
+
+
+/**
+ * Stampa la lista degli archi uscenti di ogni nodo
+ *
+ * @tparam TypeNodeLabel : Tipo dell'etichetta
+ * @param out : Stream su cui stampare
+ * @param graph : Grafo da stampare
+ * @return Stream su cui si e' stampato
+ */
+template <class TypeNodeLabel>
+std::ostream& operator<<(std::ostream& out, const BitGraph<TypeNodeLabel>& graph)
+{
+    for (uint32_t u = graph._enabled.nextSet(0); u < graph._gSize; u = graph._enabled.nextSet(u + 1))
+    {
+        out << "[" << u << ", " << graph._labels[u] << "] -->";
+
+        for (auto link : graph.getOutLinks(GraphNode(u)))
+        {
+            out << " " << link.id;
+        }
+
+        out << std::endl;
+    }
+
+    return out;
+}
+
+#endif // _BITGRAPH_H
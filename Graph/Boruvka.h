@@ -0,0 +1,308 @@
+#ifndef _BORUVKA_H
+#define _BORUVKA_H
+
+#include "Graph.h"
+#include "SpanningForest.h"
+#include "../Lib/ThreadPool.h"
+#include "../UnionFind/UnionFind.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+/**
+ * Motore per il calcolo parallelo della foresta ricoprente minima con l'algoritmo di
+ * Boruvka, pensato per grafi con milioni di archi.
+ *
+ * Gli archi del grafo, considerati non orientati, vengono copiati in parallelo in una
+ * lista. Ad ogni turno:
+ *  - i thread si dividono gli archi e ogni arco si propone come arco minimo di entrambe
+ *    le componenti che collega, con una CAS sull'indice dell'arco migliore di ogni
+ *    componente;
+ *  - gli archi minimi vengono aggiunti alla foresta, unendo le componenti con una
+ *    struttura union-find (un arco scelto da entrambe le sue componenti entra una volta);
+ *  - le etichette di componente vengono aggiornate e i thread scartano gli archi che
+ *    ormai collegano nodi della stessa componente.
+ * Ogni turno almeno dimezza le componenti che hanno ancora archi, quindi i turni sono
+ * O(log V). L'ordine totale degli archi (SpanningLink) esclude i cicli anche con pesi
+ * uguali, e la foresta coincide con quella di Prim e Kruskal.
+ *
+ * Unione ed etichettatura sono sequenziali e costano O(V) per turno: il lavoro parallelo
+ * e' quello sugli archi, che domina quando E e' molto maggiore di V.
+ *
+ * @tparam TGraph : Tipo del grafo, con meno di 2^32 archi
+ */
+template <class TGraph>
+class Boruvka
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+        typedef SpanningLink<LinkWeight> Link;
+        typedef SpanningForest<LinkWeight> Forest;
+
+    private:
+        static const uint32_t _NO_LINK = UINT32_MAX; // Componente senza arco minimo
+        static const uint32_t _GRAIN_NODES = 4096; // Nodi per blocco di lavoro
+        static const uint32_t _GRAIN_LINKS = 16384; // Archi per blocco di lavoro
+
+        const TGraph& _graph; // Grafo di cui calcolare la foresta
+        ThreadPool& _pool; // Thread su cui eseguire l'algoritmo
+        std::vector<Link> _links; // Archi che collegano componenti distinte
+        std::vector<Link> _nextLinks; // Archi sopravvissuti al turno corrente
+        std::vector< std::vector<Link> > _kept; // Archi sopravvissuti trovati da ogni thread
+        std::vector<uint32_t> _components; // Componente di ogni nodo all'inizio del turno
+        std::vector< std::atomic<uint32_t> > _best; // Indice dell'arco minimo di ogni componente
+        UnionFind _trees; // Alberi della foresta in costruzione
+        Forest _forest; // Foresta dell'ultima esecuzione
+        uint32_t _roundAmount; // Turni dell'ultima esecuzione
+
+    private:
+        bool _precedes(uint32_t first, uint32_t second) const;
+        void _propose(uint32_t component, uint32_t link);
+        void _gather();
+
+    public:
+        Boruvka(const TGraph& graph, ThreadPool& pool);
+
+        const Forest& run();
+        const Forest& getForest() const;
+        uint32_t getRoundAmount() const;
+};
+
+template <class TGraph>
+const uint32_t Boruvka<TGraph>::_NO_LINK;
+
+
+/**
+ * Crea un motore di Boruvka sul grafo dato, usando i thread di pool.
+ * Il grafo e il pool devono sopravvivere al motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo di cui calcolare la foresta ricoprente minima
+ * @param pool : Thread su cui eseguire l'algoritmo
+ */
+template <class TGraph>
+Boruvka<TGraph>::Boruvka(const TGraph& graph, ThreadPool& pool) : _graph(graph), _pool(pool)
+{
+    this->_roundAmount = 0;
+}
+
+/**
+ * Calcola la foresta ricoprente minima del grafo.
+ * Il riferimento restituito resta valido fino all'esecuzione successiva.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Foresta ricoprente minima
+ */
+template <class TGraph>
+const typename Boruvka<TGraph>::Forest& Boruvka<TGraph>::run()
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+    std::atomic<uint32_t> nodes(0);
+
+    this->_forest.clear();
+    this->_roundAmount = 0;
+    this->_trees.reset(size);
+    this->_components.resize(size);
+    this->_kept.resize(this->_pool.getThreadAmount());
+
+    if (this->_best.size() != size)
+    {
+        std::vector< std::atomic<uint32_t> > best(size);
+
+        this->_best.swap(best);
+    }
+
+    // Copia degli archi: ogni thread raccoglie quelli dei propri nodi
+    this->_pool.parallelFor(0, size, _GRAIN_NODES, [this, &nodes](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        std::vector<Link>& kept = this->_kept[thread];
+        uint32_t amount = 0;
+        Link link;
+
+        for (uint32_t u = from; u < to; u++)
+        {
+            this->_components[u] = u;
+
+            if (!this->_graph.isNodeEnabled(GraphNode(u)))
+            {
+                continue;
+            }
+
+            amount++;
+            link.from = u;
+
+            for (auto out : this->_graph.getOutLinks(GraphNode(u)))
+            {
+                if (out.id != u)
+                {
+                    link.to = out.id;
+                    link.weight = out.weight;
+                    kept.push_back(link);
+                }
+            }
+        }
+
+        nodes.fetch_add(amount, std::memory_order_relaxed);
+    });
+
+    this->_gather();
+
+    while (!this->_links.empty())
+    {
+        this->_roundAmount++;
+
+        this->_pool.parallelFor(0, size, _GRAIN_NODES, [this](uint32_t from, uint32_t to, uint32_t thread)
+        {
+            for (uint32_t u = from; u < to; u++)
+            {
+                this->_best[u].store(_NO_LINK, std::memory_order_relaxed);
+            }
+        });
+
+        this->_pool.parallelFor(0, (uint32_t) this->_links.size(), _GRAIN_LINKS, [this](uint32_t from, uint32_t to, uint32_t thread)
+        {
+            for (uint32_t i = from; i < to; i++)
+            {
+                this->_propose(this->_components[this->_links[i].from], i);
+                this->_propose(this->_components[this->_links[i].to], i);
+            }
+        });
+
+        for (uint32_t c = 0; c < size; c++)
+        {
+            uint32_t best = this->_best[c].load(std::memory_order_relaxed);
+
+            if (best != _NO_LINK && this->_trees.unite(this->_links[best].from, this->_links[best].to))
+            {
+                this->_forest.add(this->_links[best]);
+            }
+        }
+
+        for (uint32_t u = 0; u < size; u++)
+        {
+            this->_components[u] = this->_trees.find(u);
+        }
+
+        // Restano solo gli archi fra componenti ancora distinte
+        this->_pool.parallelFor(0, (uint32_t) this->_links.size(), _GRAIN_LINKS, [this](uint32_t from, uint32_t to, uint32_t thread)
+        {
+            std::vector<Link>& kept = this->_kept[thread];
+
+            for (uint32_t i = from; i < to; i++)
+            {
+                if (this->_components[this->_links[i].from] != this->_components[this->_links[i].to])
+                {
+                    kept.push_back(this->_links[i]);
+                }
+            }
+        });
+
+        this->_gather();
+    }
+
+    this->_forest.setTreeAmount(nodes.load() - this->_forest.getLinkAmount());
+
+    return this->_forest;
+}
+
+/**
+ * Restituisce la foresta dell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Foresta ricoprente minima
+ */
+template <class TGraph>
+const typename Boruvka<TGraph>::Forest& Boruvka<TGraph>::getForest() const
+{
+    return this->_forest;
+}
+
+/**
+ * Restituisce il numero di turni dell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di turni
+ */
+template <class TGraph>
+uint32_t Boruvka<TGraph>::getRoundAmount() const
+{
+    return this->_roundAmount;
+}
+
+
+/**
+ * Confronta due archi della lista con l'ordine di SpanningLink; gli archi paralleli di
+ * pari peso vengono distinti per indice, cosi' che tutte le componenti scelgano lo stesso
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param first : Indice del primo arco
+ * @param second : Indice del secondo arco
+ * @return True se first precede second, altrimenti false
+ */
+template <class TGraph>
+bool Boruvka<TGraph>::_precedes(uint32_t first, uint32_t second) const
+{
+    if (this->_links[first] < this->_links[second])
+    {
+        return true;
+    }
+
+    if (this->_links[second] < this->_links[first])
+    {
+        return false;
+    }
+
+    return first < second;
+}
+
+/**
+ * Propone l'arco di indice link come arco minimo della componente, se precede quello
+ * gia' registrato
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param component : Rappresentante della componente
+ * @param link : Indice dell'arco
+ */
+template <class TGraph>
+void Boruvka<TGraph>::_propose(uint32_t component, uint32_t link)
+{
+    uint32_t current = this->_best[component].load(std::memory_order_relaxed);
+
+    while (current == _NO_LINK || this->_precedes(link, current))
+    {
+        if (this->_best[component].compare_exchange_weak(current, link, std::memory_order_relaxed))
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * Concatena in parallelo gli archi raccolti dai thread nella nuova lista degli archi
+ * e svuota le liste dei thread
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void Boruvka<TGraph>::_gather()
+{
+    std::vector<std::size_t> offsets(this->_kept.size() + 1, 0);
+
+    for (std::size_t t = 0; t < this->_kept.size(); t++)
+    {
+        offsets[t + 1] = offsets[t] + this->_kept[t].size();
+    }
+
+    this->_nextLinks.resize(offsets.back());
+
+    this->_pool.run([this, &offsets](uint32_t thread)
+    {
+        std::copy(this->_kept[thread].begin(), this->_kept[thread].end(), this->_nextLinks.begin() + offsets[thread]);
+        this->_kept[thread].clear();
+    });
+
+    this->_links.swap(this->_nextLinks);
+}
+
+#endif // _BORUVKA_H
@@ -0,0 +1,204 @@
+#ifndef _CONNECTEDCOMPONENTS_H
+#define _CONNECTEDCOMPONENTS_H
+
+#include "Graph.h"
+#include "../Lib/ThreadPool.h"
+#include "../UnionFind/ConcurrentUnionFind.h"
+
+#include <vector>
+
+/**
+ * Motore per l'etichettatura parallela delle componenti connesse di un grafo, con gli
+ * archi considerati non orientati (componenti debolmente connesse).
+ *
+ * I thread si dividono i nodi e uniscono gli estremi di ogni arco uscente in una
+ * struttura union-find concorrente, senza lock; poi ogni nodo riceve in parallelo il
+ * rappresentante del proprio insieme. Infine le componenti vengono numerate da 0 in
+ * ordine di id del nodo minimo, cosi' che la numerazione non dipenda dai thread.
+ *
+ * Per grafi che crescono per aggiunta di archi, Graph mantiene le componenti in modo
+ * incrementale (areConnected, getComponentAmount) senza ricalcolarle.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+class ConnectedComponents
+{
+    public:
+        static const uint32_t NO_COMPONENT = UINT32_MAX; // Componente dei nodi inesistenti
+
+    private:
+        static const uint32_t _GRAIN_NODES = 1024; // Nodi per blocco di lavoro
+
+        const TGraph& _graph; // Grafo di cui calcolare le componenti
+        ThreadPool& _pool; // Thread su cui eseguire l'algoritmo
+        ConcurrentUnionFind _sets; // Insiemi dei nodi collegati
+        std::vector<uint32_t> _component; // Componente di ogni nodo
+        std::vector<uint32_t> _numbers; // Numero assegnato a ogni rappresentante
+        std::vector<uint32_t> _componentSizes; // Numero di nodi di ogni componente
+
+    public:
+        ConnectedComponents(const TGraph& graph, ThreadPool& pool);
+
+        void run();
+
+        uint32_t getComponentAmount() const;
+        uint32_t getComponent(const GraphNode& node) const;
+        uint32_t getComponentSize(uint32_t component) const;
+        const std::vector<uint32_t>& getComponents() const;
+
+        bool isConnected(const GraphNode& from, const GraphNode& to) const;
+};
+
+template <class TGraph>
+const uint32_t ConnectedComponents<TGraph>::NO_COMPONENT;
+
+
+/**
+ * Crea un motore per le componenti connesse del grafo dato, usando i thread di pool.
+ * Il grafo e il pool devono sopravvivere al motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo di cui calcolare le componenti
+ * @param pool : Thread su cui eseguire l'algoritmo
+ */
+template <class TGraph>
+ConnectedComponents<TGraph>::ConnectedComponents(const TGraph& graph, ThreadPool& pool) : _graph(graph), _pool(pool) { }
+
+/**
+ * Calcola le componenti connesse del grafo. Va richiamato dopo ogni modifica del grafo.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void ConnectedComponents<TGraph>::run()
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+
+    this->_sets.reset(size);
+    this->_component.resize(size);
+    this->_numbers.assign(size, NO_COMPONENT);
+    this->_componentSizes.clear();
+
+    this->_pool.parallelFor(0, size, _GRAIN_NODES, [this](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t u = from; u < to; u++)
+        {
+            if (!this->_graph.isNodeEnabled(GraphNode(u)))
+            {
+                continue;
+            }
+
+            for (auto link : this->_graph.getOutLinks(GraphNode(u)))
+            {
+                this->_sets.unite(u, link.id);
+            }
+        }
+    });
+
+    this->_pool.parallelFor(0, size, _GRAIN_NODES, [this](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t u = from; u < to; u++)
+        {
+            this->_component[u] = this->_graph.isNodeEnabled(GraphNode(u)) ? this->_sets.find(u) : NO_COMPONENT;
+        }
+    });
+
+    // Numerazione compatta, nell'ordine in cui i rappresentanti compaiono
+    for (uint32_t u = 0; u < size; u++)
+    {
+        uint32_t root = this->_component[u];
+
+        if (root == NO_COMPONENT)
+        {
+            continue;
+        }
+
+        if (this->_numbers[root] == NO_COMPONENT)
+        {
+            this->_numbers[root] = (uint32_t) this->_componentSizes.size();
+            this->_componentSizes.push_back(0);
+        }
+
+        this->_component[u] = this->_numbers[root];
+        this->_componentSizes[this->_component[u]]++;
+    }
+}
+
+/**
+ * Restituisce il numero di componenti connesse dell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di componenti
+ */
+template <class TGraph>
+uint32_t ConnectedComponents<TGraph>::getComponentAmount() const
+{
+    return (uint32_t) this->_componentSizes.size();
+}
+
+/**
+ * Restituisce la componente di un nodo
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo
+ * @return Indice della componente, NO_COMPONENT se il nodo non esiste
+ */
+template <class TGraph>
+uint32_t ConnectedComponents<TGraph>::getComponent(const GraphNode& node) const
+{
+    if (node.getId() >= this->_component.size())
+    {
+        return NO_COMPONENT;
+    }
+
+    return this->_component[node.getId()];
+}
+
+/**
+ * Restituisce il numero di nodi di una componente
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param component : Indice della componente
+ * @return Numero di nodi, zero se la componente non esiste
+ */
+template <class TGraph>
+uint32_t ConnectedComponents<TGraph>::getComponentSize(uint32_t component) const
+{
+    if (component >= this->_componentSizes.size())
+    {
+        return 0;
+    }
+
+    return this->_componentSizes[component];
+}
+
+/**
+ * Restituisce la componente di ogni nodo, NO_COMPONENT per i nodi inesistenti
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Vettore delle componenti
+ */
+template <class TGraph>
+const std::vector<uint32_t>& ConnectedComponents<TGraph>::getComponents() const
+{
+    return this->_component;
+}
+
+/**
+ * Restituisce true se from e to appartengono alla stessa componente connessa
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param from : Primo nodo
+ * @param to : Secondo nodo
+ * @return True se esiste un cammino non orientato fra from e to, altrimenti false
+ */
+template <class TGraph>
+bool ConnectedComponents<TGraph>::isConnected(const GraphNode& from, const GraphNode& to) const
+{
+    uint32_t component = this->getComponent(from);
+
+    return component != NO_COMPONENT && component == this->getComponent(to);
+}
+
+#endif // _CONNECTEDCOMPONENTS_H
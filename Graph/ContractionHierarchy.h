@@ -0,0 +1,1414 @@
+#ifndef _CONTRACTIONHIERARCHY_H
+#define _CONTRACTIONHIERARCHY_H
+
+#include "Graph.h"
+#include "Dijkstra.h"
+#include "ShortestPath.h"
+#include "ShortestPathTree.h"
+#include "../PriorityQueue/IndexedPriorityQueue.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <vector>
+
+/**
+ * Arco del grafo residuo durante la costruzione di una gerarchia di contrazione.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class HierarchyArc
+{
+    public:
+        uint32_t node; // Altro estremo dell'arco
+        TLinkWeight weight; // Peso dell'arco
+        uint32_t via; // Nodo saltato se l'arco e' una scorciatoia, altrimenti UINT32_MAX
+};
+
+/**
+ * Arco da espandere durante la ricostruzione di un cammino
+ */
+class HierarchyEdge
+{
+    public:
+        uint32_t from; // Nodo di partenza
+        uint32_t to; // Nodo di arrivo
+        uint32_t via; // Nodo saltato se l'arco e' una scorciatoia, altrimenti UINT32_MAX
+};
+
+
+/**
+ * Costruisce l'ordine di contrazione e le scorciatoie di una gerarchia di contrazione.
+ *
+ * I nodi vengono contratti in ordine di edge difference (scorciatoie necessarie meno archi
+ * rimossi) piu' il numero di vicini gia' contratti, cosi' che la contrazione proceda in modo
+ * uniforme sul grafo. Le priorita' sono aggiornate in modo pigro: il nodo estratto viene
+ * ricalcolato e, se non e' piu' il minimo, torna in coda; dopo ogni contrazione vengono
+ * ricalcolati i suoi vicini.
+ *
+ * Contrarre un nodo u significa toglierlo dal grafo residuo aggiungendo, per ogni coppia
+ * di vicini v --> u --> w, la scorciatoia v --> w se non esiste un cammino alternativo
+ * (witness) lungo al piu' quanto v --> u --> w. La ricerca dei witness e' un Dijkstra
+ * limitato: se si ferma prima di trovarlo, la scorciatoia viene aggiunta comunque, il che
+ * costa solo un arco in piu'.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class ContractionBuilder
+{
+    public:
+        typedef HierarchyArc<TLinkWeight> Arc;
+        typedef std::vector<Arc> ArcList;
+        typedef IndexedPriorityQueue< DijkstraEntry<TLinkWeight> > Queue;
+        typedef IndexedPriorityQueue< DijkstraEntry<int64_t> > OrderQueue;
+        typedef typename Queue::Handle Handle;
+
+        static const uint32_t NO_NODE = UINT32_MAX; // Nodo inesistente
+
+    private:
+        static const uint32_t _WITNESS_SETTLE_LIMIT = 500; // Nodi etichettati al massimo da una ricerca di witness
+
+        uint32_t _size; // Numero di id di nodo gestiti
+        std::vector<bool> _enabled; // Se true, il nodo con quell'id e' attivo
+        std::vector<ArcList> _out; // Archi uscenti di ogni nodo nel grafo residuo
+        std::vector<ArcList> _in; // Archi entranti di ogni nodo nel grafo residuo
+        std::vector<ArcList> _up; // Archi uscenti verso nodi di rango maggiore, fissati alla contrazione
+        std::vector<ArcList> _down; // Archi entranti da nodi di rango maggiore, fissati alla contrazione
+        std::vector<uint32_t> _ranks; // Posizione di ogni nodo nell'ordine di contrazione
+        std::vector<uint32_t> _contractedNeighbours; // Numero di vicini gia' contratti di ogni nodo
+        uint64_t _shortcutAmount; // Numero di scorciatoie aggiunte
+
+        std::vector<TLinkWeight> _witnessDistances; // Distanze provvisorie della ricerca di witness
+        std::vector<Handle> _witnessHandles; // Handle nella coda della ricerca di witness
+        std::vector<uint32_t> _witnessTouched; // Nodi toccati dall'ultima ricerca di witness
+        Queue _witnessQueue; // Coda della ricerca di witness
+
+        std::vector<uint32_t> _shortcutFroms; // Partenza delle scorciatoie del nodo in contrazione
+        ArcList _shortcutArcs; // Arrivo e peso delle scorciatoie del nodo in contrazione
+
+    private:
+        static TLinkWeight _infinity();
+        static bool _insertArc(ArcList& arcs, uint32_t node, TLinkWeight weight, uint32_t via);
+        static void _removeArc(ArcList& arcs, uint32_t node);
+
+        void _witnessSearch(uint32_t source, uint32_t skip, TLinkWeight limit);
+        uint32_t _findShortcuts(uint32_t node, bool store);
+        int64_t _priority(uint32_t node);
+        void _contract(uint32_t node, uint32_t rank, std::vector<uint32_t>& neighbours);
+
+    public:
+        ContractionBuilder(uint32_t size);
+
+        void enable(uint32_t node);
+        void addLink(uint32_t from, uint32_t to, TLinkWeight weight);
+        void run();
+
+        uint32_t getRank(uint32_t node) const;
+        const ArcList& getUpArcs(uint32_t node) const;
+        const ArcList& getDownArcs(uint32_t node) const;
+        uint64_t getShortcutAmount() const;
+};
+
+template <class TLinkWeight>
+const uint32_t ContractionBuilder<TLinkWeight>::NO_NODE;
+
+template <class TLinkWeight>
+const uint32_t ContractionBuilder<TLinkWeight>::_WITNESS_SETTLE_LIMIT;
+
+
+/**
+ * Crea un costruttore per un grafo con size id di nodo, senza nodi attivi
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param size : Numero di id di nodo
+ */
+template <class TLinkWeight>
+ContractionBuilder<TLinkWeight>::ContractionBuilder(uint32_t size)
+{
+    this->_size = size;
+    this->_enabled.assign(size, false);
+    this->_out.resize(size);
+    this->_in.resize(size);
+    this->_up.resize(size);
+    this->_down.resize(size);
+    this->_ranks.assign(size, NO_NODE);
+    this->_contractedNeighbours.assign(size, 0);
+    this->_shortcutAmount = 0;
+
+    this->_witnessDistances.assign(size, _infinity());
+    this->_witnessHandles.assign(size, Queue::NULL_HANDLE);
+}
+
+/**
+ * Rende attivo un nodo, che verra' contratto da run()
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ */
+template <class TLinkWeight>
+void ContractionBuilder<TLinkWeight>::enable(uint32_t node)
+{
+    this->_enabled[node] = true;
+}
+
+/**
+ * Aggiunge un arco al grafo da contrarre. I cappi vengono ignorati e, fra archi paralleli,
+ * viene tenuto quello di peso minore.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @param weight : Peso dell'arco
+ */
+template <class TLinkWeight>
+void ContractionBuilder<TLinkWeight>::addLink(uint32_t from, uint32_t to, TLinkWeight weight)
+{
+    if (from == to)
+    {
+        return;
+    }
+
+    ContractionBuilder<TLinkWeight>::_insertArc(this->_out[from], to, weight, NO_NODE);
+    ContractionBuilder<TLinkWeight>::_insertArc(this->_in[to], from, weight, NO_NODE);
+}
+
+/**
+ * Contrae tutti i nodi attivi, assegnando ad ognuno il suo rango
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+void ContractionBuilder<TLinkWeight>::run()
+{
+    OrderQueue queue;
+    std::vector<typename OrderQueue::Handle> handles(this->_size, OrderQueue::NULL_HANDLE);
+    std::vector<uint32_t> neighbours;
+    DijkstraEntry<int64_t> entry; // Il campo distance contiene la priorita' del nodo
+
+    for (uint32_t u = 0; u < this->_size; u++)
+    {
+        if (this->_enabled[u])
+        {
+            entry.distance = this->_priority(u);
+            entry.node = u;
+            handles[u] = queue.push(entry);
+        }
+    }
+
+    uint32_t rank = 0;
+
+    while (!queue.isEmpty())
+    {
+        uint32_t u = queue.min().node;
+
+        queue.deleteMin();
+        handles[u] = OrderQueue::NULL_HANDLE;
+
+        // Aggiornamento pigro: se la priorita' e' cresciuta oltre il minimo, il nodo torna in coda
+        entry.distance = this->_priority(u);
+        entry.node = u;
+
+        if (!queue.isEmpty() && entry.distance > queue.min().distance)
+        {
+            handles[u] = queue.push(entry);
+            continue;
+        }
+
+        this->_contract(u, rank++, neighbours);
+
+        for (std::size_t i = 0; i < neighbours.size(); i++)
+        {
+            uint32_t x = neighbours[i];
+
+            this->_contractedNeighbours[x]++;
+
+            entry.distance = this->_priority(x);
+            entry.node = x;
+
+            queue.erase(handles[x]);
+            handles[x] = queue.push(entry);
+        }
+    }
+}
+
+/**
+ * Restituisce il rango del nodo, oppure NO_NODE se il nodo non e' attivo
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @return Posizione del nodo nell'ordine di contrazione
+ */
+template <class TLinkWeight>
+uint32_t ContractionBuilder<TLinkWeight>::getRank(uint32_t node) const
+{
+    return this->_ranks[node];
+}
+
+/**
+ * Restituisce gli archi uscenti dal nodo verso nodi di rango maggiore, scorciatoie comprese
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @return Archi uscenti verso l'alto
+ */
+template <class TLinkWeight>
+const typename ContractionBuilder<TLinkWeight>::ArcList& ContractionBuilder<TLinkWeight>::getUpArcs(uint32_t node) const
+{
+    return this->_up[node];
+}
+
+/**
+ * Restituisce gli archi entranti nel nodo da nodi di rango maggiore, scorciatoie comprese
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @return Archi entranti dall'alto
+ */
+template <class TLinkWeight>
+const typename ContractionBuilder<TLinkWeight>::ArcList& ContractionBuilder<TLinkWeight>::getDownArcs(uint32_t node) const
+{
+    return this->_down[node];
+}
+
+/**
+ * Restituisce il numero di scorciatoie aggiunte durante la contrazione
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di scorciatoie
+ */
+template <class TLinkWeight>
+uint64_t ContractionBuilder<TLinkWeight>::getShortcutAmount() const
+{
+    return this->_shortcutAmount;
+}
+
+
+/**
+ * Restituisce il valore usato come distanza infinita
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Distanza infinita
+ */
+template <class TLinkWeight>
+TLinkWeight ContractionBuilder<TLinkWeight>::_infinity()
+{
+    return std::numeric_limits<TLinkWeight>::max();
+}
+
+/**
+ * Inserisce un arco verso node, oppure ne abbassa il peso se l'arco esiste gia' con peso maggiore
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param arcs : Archi di un nodo
+ * @param node : Altro estremo dell'arco
+ * @param weight : Peso dell'arco
+ * @param via : Nodo saltato, NO_NODE per un arco originale
+ * @return True se l'arco e' stato aggiunto, false se esisteva gia'
+ */
+template <class TLinkWeight>
+bool ContractionBuilder<TLinkWeight>::_insertArc(ArcList& arcs, uint32_t node, TLinkWeight weight, uint32_t via)
+{
+    for (std::size_t i = 0; i < arcs.size(); i++)
+    {
+        if (arcs[i].node == node)
+        {
+            if (weight < arcs[i].weight)
+            {
+                arcs[i].weight = weight;
+                arcs[i].via = via;
+            }
+
+            return false;
+        }
+    }
+
+    Arc arc;
+
+    arc.node = node;
+    arc.weight = weight;
+    arc.via = via;
+    arcs.push_back(arc);
+
+    return true;
+}
+
+/**
+ * Rimuove l'arco verso node, se presente
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param arcs : Archi di un nodo
+ * @param node : Altro estremo dell'arco
+ */
+template <class TLinkWeight>
+void ContractionBuilder<TLinkWeight>::_removeArc(ArcList& arcs, uint32_t node)
+{
+    for (std::size_t i = 0; i < arcs.size(); i++)
+    {
+        if (arcs[i].node == node)
+        {
+            arcs[i] = arcs.back();
+            arcs.pop_back();
+            return;
+        }
+    }
+}
+
+/**
+ * Calcola le distanze da source nel grafo residuo senza passare per skip, fermandosi
+ * quando la distanza minima in coda supera limit o dopo _WITNESS_SETTLE_LIMIT nodi.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param source : Nodo di partenza
+ * @param skip : Nodo da non attraversare
+ * @param limit : Distanza oltre la quale la ricerca si ferma
+ */
+template <class TLinkWeight>
+void ContractionBuilder<TLinkWeight>::_witnessSearch(uint32_t source, uint32_t skip, TLinkWeight limit)
+{
+    for (std::size_t i = 0; i < this->_witnessTouched.size(); i++)
+    {
+        this->_witnessDistances[this->_witnessTouched[i]] = _infinity();
+        this->_witnessHandles[this->_witnessTouched[i]] = Queue::NULL_HANDLE;
+    }
+
+    this->_witnessTouched.clear();
+    this->_witnessQueue.clear();
+
+    DijkstraEntry<TLinkWeight> entry;
+
+    entry.distance = TLinkWeight();
+    entry.node = source;
+
+    this->_witnessDistances[source] = entry.distance;
+    this->_witnessTouched.push_back(source);
+    this->_witnessHandles[source] = this->_witnessQueue.push(entry);
+
+    uint32_t settled = 0;
+
+    while (!this->_witnessQueue.isEmpty() && settled < _WITNESS_SETTLE_LIMIT)
+    {
+        uint32_t u = this->_witnessQueue.min().node;
+        TLinkWeight distanceU = this->_witnessQueue.min().distance;
+
+        if (limit < distanceU)
+        {
+            break;
+        }
+
+        this->_witnessQueue.deleteMin();
+        this->_witnessHandles[u] = Queue::NULL_HANDLE;
+        settled++;
+
+        const ArcList& arcs = this->_out[u];
+
+        for (std::size_t i = 0; i < arcs.size(); i++)
+        {
+            uint32_t v = arcs[i].node;
+            TLinkWeight candidate = distanceU + arcs[i].weight;
+
+            if (v == skip || !(candidate < this->_witnessDistances[v]))
+            {
+                continue;
+            }
+
+            if (this->_witnessDistances[v] == _infinity())
+            {
+                this->_witnessTouched.push_back(v);
+            }
+
+            this->_witnessDistances[v] = candidate;
+
+            entry.distance = candidate;
+            entry.node = v;
+
+            if (this->_witnessHandles[v] == Queue::NULL_HANDLE)
+            {
+                this->_witnessHandles[v] = this->_witnessQueue.push(entry);
+            }
+
+            else
+            {
+                this->_witnessQueue.decreaseKey(this->_witnessHandles[v], entry);
+            }
+        }
+    }
+}
+
+/**
+ * Conta le scorciatoie necessarie per contrarre il nodo e, se store e' true, le salva
+ * in _shortcutFroms e _shortcutArcs.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da contrarre
+ * @param store : Se true le scorciatoie vengono salvate, altrimenti solo contate
+ * @return Numero di scorciatoie necessarie
+ */
+template <class TLinkWeight>
+uint32_t ContractionBuilder<TLinkWeight>::_findShortcuts(uint32_t node, bool store)
+{
+    const ArcList& ins = this->_in[node];
+    const ArcList& outs = this->_out[node];
+    uint32_t amount = 0;
+
+    this->_shortcutFroms.clear();
+    this->_shortcutArcs.clear();
+
+    for (std::size_t i = 0; i < ins.size(); i++)
+    {
+        uint32_t v = ins[i].node;
+        TLinkWeight limit = TLinkWeight();
+        bool hasTargets = false;
+
+        for (std::size_t j = 0; j < outs.size(); j++)
+        {
+            if (outs[j].node != v)
+            {
+                limit = std::max(limit, ins[i].weight + outs[j].weight);
+                hasTargets = true;
+            }
+        }
+
+        if (!hasTargets)
+        {
+            continue;
+        }
+
+        this->_witnessSearch(v, node, limit);
+
+        for (std::size_t j = 0; j < outs.size(); j++)
+        {
+            uint32_t w = outs[j].node;
+            TLinkWeight through = ins[i].weight + outs[j].weight;
+
+            if (w == v || !(through < this->_witnessDistances[w]))
+            {
+                continue;
+            }
+
+            amount++;
+
+            if (store)
+            {
+                Arc arc;
+
+                arc.node = w;
+                arc.weight = through;
+                arc.via = node;
+
+                this->_shortcutFroms.push_back(v);
+                this->_shortcutArcs.push_back(arc);
+            }
+        }
+    }
+
+    return amount;
+}
+
+/**
+ * Calcola la priorita' di contrazione del nodo: scorciatoie necessarie meno archi rimossi,
+ * piu' il numero di vicini gia' contratti. I nodi con priorita' minore vengono contratti prima.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @return Priorita' del nodo
+ */
+template <class TLinkWeight>
+int64_t ContractionBuilder<TLinkWeight>::_priority(uint32_t node)
+{
+    int64_t shortcuts = this->_findShortcuts(node, false);
+    int64_t removed = (int64_t) this->_in[node].size() + (int64_t) this->_out[node].size();
+
+    return shortcuts - removed + this->_contractedNeighbours[node];
+}
+
+/**
+ * Contrae il nodo: fissa i suoi archi verso i vicini rimasti come archi verso l'alto,
+ * aggiunge le scorciatoie fra i vicini e lo toglie dal grafo residuo.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da contrarre
+ * @param rank : Rango da assegnare al nodo
+ * @param neighbours : Riempito con i vicini del nodo nel grafo residuo, senza ripetizioni
+ */
+template <class TLinkWeight>
+void ContractionBuilder<TLinkWeight>::_contract(uint32_t node, uint32_t rank, std::vector<uint32_t>& neighbours)
+{
+    this->_ranks[node] = rank;
+    this->_findShortcuts(node, true);
+
+    for (std::size_t i = 0; i < this->_shortcutArcs.size(); i++)
+    {
+        uint32_t from = this->_shortcutFroms[i];
+        const Arc& arc = this->_shortcutArcs[i];
+
+        if (ContractionBuilder<TLinkWeight>::_insertArc(this->_out[from], arc.node, arc.weight, arc.via))
+        {
+            this->_shortcutAmount++;
+        }
+
+        ContractionBuilder<TLinkWeight>::_insertArc(this->_in[arc.node], from, arc.weight, arc.via);
+    }
+
+    neighbours.clear();
+
+    for (std::size_t i = 0; i < this->_out[node].size(); i++)
+    {
+        uint32_t w = this->_out[node][i].node;
+
+        ContractionBuilder<TLinkWeight>::_removeArc(this->_in[w], node);
+        neighbours.push_back(w);
+    }
+
+    for (std::size_t i = 0; i < this->_in[node].size(); i++)
+    {
+        uint32_t v = this->_in[node][i].node;
+
+        ContractionBuilder<TLinkWeight>::_removeArc(this->_out[v], node);
+        neighbours.push_back(v);
+    }
+
+    std::sort(neighbours.begin(), neighbours.end());
+    neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+
+    // I vicini rimasti hanno tutti rango maggiore: gli archi del nodo diventano definitivi
+    this->_up[node].swap(this->_out[node]);
+    this->_down[node].swap(this->_in[node]);
+}
+
+
+/**
+ * Indice per interrogazioni ripetute di cammino minimo basato sulle gerarchie di contrazione
+ * (Contraction Hierarchies).
+ *
+ * La preelaborazione contrae i nodi uno alla volta (vedi ContractionBuilder), assegnando ad
+ * ognuno un rango e aggiungendo scorciatoie che conservano le distanze. Ogni arco, originale
+ * o scorciatoia, viene salvato nel suo estremo di rango minore, in due grafi di ricerca in
+ * formato CSR: archi uscenti verso l'alto e archi entranti dall'alto.
+ *
+ * Un'interrogazione e' un Dijkstra bidirezionale che sale soltanto: in avanti dalla sorgente
+ * sugli archi uscenti verso l'alto, all'indietro dalla destinazione su quelli entranti. Il
+ * cammino minimo passa per il suo nodo di rango massimo, dove le due ricerche si incontrano,
+ * e le ricerche visitano solo poche centinaia di nodi anche su grafi stradali grandi. I nodi
+ * raggiunti con una distanza migliorabile da un nodo di rango maggiore non vengono espansi
+ * (stall-on-demand). Il cammino viene ricostruito espandendo ricorsivamente le scorciatoie.
+ *
+ * L'indice non dipende dal grafo da cui e' stato costruito e si puo' salvare con save() e
+ * ricaricare con load(), purche' TLinkWeight sia un tipo aritmetico. Le interrogazioni
+ * riusano strutture interne, quindi un indice non va interrogato da piu' thread insieme.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class ContractionHierarchy
+{
+    public:
+        typedef TLinkWeight LinkWeight;
+        typedef ShortestPath<TLinkWeight> Path;
+        typedef ShortestPathTree<TLinkWeight> Tree;
+        typedef IndexedPriorityQueue< DijkstraEntry<TLinkWeight> > Queue;
+        typedef typename Queue::Handle Handle;
+
+        static const uint32_t NO_NODE = UINT32_MAX; // Nodo inesistente
+
+    private:
+        static const uint32_t _FORWARD = 0; // Grafo degli archi uscenti verso l'alto
+        static const uint32_t _BACKWARD = 1; // Grafo degli archi entranti dall'alto
+        static const uint32_t _MAGIC = 0x58494843; // "CHIX" all'inizio dei file salvati
+        static const uint32_t _VERSION = 1; // Versione del formato dei file salvati
+
+        uint32_t _size; // Numero di id di nodo gestiti
+        uint64_t _shortcutAmount; // Numero di scorciatoie aggiunte dalla preelaborazione
+        std::vector<uint32_t> _ranks; // Rango di ogni nodo, NO_NODE se il nodo non e' attivo
+        std::vector<uint64_t> _offsets[2]; // Inizio degli archi di ogni nodo, lungo _size + 1
+        std::vector<uint32_t> _heads[2]; // Estremo di rango maggiore di ogni arco
+        std::vector<TLinkWeight> _weights[2]; // Peso di ogni arco
+        std::vector<uint32_t> _vias[2]; // Nodo saltato da ogni scorciatoia, NO_NODE per gli archi originali
+
+        Tree _trees[2]; // Distanze e padri delle due ricerche
+        Queue _queues[2]; // Nodi da processare delle due ricerche
+        std::vector<Handle> _handles[2]; // Handle nelle code di ogni nodo
+        std::vector<uint64_t> _parentEdges[2]; // Arco con cui ogni nodo e' stato raggiunto
+        std::vector<uint32_t> _touched[2]; // Nodi toccati da ciascuna ricerca nell'ultima esecuzione
+        std::vector<HierarchyEdge> _route; // Archi dell'indice sul cammino minimo, dalla sorgente alla destinazione
+        std::vector<HierarchyEdge> _stack; // Archi ancora da espandere nella ricostruzione del cammino
+        Path _path; // Cammino trovato nell'ultima esecuzione
+        uint32_t _settledAmount; // Numero di nodi etichettati dalle due ricerche nell'ultima esecuzione
+
+    private:
+        void _reset();
+        void _prepare();
+        uint32_t _search(uint32_t source, uint32_t target, TLinkWeight& best);
+        void _settle(uint32_t side, TLinkWeight& best, uint32_t& meeting);
+        uint32_t _findVia(uint32_t side, uint32_t node, uint32_t head) const;
+        void _unpack(const HierarchyEdge& edge);
+
+        template <class T>
+        static void _write(std::ostream& out, const std::vector<T>& values);
+        template <class T>
+        static bool _read(std::istream& in, std::vector<T>& values, uint64_t amount);
+
+    public:
+        ContractionHierarchy();
+        template <class TGraph>
+        ContractionHierarchy(const TGraph& graph);
+
+        template <class TGraph>
+        void build(const TGraph& graph);
+
+        uint32_t getMaxNodeAmount() const;
+        uint64_t getLinkAmount() const;
+        uint64_t getShortcutAmount() const;
+        uint32_t getRank(const GraphNode& node) const;
+
+        TLinkWeight getDistance(const GraphNode& source, const GraphNode& target);
+        const Path& run(const GraphNode& source, const GraphNode& target);
+        const Path& getPath() const;
+        uint32_t getSettledAmount() const;
+
+        bool save(std::ostream& out) const;
+        bool load(std::istream& in);
+};
+
+template <class TLinkWeight>
+const uint32_t ContractionHierarchy<TLinkWeight>::NO_NODE;
+
+template <class TLinkWeight>
+const uint32_t ContractionHierarchy<TLinkWeight>::_FORWARD;
+
+template <class TLinkWeight>
+const uint32_t ContractionHierarchy<TLinkWeight>::_BACKWARD;
+
+template <class TLinkWeight>
+const uint32_t ContractionHierarchy<TLinkWeight>::_MAGIC;
+
+template <class TLinkWeight>
+const uint32_t ContractionHierarchy<TLinkWeight>::_VERSION;
+
+
+/**
+ * Crea un indice vuoto, da costruire con build() o da caricare con load()
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+ContractionHierarchy<TLinkWeight>::ContractionHierarchy()
+{
+    this->_reset();
+}
+
+/**
+ * Crea l'indice del grafo dato
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo da preelaborare
+ */
+template <class TLinkWeight>
+template <class TGraph>
+ContractionHierarchy<TLinkWeight>::ContractionHierarchy(const TGraph& graph)
+{
+    this->build(graph);
+}
+
+/**
+ * Costruisce l'indice del grafo dato, sostituendo quello attuale. Il grafo non serve
+ * piu' dopo la costruzione.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @tparam TGraph : Tipo del grafo, con pesi non negativi
+ * @param graph : Grafo da preelaborare
+ */
+template <class TLinkWeight>
+template <class TGraph>
+void ContractionHierarchy<TLinkWeight>::build(const TGraph& graph)
+{
+    uint32_t size = graph.getMaxNodeAmount();
+    ContractionBuilder<TLinkWeight> builder(size);
+
+    for (uint32_t u = 0; u < size; u++)
+    {
+        if (!graph.isNodeEnabled(GraphNode(u)))
+        {
+            continue;
+        }
+
+        builder.enable(u);
+
+        for (auto link : graph.getOutLinks(GraphNode(u)))
+        {
+            builder.addLink(u, link.id, link.weight);
+        }
+    }
+
+    builder.run();
+
+    this->_reset();
+    this->_size = size;
+    this->_shortcutAmount = builder.getShortcutAmount();
+    this->_ranks.resize(size);
+
+    for (uint32_t side = _FORWARD; side <= _BACKWARD; side++)
+    {
+        this->_offsets[side].assign(size + 1, 0);
+
+        for (uint32_t u = 0; u < size; u++)
+        {
+            const typename ContractionBuilder<TLinkWeight>::ArcList& arcs =
+                (side == _FORWARD) ? builder.getUpArcs(u) : builder.getDownArcs(u);
+
+            for (std::size_t i = 0; i < arcs.size(); i++)
+            {
+                this->_heads[side].push_back(arcs[i].node);
+                this->_weights[side].push_back(arcs[i].weight);
+                this->_vias[side].push_back(arcs[i].via);
+            }
+
+            this->_offsets[side][u + 1] = this->_heads[side].size();
+        }
+    }
+
+    for (uint32_t u = 0; u < size; u++)
+    {
+        this->_ranks[u] = builder.getRank(u);
+    }
+}
+
+/**
+ * Restituisce il numero di id di nodo gestiti dall'indice
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di id di nodo
+ */
+template <class TLinkWeight>
+uint32_t ContractionHierarchy<TLinkWeight>::getMaxNodeAmount() const
+{
+    return this->_size;
+}
+
+/**
+ * Restituisce il numero di archi dell'indice, originali e scorciatoie
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di archi
+ */
+template <class TLinkWeight>
+uint64_t ContractionHierarchy<TLinkWeight>::getLinkAmount() const
+{
+    return this->_heads[_FORWARD].size() + this->_heads[_BACKWARD].size();
+}
+
+/**
+ * Restituisce il numero di scorciatoie aggiunte dalla preelaborazione
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di scorciatoie
+ */
+template <class TLinkWeight>
+uint64_t ContractionHierarchy<TLinkWeight>::getShortcutAmount() const
+{
+    return this->_shortcutAmount;
+}
+
+/**
+ * Restituisce la posizione del nodo nell'ordine di contrazione
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo
+ * @return Rango del nodo, NO_NODE se il nodo non esiste
+ */
+template <class TLinkWeight>
+uint32_t ContractionHierarchy<TLinkWeight>::getRank(const GraphNode& node) const
+{
+    if (node.getId() >= this->_size)
+    {
+        return NO_NODE;
+    }
+
+    return this->_ranks[node.getId()];
+}
+
+/**
+ * Calcola la lunghezza del cammino minimo da source a target, senza ricostruirlo
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param source : Nodo sorgente
+ * @param target : Nodo di arrivo
+ * @return Distanza da source a target, il massimo valore di TLinkWeight se target non e' raggiungibile
+ */
+template <class TLinkWeight>
+TLinkWeight ContractionHierarchy<TLinkWeight>::getDistance(const GraphNode& source, const GraphNode& target)
+{
+    TLinkWeight best;
+
+    this->_path.clear();
+    this->_search(source.getId(), target.getId(), best);
+
+    return best;
+}
+
+/**
+ * Calcola il cammino minimo da source a target, espandendo le scorciatoie
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param source : Nodo sorgente
+ * @param target : Nodo di arrivo
+ * @return Cammino minimo, non trovato se target non e' raggiungibile; valido fino alla prossima interrogazione
+ */
+template <class TLinkWeight>
+const typename ContractionHierarchy<TLinkWeight>::Path& ContractionHierarchy<TLinkWeight>::run(const GraphNode& source, const GraphNode& target)
+{
+    TLinkWeight best;
+
+    this->_path.clear();
+    uint32_t meeting = this->_search(source.getId(), target.getId(), best);
+
+    if (meeting == NO_NODE)
+    {
+        return this->_path;
+    }
+
+    // Archi dalla sorgente al nodo d'incontro, raccolti risalendo i padri e poi invertiti
+    this->_route.clear();
+
+    for (uint32_t x = meeting; this->_trees[_FORWARD].getTentativeParent(x) != Tree::NO_PARENT; )
+    {
+        HierarchyEdge edge;
+
+        edge.from = this->_trees[_FORWARD].getTentativeParent(x);
+        edge.to = x;
+        edge.via = this->_vias[_FORWARD][this->_parentEdges[_FORWARD][x]];
+
+        this->_route.push_back(edge);
+        x = edge.from;
+    }
+
+    std::reverse(this->_route.begin(), this->_route.end());
+
+    // Archi dal nodo d'incontro alla destinazione, gia' nell'ordine del cammino
+    for (uint32_t x = meeting; this->_trees[_BACKWARD].getTentativeParent(x) != Tree::NO_PARENT; )
+    {
+        HierarchyEdge edge;
+
+        edge.from = x;
+        edge.to = this->_trees[_BACKWARD].getTentativeParent(x);
+        edge.via = this->_vias[_BACKWARD][this->_parentEdges[_BACKWARD][x]];
+
+        this->_route.push_back(edge);
+        x = edge.to;
+    }
+
+    this->_path.append(source.getId());
+
+    for (std::size_t i = 0; i < this->_route.size(); i++)
+    {
+        this->_unpack(this->_route[i]);
+    }
+
+    this->_path.setCost(best);
+
+    return this->_path;
+}
+
+/**
+ * Restituisce il cammino trovato dall'ultima chiamata di run()
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Cammino minimo
+ */
+template <class TLinkWeight>
+const typename ContractionHierarchy<TLinkWeight>::Path& ContractionHierarchy<TLinkWeight>::getPath() const
+{
+    return this->_path;
+}
+
+/**
+ * Restituisce il numero di nodi etichettati dalle due ricerche nell'ultima interrogazione
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di nodi etichettati
+ */
+template <class TLinkWeight>
+uint32_t ContractionHierarchy<TLinkWeight>::getSettledAmount() const
+{
+    return this->_settledAmount;
+}
+
+/**
+ * Scrive l'indice sullo stream, in formato binario. Lo stream va aperto in modalita' binaria.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param out : Stream su cui scrivere
+ * @return True se la scrittura e' riuscita, altrimenti false
+ */
+template <class TLinkWeight>
+bool ContractionHierarchy<TLinkWeight>::save(std::ostream& out) const
+{
+    uint32_t header[4] = { _MAGIC, _VERSION, (uint32_t) sizeof(TLinkWeight), this->_size };
+    uint64_t amounts[3] = { this->_shortcutAmount, this->_heads[_FORWARD].size(), this->_heads[_BACKWARD].size() };
+
+    out.write((const char*) header, sizeof(header));
+    out.write((const char*) amounts, sizeof(amounts));
+
+    ContractionHierarchy<TLinkWeight>::_write(out, this->_ranks);
+
+    for (uint32_t side = _FORWARD; side <= _BACKWARD; side++)
+    {
+        ContractionHierarchy<TLinkWeight>::_write(out, this->_offsets[side]);
+        ContractionHierarchy<TLinkWeight>::_write(out, this->_heads[side]);
+        ContractionHierarchy<TLinkWeight>::_write(out, this->_weights[side]);
+        ContractionHierarchy<TLinkWeight>::_write(out, this->_vias[side]);
+    }
+
+    return out.good();
+}
+
+/**
+ * Legge dallo stream un indice scritto da save(), sostituendo quello attuale. Se il
+ * contenuto non e' valido (formato, versione o tipo del peso diversi, dati incoerenti,
+ * ranghi o scorciatoie che non rispettano la gerarchia), l'indice resta vuoto.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param in : Stream da cui leggere, aperto in modalita' binaria
+ * @return True se la lettura e' riuscita, altrimenti false
+ */
+template <class TLinkWeight>
+bool ContractionHierarchy<TLinkWeight>::load(std::istream& in)
+{
+    uint32_t header[4];
+    uint64_t amounts[3];
+
+    this->_reset();
+
+    in.read((char*) header, sizeof(header));
+    in.read((char*) amounts, sizeof(amounts));
+
+    if (!in.good() || header[0] != _MAGIC || header[1] != _VERSION || header[2] != sizeof(TLinkWeight))
+    {
+        return false;
+    }
+
+    uint32_t size = header[3];
+    ContractionHierarchy<TLinkWeight> loaded;
+
+    loaded._size = size;
+    loaded._shortcutAmount = amounts[0];
+
+    bool valid = ContractionHierarchy<TLinkWeight>::_read(in, loaded._ranks, size);
+
+    for (uint32_t side = _FORWARD; side <= _BACKWARD && valid; side++)
+    {
+        uint64_t edges = amounts[1 + side];
+
+        valid = ContractionHierarchy<TLinkWeight>::_read(in, loaded._offsets[side], (uint64_t) size + 1) &&
+                ContractionHierarchy<TLinkWeight>::_read(in, loaded._heads[side], edges) &&
+                ContractionHierarchy<TLinkWeight>::_read(in, loaded._weights[side], edges) &&
+                ContractionHierarchy<TLinkWeight>::_read(in, loaded._vias[side], edges);
+
+        // Gli offset devono essere crescenti e gli estremi degli archi dei nodi validi
+        valid = valid && loaded._offsets[side][0] == 0 && loaded._offsets[side][size] == edges;
+
+        for (uint32_t u = 0; u < size && valid; u++)
+        {
+            valid = loaded._offsets[side][u] <= loaded._offsets[side][u + 1];
+        }
+    }
+
+    // Se le sezioni non sono state lette per intero size non e' affidabile
+    if (!valid)
+    {
+        return false;
+    }
+
+    // I ranghi dei nodi attivi devono essere una permutazione di 0, ..., k - 1
+    std::vector<bool> ranked(size, false);
+    uint32_t rankedAmount = 0;
+
+    for (uint32_t u = 0; u < size && valid; u++)
+    {
+        uint32_t rank = loaded._ranks[u];
+
+        if (rank != NO_NODE)
+        {
+            valid = rank < size && !ranked[rank];
+            ranked[rank] = valid;
+            rankedAmount++;
+        }
+    }
+
+    for (uint32_t u = 0; u < size && valid; u++)
+    {
+        valid = loaded._ranks[u] < rankedAmount || loaded._ranks[u] == NO_NODE;
+    }
+
+    // Ogni arco e' salvato nel suo estremo di rango minore e ogni scorciatoia salta un nodo
+    // di rango ancora minore: l'espansione dei cammini in _unpack scende di rango e termina
+    for (uint32_t side = _FORWARD; side <= _BACKWARD && valid; side++)
+    {
+        for (uint32_t u = 0; u < size && valid; u++)
+        {
+            for (uint64_t e = loaded._offsets[side][u]; e < loaded._offsets[side][u + 1] && valid; e++)
+            {
+                uint32_t head = loaded._heads[side][e];
+                uint32_t via = loaded._vias[side][e];
+
+                valid = head < size && loaded._ranks[u] != NO_NODE && loaded._ranks[head] != NO_NODE &&
+                        loaded._ranks[u] < loaded._ranks[head];
+
+                valid = valid && (via == NO_NODE || (via < size && via != u && via != head &&
+                        loaded._ranks[via] != NO_NODE && loaded._ranks[via] < loaded._ranks[u]));
+            }
+        }
+    }
+
+    if (!valid)
+    {
+        return false;
+    }
+
+    this->_size = loaded._size;
+    this->_shortcutAmount = loaded._shortcutAmount;
+    this->_ranks.swap(loaded._ranks);
+
+    for (uint32_t side = _FORWARD; side <= _BACKWARD; side++)
+    {
+        this->_offsets[side].swap(loaded._offsets[side]);
+        this->_heads[side].swap(loaded._heads[side]);
+        this->_weights[side].swap(loaded._weights[side]);
+        this->_vias[side].swap(loaded._vias[side]);
+    }
+
+    return true;
+}
+
+
+/**
+ * Svuota l'indice
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+void ContractionHierarchy<TLinkWeight>::_reset()
+{
+    this->_size = 0;
+    this->_shortcutAmount = 0;
+    this->_ranks.clear();
+
+    for (uint32_t side = _FORWARD; side <= _BACKWARD; side++)
+    {
+        this->_offsets[side].assign(1, 0);
+        this->_heads[side].clear();
+        this->_weights[side].clear();
+        this->_vias[side].clear();
+        this->_touched[side].clear();
+    }
+
+    this->_path.clear();
+    this->_settledAmount = 0;
+}
+
+/**
+ * Prepara le strutture delle ricerche per una nuova interrogazione. Se le dimensioni
+ * dell'indice non sono cambiate, vengono ripristinati solo i nodi toccati dalla precedente.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+void ContractionHierarchy<TLinkWeight>::_prepare()
+{
+    for (uint32_t side = _FORWARD; side <= _BACKWARD; side++)
+    {
+        if (this->_trees[side].getSize() != this->_size)
+        {
+            this->_trees[side].resize(this->_size);
+            this->_handles[side].assign(this->_size, Queue::NULL_HANDLE);
+            this->_parentEdges[side].resize(this->_size);
+        }
+
+        else
+        {
+            for (std::size_t i = 0; i < this->_touched[side].size(); i++)
+            {
+                this->_trees[side].reset(this->_touched[side][i]);
+                this->_handles[side][this->_touched[side][i]] = Queue::NULL_HANDLE;
+            }
+        }
+
+        this->_touched[side].clear();
+        this->_queues[side].clear();
+    }
+
+    this->_settledAmount = 0;
+}
+
+/**
+ * Esegue le due ricerche verso l'alto da source e da target
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param source : Id della sorgente
+ * @param target : Id della destinazione
+ * @param best : Lunghezza del cammino minimo, infinita se non esiste
+ * @return Nodo d'incontro delle due ricerche sul cammino minimo, NO_NODE se non esiste
+ */
+template <class TLinkWeight>
+uint32_t ContractionHierarchy<TLinkWeight>::_search(uint32_t source, uint32_t target, TLinkWeight& best)
+{
+    this->_prepare();
+    best = Tree::infinity();
+
+    if (source >= this->_size || target >= this->_size ||
+        this->_ranks[source] == NO_NODE || this->_ranks[target] == NO_NODE)
+    {
+        return NO_NODE;
+    }
+
+    uint32_t ends[2] = { source, target };
+    DijkstraEntry<TLinkWeight> entry;
+
+    for (uint32_t side = _FORWARD; side <= _BACKWARD; side++)
+    {
+        this->_trees[side].setSource(ends[side]);
+        this->_trees[side].setDistance(ends[side], TLinkWeight(), Tree::NO_PARENT);
+        this->_touched[side].push_back(ends[side]);
+
+        entry.distance = TLinkWeight();
+        entry.node = ends[side];
+        this->_handles[side][ends[side]] = this->_queues[side].push(entry);
+    }
+
+    uint32_t meeting = NO_NODE;
+
+    // Una ricerca si ferma quando la sua coda e' vuota o il suo minimo non migliora best
+    while (true)
+    {
+        bool forward = !this->_queues[_FORWARD].isEmpty() && this->_queues[_FORWARD].min().distance < best;
+        bool backward = !this->_queues[_BACKWARD].isEmpty() && this->_queues[_BACKWARD].min().distance < best;
+
+        if (!forward && !backward)
+        {
+            break;
+        }
+
+        if (forward && (!backward || !(this->_queues[_BACKWARD].min().distance < this->_queues[_FORWARD].min().distance)))
+        {
+            this->_settle(_FORWARD, best, meeting);
+        }
+
+        else
+        {
+            this->_settle(_BACKWARD, best, meeting);
+        }
+    }
+
+    return meeting;
+}
+
+/**
+ * Estrae il nodo in testa alla coda di una ricerca, aggiorna il miglior cammino se il nodo
+ * e' gia' stato raggiunto dall'altra ricerca e, se non e' bloccato, ne rilassa gli archi.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param side : Ricerca da far avanzare
+ * @param best : Lunghezza del miglior cammino trovato
+ * @param meeting : Nodo d'incontro del miglior cammino trovato
+ */
+template <class TLinkWeight>
+void ContractionHierarchy<TLinkWeight>::_settle(uint32_t side, TLinkWeight& best, uint32_t& meeting)
+{
+    Tree& tree = this->_trees[side];
+    Queue& queue = this->_queues[side];
+    uint32_t u = queue.min().node;
+    TLinkWeight distanceU = queue.min().distance;
+
+    queue.deleteMin();
+    this->_handles[side][u] = Queue::NULL_HANDLE;
+    tree.settle(u);
+    this->_settledAmount++;
+
+    TLinkWeight other = this->_trees[1 - side].getTentativeDistance(u);
+
+    if (other != Tree::infinity() && distanceU + other < best)
+    {
+        best = distanceU + other;
+        meeting = u;
+    }
+
+    // Stall-on-demand: gli archi dell'altro grafo di ricerca arrivano ad u da nodi di rango
+    // maggiore; se uno di questi offre una distanza migliore, u non e' sul cammino minimo
+    uint32_t opposite = 1 - side;
+
+    for (uint64_t e = this->_offsets[opposite][u]; e < this->_offsets[opposite][u + 1]; e++)
+    {
+        TLinkWeight higher = tree.getTentativeDistance(this->_heads[opposite][e]);
+
+        if (higher != Tree::infinity() && higher + this->_weights[opposite][e] < distanceU)
+        {
+            return;
+        }
+    }
+
+    DijkstraEntry<TLinkWeight> entry;
+
+    for (uint64_t e = this->_offsets[side][u]; e < this->_offsets[side][u + 1]; e++)
+    {
+        uint32_t v = this->_heads[side][e];
+
+        if (tree.isReachable(v))
+        {
+            continue;
+        }
+
+        TLinkWeight candidate = distanceU + this->_weights[side][e];
+        TLinkWeight current = tree.getTentativeDistance(v);
+
+        if (candidate < current)
+        {
+            if (current == Tree::infinity())
+            {
+                this->_touched[side].push_back(v);
+            }
+
+            tree.setDistance(v, candidate, u);
+            this->_parentEdges[side][v] = e;
+
+            entry.distance = candidate;
+            entry.node = v;
+
+            if (this->_handles[side][v] == Queue::NULL_HANDLE)
+            {
+                this->_handles[side][v] = queue.push(entry);
+            }
+
+            else
+            {
+                queue.decreaseKey(this->_handles[side][v], entry);
+            }
+        }
+    }
+}
+
+/**
+ * Cerca fra gli archi del nodo, nel grafo di ricerca dato, quello con estremo head e
+ * ne restituisce il nodo saltato
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param side : Grafo di ricerca
+ * @param node : Nodo di rango minore, in cui e' salvato l'arco
+ * @param head : Estremo di rango maggiore dell'arco
+ * @return Nodo saltato dall'arco, NO_NODE se e' un arco originale
+ */
+template <class TLinkWeight>
+uint32_t ContractionHierarchy<TLinkWeight>::_findVia(uint32_t side, uint32_t node, uint32_t head) const
+{
+    for (uint64_t e = this->_offsets[side][node]; e < this->_offsets[side][node + 1]; e++)
+    {
+        if (this->_heads[side][e] == head)
+        {
+            return this->_vias[side][e];
+        }
+    }
+
+    return NO_NODE;
+}
+
+/**
+ * Aggiunge al cammino i nodi di un arco, escluso il nodo di partenza. Una scorciatoia
+ * from --> to che salta via viene sostituita dagli archi from --> via e via --> to, che
+ * sono salvati nel nodo via perche' ha rango minore di entrambi gli estremi.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param edge : Arco da espandere
+ */
+template <class TLinkWeight>
+void ContractionHierarchy<TLinkWeight>::_unpack(const HierarchyEdge& edge)
+{
+    this->_stack.clear();
+    this->_stack.push_back(edge);
+
+    while (!this->_stack.empty())
+    {
+        HierarchyEdge current = this->_stack.back();
+        this->_stack.pop_back();
+
+        if (current.via == NO_NODE)
+        {
+            this->_path.append(current.to);
+            continue;
+        }
+
+        HierarchyEdge first;
+        HierarchyEdge second;
+
+        first.from = current.from;
+        first.to = current.via;
+        first.via = this->_findVia(_BACKWARD, current.via, current.from);
+
+        second.from = current.via;
+        second.to = current.to;
+        second.via = this->_findVia(_FORWARD, current.via, current.to);
+
+        // Lo stack estrae prima l'ultimo inserito
+        this->_stack.push_back(second);
+        this->_stack.push_back(first);
+    }
+}
+
+/**
+ * Scrive su uno stream gli elementi di un vettore
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @tparam T : Tipo aritmetico degli elementi
+ * @param out : Stream su cui scrivere
+ * @param values : Elementi da scrivere
+ */
+template <class TLinkWeight>
+template <class T>
+void ContractionHierarchy<TLinkWeight>::_write(std::ostream& out, const std::vector<T>& values)
+{
+    if (!values.empty())
+    {
+        out.write((const char*) values.data(), (std::streamsize) (values.size() * sizeof(T)));
+    }
+}
+
+/**
+ * Legge da uno stream amount elementi in un vettore
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @tparam T : Tipo aritmetico degli elementi
+ * @param in : Stream da cui leggere
+ * @param values : Vettore in cui leggere gli elementi
+ * @param amount : Numero di elementi da leggere
+ * @return True se la lettura e' riuscita, altrimenti false
+ */
+template <class TLinkWeight>
+template <class T>
+bool ContractionHierarchy<TLinkWeight>::_read(std::istream& in, std::vector<T>& values, uint64_t amount)
+{
+    // Legge a blocchi, cosi' che un file troncato non causi un'allocazione enorme
+    const uint64_t block = 1 << 16;
+
+    values.clear();
+
+    for (uint64_t done = 0; done < amount; )
+    {
+        uint64_t now = std::min(block, amount - done);
+
+        values.resize(done + now);
+        in.read((char*) (values.data() + done), (std::streamsize) (now * sizeof(T)));
+
+        if (!in.good())
+        {
+            return false;
+        }
+
+        done += now;
+    }
+
+    return true;
+}
+
+#endif // _CONTRACTIONHIERARCHY_H
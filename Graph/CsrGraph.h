@@ -0,0 +1,792 @@
+#ifndef _CSRGRAPH_H
+#define _CSRGRAPH_H
+
+#include "Graph.h"
+
+#include <vector>
+
+/**
+ * Classe che descrive un grafo pesato e orientato nel formato Compressed Sparse Row (CSR).
+ *
+ * Gli archi uscenti di tutti i nodi sono memorizzati uno dopo l'altro in due array
+ * paralleli (nodi di arrivo e pesi), ordinati per nodo di partenza e, a parita' di
+ * partenza, per nodo di arrivo. L'array degli offset indica per ogni nodo i dove
+ * iniziano i suoi archi: gli archi uscenti da i occupano le posizioni da offsets[i]
+ * a offsets[i + 1] escluso.
+ *
+ *   offsets:  0  2  3  3              nodo 0 --> 1 (w=4), 2 (w=1)
+ *   targets:  1  2  2                 nodo 1 --> 2 (w=7)
+ *   weights:  4  1  7                 nodo 2 --> nessuno
+ *
+ * Gli archi entranti sono memorizzati allo stesso modo in un secondo indice trasposto,
+ * cosi' che anche la scansione dei predecessori di un nodo costi quanto il suo grado.
+ *
+ * La memoria occupata e' O(V + E) invece di O(V^2) e la scansione dei vicini di un nodo
+ * costa quanto il suo grado. In cambio la struttura degli archi e' immutabile: il grafo
+ * si ottiene "congelando" un Graph gia' costruito e gli id dei nodi restano gli stessi,
+ * oppure direttamente da una lista di archi su file con EdgeListLoader.
+ * E' possibile modificare etichette e pesi, ma non aggiungere o togliere nodi e archi.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+class CsrGraph : public IGraph<GraphNode, TNodeLabel, Link<GraphNode>, TLinkWeight>
+{
+    public:
+        typedef ::Link<GraphNode> Link;
+        typedef LinkedList<uint32_t> GraphNodeList;
+        typedef TNodeLabel NodeLabel;
+        typedef TLinkWeight LinkWeight;
+        typedef LinkRange< CsrLinkIterator<TLinkWeight> > OutLinkRange;
+        typedef LinkRange< CsrLinkIterator<TLinkWeight> > InLinkRange;
+
+        template <class TypeNodeLabel, class TypeLinkWeight>
+        friend class EdgeListLoader;
+
+    private:
+        static const uint64_t _NO_LINK = UINT64_MAX; // Posizione di un arco inesistente
+
+        uint32_t _gSize; // Numero di id di nodo gestiti dal grafo
+        uint32_t _nodeAmount; // Numero di nodi attivi nel grafo
+        uint32_t _linkAmount; // Numero di archi nel grafo
+
+        std::vector<bool> _enabled; // Se true, il nodo con quell'id e' attivo
+        std::vector<TNodeLabel> _labels; // Etichetta di ogni nodo
+        std::vector<uint64_t> _offsets; // Inizio degli archi uscenti di ogni nodo, lungo _gSize + 1
+        std::vector<uint32_t> _targets; // Nodo di arrivo di ogni arco
+        std::vector<TLinkWeight> _weights; // Peso di ogni arco
+
+        std::vector<uint64_t> _inOffsets; // Inizio degli archi entranti di ogni nodo, lungo _gSize + 1
+        std::vector<uint32_t> _inSources; // Nodo di partenza di ogni arco entrante
+        std::vector<TLinkWeight> _inWeights; // Peso di ogni arco entrante
+
+    private:
+        uint64_t _findLink(uint32_t fromId, uint32_t toId) const;
+        uint64_t _findInLink(uint32_t fromId, uint32_t toId) const;
+        void _buildInLinks();
+
+    public:
+        CsrGraph();
+        CsrGraph(const Graph<TNodeLabel, TLinkWeight>& graph);
+
+        uint32_t getNodeAmount() const;
+        uint32_t getLinkAmount() const;
+        uint32_t getMaxNodeAmount() const;
+
+        void create();
+
+        bool isEmpty() const;
+        bool isNodeEnabled(const GraphNode& node) const;
+        bool isLinkActive(const GraphNode& from, const GraphNode& to) const;
+
+        TNodeLabel getLabel(const GraphNode& node) const;
+        TLinkWeight getWeight(const GraphNode& from, const GraphNode& to) const;
+
+        void addNode(GraphNode& node, TNodeLabel label);
+        void addNode(GraphNode& node);
+        void addLink(GraphNode& from, GraphNode& to, TLinkWeight weight);
+
+        void eraseNode(GraphNode& node);
+        void eraseLink(GraphNode& from, GraphNode& to);
+
+        void setLabel(GraphNode& node, TNodeLabel label);
+        void setWeight(GraphNode& from, GraphNode& to, TLinkWeight weight);
+
+        GraphNodeList getAdjacentToANode(const GraphNode& node) const;
+        GraphNodeList getAdjacentFromANode(const GraphNode& node) const;
+
+        OutLinkRange getOutLinks(const GraphNode& node) const;
+        InLinkRange getInLinks(const GraphNode& node) const;
+
+        uint32_t getDegreeTo(const GraphNode& node) const;
+        uint32_t getDegreeFrom(const GraphNode& node) const;
+
+        GraphNodeList getAdjacentNode(const GraphNode& node) const;
+        GraphNodeList getAllNodes() const;
+
+        template <class TypeNodeLabel, class TypeLinkWeight>
+        friend std::ostream& operator<<(std::ostream&, const CsrGraph<TypeNodeLabel, TypeLinkWeight>& graph);
+};
+
+
+/**
+ * Crea un grafo compresso vuoto
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+CsrGraph<TNodeLabel, TLinkWeight>::CsrGraph()
+{
+    this->_gSize = 0;
+    this->_nodeAmount = 0;
+    this->_linkAmount = 0;
+    this->_offsets.assign(1, 0);
+    this->_inOffsets.assign(1, 0);
+}
+
+/**
+ * Congela un grafo con matrice di adiacenza nel formato CSR.
+ * Gli id dei nodi, le etichette e i pesi vengono conservati.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param graph : Grafo da congelare
+ */
+template <class TNodeLabel, class TLinkWeight>
+CsrGraph<TNodeLabel, TLinkWeight>::CsrGraph(const Graph<TNodeLabel, TLinkWeight>& graph)
+{
+    this->_gSize = graph._gSize;
+    this->_nodeAmount = 0;
+    this->_linkAmount = 0;
+
+    this->_enabled.assign(this->_gSize, false);
+    this->_labels.resize(this->_gSize);
+    this->_offsets.assign(this->_gSize + 1, 0);
+
+    // Prima passata: conto gli archi uscenti di ogni nodo per calcolare gli offset
+    for (uint32_t i = 0; i < this->_gSize; i++)
+    {
+        this->_offsets[i + 1] = this->_offsets[i];
+
+        if (!graph._adjacencyMatrixRows[i].isEnabled)
+        {
+            continue;
+        }
+
+        this->_enabled[i] = true;
+        this->_labels[i] = graph._adjacencyMatrixRows[i].label;
+        this->_nodeAmount++;
+
+        const LinkInfo<TLinkWeight>* row = graph._adjacencyMatrixRows[i].adjacencyMatrixCols;
+
+        for (uint32_t j = 0; j < this->_gSize; j++)
+        {
+            if (row[j].linkExists)
+            {
+                this->_offsets[i + 1]++;
+            }
+        }
+    }
+
+    this->_linkAmount = (uint32_t) this->_offsets[this->_gSize];
+    this->_targets.resize(this->_linkAmount);
+    this->_weights.resize(this->_linkAmount);
+
+    // Seconda passata: copio gli archi, che risultano gia' ordinati per nodo di arrivo
+    for (uint32_t i = 0; i < this->_gSize; i++)
+    {
+        if (!this->_enabled[i])
+        {
+            continue;
+        }
+
+        const LinkInfo<TLinkWeight>* row = graph._adjacencyMatrixRows[i].adjacencyMatrixCols;
+        uint64_t pos = this->_offsets[i];
+
+        for (uint32_t j = 0; j < this->_gSize; j++)
+        {
+            if (row[j].linkExists)
+            {
+                this->_targets[pos] = j;
+                this->_weights[pos] = row[j].weight;
+                pos++;
+            }
+        }
+    }
+
+    this->_buildInLinks();
+}
+
+/**
+ * Restituisce il numero di nodi attualmente presente nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di nodi presenti nel grafo
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t CsrGraph<TNodeLabel, TLinkWeight>::getNodeAmount() const
+{
+    return this->_nodeAmount;
+}
+
+/**
+ * Restituisce il numero di archi attualmente presente nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di archi presenti nel grafo
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t CsrGraph<TNodeLabel, TLinkWeight>::getLinkAmount() const
+{
+    return this->_linkAmount;
+}
+
+
+/**
+ * Restituisce il numero di id di nodo gestiti dal grafo. Gli id dei nodi
+ * sono compresi fra 0 e questo valore escluso.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero massimo di nodi
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t CsrGraph<TNodeLabel, TLinkWeight>::getMaxNodeAmount() const
+{
+    return this->_gSize;
+}
+
+
+template <class TNodeLabel, class TLinkWeight>
+void CsrGraph<TNodeLabel, TLinkWeight>::create() { }
+
+
+/**
+ * Restituisce true se il grafo e' vuoto, altrimenti false.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return True se il grafo e' vuoto, altrimenti false.
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool CsrGraph<TNodeLabel, TLinkWeight>::isEmpty() const
+{
+    return (this->_nodeAmount == 0);
+}
+
+/**
+ * Restituisce true se il nodo e' attivo, altrimenti false.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da verificare
+ * @return True se il nodo e' attivo, altrimenti false.
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool CsrGraph<TNodeLabel, TLinkWeight>::isNodeEnabled(const GraphNode& node) const
+{
+    uint32_t id = node.getId();
+
+    return (id < this->_gSize && this->_enabled[id]);
+}
+
+/**
+ * Restituisce true se l'arco e' attivo, altrimenti false.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from : Nodo di partenza
+ * @param to: Nodo di arrivo
+ * @return True se l'arco e' attivo, altrimenti false.
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool CsrGraph<TNodeLabel, TLinkWeight>::isLinkActive(const GraphNode& from, const GraphNode& to) const
+{
+    if (!this->isNodeEnabled(from) || !this->isNodeEnabled(to))
+    {
+        return false;
+    }
+
+    return (this->_findLink(from.getId(), to.getId()) != _NO_LINK);
+}
+
+/**
+ * Restituisce l'etichetta contenuta nel nodo, oppure un'etichetta vuota se il nodo non e' attivo.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo a cui leggere l'etichetta
+ * @return Etichetta del nodo.
+ */
+template <class TNodeLabel, class TLinkWeight>
+TNodeLabel CsrGraph<TNodeLabel, TLinkWeight>::getLabel(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return TNodeLabel();
+    }
+
+    return this->_labels[node.getId()];
+}
+
+/**
+ * Restituisce il peso dell'arco, oppure un peso vuoto se l'arco non esiste.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from: Nodo di partenza
+ * @param to: Nodo di arrivo
+ * @return Peso dell'arco che va da from a to
+ */
+template <class TNodeLabel, class TLinkWeight>
+TLinkWeight CsrGraph<TNodeLabel, TLinkWeight>::getWeight(const GraphNode& from, const GraphNode& to) const
+{
+    if (!this->isNodeEnabled(from) || !this->isNodeEnabled(to))
+    {
+        return TLinkWeight();
+    }
+
+    uint64_t pos = this->_findLink(from.getId(), to.getId());
+
+    if (pos == _NO_LINK)
+    {
+        return TLinkWeight();
+    }
+
+    return this->_weights[pos];
+}
+
+
+/**
+ * Operazione non ammessa: la struttura del grafo compresso e' immutabile.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da aggiungere
+ * @param label : Etichetta del nodo
+ */
+template <class TNodeLabel, class TLinkWeight>
+void CsrGraph<TNodeLabel, TLinkWeight>::addNode(GraphNode& node, TNodeLabel label) { }
+
+/**
+ * Operazione non ammessa: la struttura del grafo compresso e' immutabile.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da aggiungere
+ */
+template <class TNodeLabel, class TLinkWeight>
+void CsrGraph<TNodeLabel, TLinkWeight>::addNode(GraphNode& node) { }
+
+/**
+ * Operazione non ammessa: la struttura del grafo compresso e' immutabile.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @param weight : Peso arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void CsrGraph<TNodeLabel, TLinkWeight>::addLink(GraphNode& from, GraphNode& to, TLinkWeight weight) { }
+
+/**
+ * Operazione non ammessa: la struttura del grafo compresso e' immutabile.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da cancellare
+ */
+template <class TNodeLabel, class TLinkWeight>
+void CsrGraph<TNodeLabel, TLinkWeight>::eraseNode(GraphNode& node) { }
+
+/**
+ * Operazione non ammessa: la struttura del grafo compresso e' immutabile.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ */
+template <class TNodeLabel, class TLinkWeight>
+void CsrGraph<TNodeLabel, TLinkWeight>::eraseLink(GraphNode& from, GraphNode& to) { }
+
+
+/**
+ * Imposta un'etichetta ad un nodo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo a cui aggiungere un'etichetta
+ * @param label : Etichetta da aggiungere
+ */
+template <class TNodeLabel, class TLinkWeight>
+void CsrGraph<TNodeLabel, TLinkWeight>::setLabel(GraphNode& node, TNodeLabel label)
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return;
+    }
+
+    this->_labels[node.getId()] = label;
+}
+
+/**
+ * Imposta il peso di un arco esistente
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @param weight : Peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void CsrGraph<TNodeLabel, TLinkWeight>::setWeight(GraphNode& from, GraphNode& to, TLinkWeight weight)
+{
+    if (!this->isNodeEnabled(from) || !this->isNodeEnabled(to))
+    {
+        return;
+    }
+
+    if (weight < 0)
+    {
+        return;
+    }
+
+    uint64_t pos = this->_findLink(from.getId(), to.getId());
+
+    if (pos != _NO_LINK)
+    {
+        this->_weights[pos] = weight;
+        this->_inWeights[this->_findInLink(from.getId(), to.getId())] = weight;
+    }
+}
+
+/**
+ * Restituisce una lista di id di nodi che sono puntati da node.
+ * Se node non esiste, allora restituisce una lista vuota.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da cui ricavare la lista
+ * @return Lista di id di nodi che sono puntati da node
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename CsrGraph<TNodeLabel, TLinkWeight>::GraphNodeList CsrGraph<TNodeLabel, TLinkWeight>::getAdjacentToANode(const GraphNode& node) const
+{
+    GraphNodeList nodes;
+
+    if (!this->isNodeEnabled(node))
+    {
+        return nodes;
+    }
+
+    uint32_t id = node.getId();
+
+    for (uint64_t pos = this->_offsets[id]; pos < this->_offsets[id + 1]; pos++)
+    {
+        nodes.append(this->_targets[pos]);
+    }
+
+    return nodes;
+}
+
+/**
+ * Restituisce una lista di id di nodi che puntano a node.
+ * Se node non esiste, allora restituisce una lista vuota.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da cui ricavare la lista
+ * @return Lista di id di nodi che puntano a node
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename CsrGraph<TNodeLabel, TLinkWeight>::GraphNodeList CsrGraph<TNodeLabel, TLinkWeight>::getAdjacentFromANode(const GraphNode& node) const
+{
+    GraphNodeList nodes;
+
+    if (!this->isNodeEnabled(node))
+    {
+        return nodes;
+    }
+
+    uint32_t id = node.getId();
+
+    for (uint64_t pos = this->_inOffsets[id]; pos < this->_inOffsets[id + 1]; pos++)
+    {
+        nodes.append(this->_inSources[pos]);
+    }
+
+    return nodes;
+}
+
+/**
+ * Restituisce l'intervallo degli archi uscenti da node, senza allocare memoria.
+ * Se node non esiste, allora l'intervallo e' vuoto.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo di partenza
+ * @return Intervallo degli archi uscenti
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename CsrGraph<TNodeLabel, TLinkWeight>::OutLinkRange CsrGraph<TNodeLabel, TLinkWeight>::getOutLinks(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return OutLinkRange(CsrLinkIterator<TLinkWeight>(nullptr, nullptr), CsrLinkIterator<TLinkWeight>(nullptr, nullptr));
+    }
+
+    uint32_t id = node.getId();
+    uint64_t first = this->_offsets[id];
+    uint64_t last = this->_offsets[id + 1];
+
+    return OutLinkRange(CsrLinkIterator<TLinkWeight>(this->_targets.data() + first, this->_weights.data() + first),
+                        CsrLinkIterator<TLinkWeight>(this->_targets.data() + last, this->_weights.data() + last));
+}
+
+/**
+ * Restituisce l'intervallo degli archi entranti in node, senza allocare memoria.
+ * Se node non esiste, allora l'intervallo e' vuoto.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo di arrivo
+ * @return Intervallo degli archi entranti
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename CsrGraph<TNodeLabel, TLinkWeight>::InLinkRange CsrGraph<TNodeLabel, TLinkWeight>::getInLinks(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return InLinkRange(CsrLinkIterator<TLinkWeight>(nullptr, nullptr), CsrLinkIterator<TLinkWeight>(nullptr, nullptr));
+    }
+
+    uint32_t id = node.getId();
+    uint64_t first = this->_inOffsets[id];
+    uint64_t last = this->_inOffsets[id + 1];
+
+    return InLinkRange(CsrLinkIterator<TLinkWeight>(this->_inSources.data() + first, this->_inWeights.data() + first),
+                       CsrLinkIterator<TLinkWeight>(this->_inSources.data() + last, this->_inWeights.data() + last));
+}
+
+/**
+ * Restituisce il numero di archi uscenti dal nodo in tempo costante
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo a cui calcolare il numero di archi uscenti
+ * @return numero di archi uscenti dal nodo
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t CsrGraph<TNodeLabel, TLinkWeight>::getDegreeTo(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return 0;
+    }
+
+    uint32_t id = node.getId();
+
+    return (uint32_t) (this->_offsets[id + 1] - this->_offsets[id]);
+}
+
+/**
+ * Restituisce il numero di archi entranti nel nodo in tempo costante
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo a cui calcolare il numero di archi entranti
+ * @return numero di archi entranti nel nodo
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t CsrGraph<TNodeLabel, TLinkWeight>::getDegreeFrom(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return 0;
+    }
+
+    uint32_t id = node.getId();
+
+    return (uint32_t) (this->_inOffsets[id + 1] - this->_inOffsets[id]);
+}
+
+/**
+ * Restituisce una lista contenente tutti gli id dei nodi adiacenti a node
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo a cui trovare i suoi vicini
+ * @return Lista di id di nodi adiacenti a node
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename CsrGraph<TNodeLabel, TLinkWeight>::GraphNodeList CsrGraph<TNodeLabel, TLinkWeight>::getAdjacentNode(const GraphNode& node) const
+{
+    GraphNodeList adjacentNodes = this->getAdjacentToANode(node);
+
+    // Aggiungo i nodi entranti che non sono gia' stati inseriti come nodi uscenti
+    for (auto link : this->getInLinks(node))
+    {
+        if (this->_findLink(node.getId(), link.id) == _NO_LINK)
+        {
+            adjacentNodes.append(link.id);
+        }
+    }
+
+    return adjacentNodes;
+}
+
+/**
+ * Restituisce una lista contenente gli id di tutti i nodi presenti nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Lista degli id di tutti i nodi del grafo
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename CsrGraph<TNodeLabel, TLinkWeight>::GraphNodeList CsrGraph<TNodeLabel, TLinkWeight>::getAllNodes() const
+{
+    GraphNodeList nodes;
+
+    for (uint32_t i = 0; i < this->_gSize; i++)
+    {
+        if (this->_enabled[i])
+        {
+            nodes.append(i);
+        }
+    }
+
+    return nodes;
+}
+
+
+/**
+ * Cerca l'arco (fromId, toId) con una ricerca binaria tra gli archi uscenti di fromId.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param fromId : Id del nodo di partenza
+ * @param toId : Id del nodo di arrivo
+ * @return Posizione dell'arco negli array degli archi, oppure _NO_LINK
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint64_t CsrGraph<TNodeLabel, TLinkWeight>::_findLink(uint32_t fromId, uint32_t toId) const
+{
+    uint64_t low = this->_offsets[fromId];
+    uint64_t high = this->_offsets[fromId + 1];
+
+    while (low < high)
+    {
+        uint64_t middle = low + (high - low) / 2;
+
+        if (this->_targets[middle] < toId)
+        {
+            low = middle + 1;
+        }
+
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if (low < this->_offsets[fromId + 1] && this->_targets[low] == toId)
+    {
+        return low;
+    }
+
+    return _NO_LINK;
+}
+
+/**
+ * Cerca l'arco (fromId, toId) con una ricerca binaria tra gli archi entranti di toId,
+ * ordinati per nodo di partenza.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param fromId : Id del nodo di partenza
+ * @param toId : Id del nodo di arrivo
+ * @return Posizione dell'arco negli array degli archi entranti, oppure _NO_LINK
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint64_t CsrGraph<TNodeLabel, TLinkWeight>::_findInLink(uint32_t fromId, uint32_t toId) const
+{
+    uint64_t low = this->_inOffsets[toId];
+    uint64_t high = this->_inOffsets[toId + 1];
+
+    while (low < high)
+    {
+        uint64_t middle = low + (high - low) / 2;
+
+        if (this->_inSources[middle] < fromId)
+        {
+            low = middle + 1;
+        }
+
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if (low < this->_inOffsets[toId + 1] && this->_inSources[low] == fromId)
+    {
+        return low;
+    }
+
+    return _NO_LINK;
+}
+
+/**
+ * Costruisce l'indice trasposto degli archi entranti con un counting sort sui nodi
+ * di arrivo. Percorrendo i nodi di partenza in ordine crescente, gli archi entranti
+ * di ogni nodo risultano ordinati per nodo di partenza.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void CsrGraph<TNodeLabel, TLinkWeight>::_buildInLinks()
+{
+    this->_inOffsets.assign(this->_gSize + 1, 0);
+    this->_inSources.resize(this->_targets.size());
+    this->_inWeights.resize(this->_targets.size());
+
+    for (std::size_t pos = 0; pos < this->_targets.size(); pos++)
+    {
+        this->_inOffsets[this->_targets[pos] + 1]++;
+    }
+
+    for (uint32_t i = 0; i < this->_gSize; i++)
+    {
+        this->_inOffsets[i + 1] += this->_inOffsets[i];
+    }
+
+    std::vector<uint64_t> next(this->_inOffsets.begin(), this->_inOffsets.end() - 1);
+
+    for (uint32_t i = 0; i < this->_gSize; i++)
+    {
+        for (uint64_t pos = this->_offsets[i]; pos < this->_offsets[i + 1]; pos++)
+        {
+            uint64_t inPos = next[this->_targets[pos]]++;
+
+            this->_inSources[inPos] = i;
+            this->_inWeights[inPos] = this->_weights[pos];
+        }
+    }
+}
+
+
+template <class TypeNodeLabel, class TypeLinkWeight>
+std::ostream& operator<<(std::ostream& out, const CsrGraph<TypeNodeLabel, TypeLinkWeight>& graph)
+{
+    if(graph.isEmpty())
+    {
+        out << "[grafo vuoto]";
+        out << std::endl << std::endl;
+        return out;
+    }
+
+    for(uint32_t i = 0; i < graph._gSize; i++)
+    {
+        if(graph._enabled[i])
+        {
+            out << std::endl << "[" << i << ", " << graph._labels[i] << "]--->\t";
+
+            for(uint64_t pos = graph._offsets[i]; pos < graph._offsets[i + 1]; pos++)
+            {
+                out << "(" << graph._targets[pos] << ", " << graph._weights[pos] << ")\t";
+            }
+        }
+    }
+
+    out << std::endl << std::endl;
+    return out;
+}
+
+#endif // _CSRGRAPH_H
@@ -0,0 +1,735 @@
+#ifndef _DELTASTEPPING_H
+#define _DELTASTEPPING_H
+
+#include "Graph.h"
+#include "Dijkstra.h"
+#include "ShortestPathTree.h"
+#include "../Lib/ThreadPool.h"
+#include "../Lib/VisitedSet.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+/**
+ * Motore per il calcolo parallelo dei cammini minimi da una sorgente con l'algoritmo
+ * delta-stepping (Meyer e Sanders).
+ *
+ * I nodi sono raccolti in secchi di ampiezza delta per distanza provvisoria: il secchio i
+ * contiene i nodi con distanza in [i * delta, (i + 1) * delta). Il secchio non vuoto di
+ * indice minimo viene svuotato a fasi: in ogni fase i thread si dividono i suoi nodi e ne
+ * rilassano in parallelo gli archi leggeri (peso al piu' delta), che possono reinserire
+ * nodi nello stesso secchio. Quando il secchio resta vuoto le distanze dei suoi nodi sono
+ * definitive e vengono rilassati, una sola volta, i loro archi pesanti. Con delta piccolo
+ * l'algoritmo si avvicina a Dijkstra (poco lavoro, molte fasi), con delta grande a
+ * Bellman-Ford (molte fasi in meno, ma nodi rilassati piu' volte).
+ *
+ * Le distanze sono aggiornate con una CAS sul minimo e ogni thread inserisce i nodi
+ * migliorati nei propri secchi, quindi i thread non si sincronizzano all'interno di una
+ * fase. I secchi di ogni thread sono una finestra circolare di dimensione fissa, una
+ * potenza di due proporzionale al numero di thread: i nodi oltre la finestra finiscono in
+ * un secchio lontano e vengono ridistribuiti quando la finestra si sposta, cosi' la memoria
+ * non dipende dal rapporto fra peso massimo e delta. Fra una fase e l'altra la frontiera viene raccolta scartando i duplicati e i valori
+ * superati, cosi' che ogni fase lavori su distanze stabili.
+ *
+ * Le distanze coincidono con quelle di Dijkstra. Il padre di ogni nodo e' calcolato alla
+ * fine come il predecessore di id minimo lungo un cammino minimo (a pari distanza, fra
+ * quelli che l'hanno raggiunta in una fase precedente, per evitare cicli con archi di peso
+ * zero): l'albero non dipende dal numero di thread e coincide con quello di Dijkstra
+ * quando i cammini minimi sono unici. I predecessori si leggono con getInLinks, quindi la
+ * ricostruzione costa O(archi) su un grafo con indice degli archi entranti (CsrGraph) ma
+ * O(V^2) su Graph, che per ogni nodo scorre una colonna della matrice.
+ *
+ * Il peso massimo e il grado medio vengono calcolati alla creazione del motore: se il
+ * grafo viene modificato bisogna chiamare update() prima dell'esecuzione successiva.
+ *
+ * @tparam TGraph : Tipo del grafo, con pesi non negativi
+ */
+template <class TGraph>
+class DeltaStepping
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+        typedef ShortestPathTree<LinkWeight> Tree;
+        typedef DijkstraEntry<LinkWeight> Entry;
+
+        static const uint32_t NO_PARENT = Tree::NO_PARENT; // Padre della sorgente e dei nodi non raggiungibili
+
+    private:
+        static const uint32_t _GRAIN_ENTRIES = 256; // Nodi della frontiera per blocco di lavoro
+        static const uint32_t _GRAIN_NODES = 16384; // Nodi per blocco di inizializzazione
+        static const uint32_t _SLOTS_PER_THREAD = 16; // Secchi circolari della finestra per thread
+
+        const TGraph& _graph; // Grafo su cui calcolare i cammini
+        ThreadPool& _pool; // Thread su cui eseguire l'algoritmo
+        LinkWeight _maxWeight; // Peso massimo di un arco
+        LinkWeight _defaultDelta; // Ampiezza dei secchi stimata dal grafo
+        LinkWeight _delta; // Ampiezza dei secchi
+
+        std::vector< std::atomic<LinkWeight> > _tentative; // Distanza provvisoria di ogni nodo
+        std::vector< std::atomic<uint32_t> > _phases; // Fase in cui la distanza di ogni nodo e' stata abbassata l'ultima volta
+        std::vector< std::vector< std::vector<Entry> > > _buckets; // Secchi circolari di ogni thread
+        std::vector< std::vector<Entry> > _far; // Nodi oltre la finestra dei secchi circolari, per thread
+        uint64_t _windowEnd; // Primo secchio oltre la finestra
+        std::vector<Entry> _frontier; // Nodi della fase corrente, senza duplicati
+        std::vector<uint32_t> _settled; // Nodi del secchio corrente, di cui rilassare gli archi pesanti
+        VisitedSet _inFrontier; // Nodi gia' nella frontiera della fase corrente
+        VisitedSet _inSettled; // Nodi gia' presenti in _settled
+
+        std::vector<LinkWeight> _distances; // Distanza di ogni nodo nell'ultima esecuzione
+        std::vector<uint32_t> _parents; // Padre di ogni nodo nell'ultima esecuzione
+
+        uint32_t _source; // Sorgente dell'ultima esecuzione
+        uint32_t _reachedAmount; // Nodi raggiunti nell'ultima esecuzione
+        uint32_t _bucketAmount; // Secchi svuotati nell'ultima esecuzione
+        uint32_t _phaseAmount; // Fasi, leggere e pesanti, dell'ultima esecuzione
+
+    private:
+        uint64_t _bucketOf(LinkWeight distance) const;
+        void _reset();
+        bool _gather(uint64_t bucket);
+        bool _refill(uint64_t& bucket);
+        void _relax(bool light, uint32_t phase);
+        void _findParents();
+
+    public:
+        DeltaStepping(const TGraph& graph, ThreadPool& pool);
+
+        void update();
+        void setDelta(LinkWeight delta);
+        LinkWeight getDelta() const;
+
+        void run(const GraphNode& source);
+
+        const std::vector<LinkWeight>& getDistances() const;
+        const std::vector<uint32_t>& getParents() const;
+
+        LinkWeight getDistance(const GraphNode& node) const;
+        uint32_t getParent(const GraphNode& node) const;
+        bool isReachable(const GraphNode& node) const;
+
+        uint32_t getReachedAmount() const;
+        uint32_t getBucketAmount() const;
+        uint32_t getPhaseAmount() const;
+};
+
+template <class TGraph>
+const uint32_t DeltaStepping<TGraph>::NO_PARENT;
+
+template <class TGraph>
+const uint32_t DeltaStepping<TGraph>::_SLOTS_PER_THREAD;
+
+
+/**
+ * Crea un motore delta-stepping sul grafo dato, usando i thread di pool.
+ * Il grafo e il pool devono sopravvivere al motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo su cui calcolare i cammini minimi
+ * @param pool : Thread su cui eseguire l'algoritmo
+ */
+template <class TGraph>
+DeltaStepping<TGraph>::DeltaStepping(const TGraph& graph, ThreadPool& pool) : _graph(graph), _pool(pool)
+{
+    this->_source = NO_PARENT;
+    this->_windowEnd = 0;
+    this->_reachedAmount = 0;
+    this->_bucketAmount = 0;
+    this->_phaseAmount = 0;
+
+    this->update();
+    this->_delta = this->_defaultDelta;
+}
+
+/**
+ * Ricalcola in parallelo il peso massimo e il grado medio degli archi, da cui viene stimata
+ * l'ampiezza di default dei secchi (peso massimo diviso grado medio). Va chiamato se il
+ * grafo e' cambiato dopo la creazione del motore; l'ampiezza impostata con setDelta resta.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void DeltaStepping<TGraph>::update()
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+    uint32_t threads = this->_pool.getThreadAmount();
+    std::vector<LinkWeight> maxWeights(threads, LinkWeight());
+    std::vector<uint64_t> linkAmounts(threads, 0);
+    std::vector<uint32_t> nodeAmounts(threads, 0);
+
+    this->_pool.parallelFor(0, size, _GRAIN_NODES, [this, &maxWeights, &linkAmounts, &nodeAmounts](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t u = from; u < to; u++)
+        {
+            if (!this->_graph.isNodeEnabled(GraphNode(u)))
+            {
+                continue;
+            }
+
+            nodeAmounts[thread]++;
+
+            for (auto link : this->_graph.getOutLinks(GraphNode(u)))
+            {
+                linkAmounts[thread]++;
+
+                if (maxWeights[thread] < link.weight)
+                {
+                    maxWeights[thread] = link.weight;
+                }
+            }
+        }
+    });
+
+    uint64_t links = 0;
+    uint64_t nodes = 0;
+
+    this->_maxWeight = LinkWeight();
+
+    for (uint32_t t = 0; t < threads; t++)
+    {
+        links += linkAmounts[t];
+        nodes += nodeAmounts[t];
+
+        if (this->_maxWeight < maxWeights[t])
+        {
+            this->_maxWeight = maxWeights[t];
+        }
+    }
+
+    uint64_t averageDegree = (nodes == 0) ? 1 : (links + nodes - 1) / nodes;
+
+    this->_defaultDelta = (LinkWeight) (this->_maxWeight / (LinkWeight) (averageDegree == 0 ? 1 : averageDegree));
+
+    if (!(LinkWeight() < this->_defaultDelta))
+    {
+        this->_defaultDelta = (LinkWeight) 1;
+    }
+
+    if (this->_tentative.size() != size)
+    {
+        std::vector< std::atomic<LinkWeight> > tentative(size);
+        std::vector< std::atomic<uint32_t> > phases(size);
+
+        this->_tentative.swap(tentative);
+        this->_phases.swap(phases);
+    }
+}
+
+/**
+ * Imposta l'ampiezza dei secchi. Un valore non positivo ripristina quella stimata dal grafo.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param delta : Ampiezza dei secchi
+ */
+template <class TGraph>
+void DeltaStepping<TGraph>::setDelta(LinkWeight delta)
+{
+    this->_delta = (LinkWeight() < delta) ? delta : this->_defaultDelta;
+}
+
+/**
+ * Restituisce l'ampiezza dei secchi
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Ampiezza dei secchi
+ */
+template <class TGraph>
+typename DeltaStepping<TGraph>::LinkWeight DeltaStepping<TGraph>::getDelta() const
+{
+    return this->_delta;
+}
+
+/**
+ * Calcola le distanze minime da source a tutti i nodi e l'albero dei cammini minimi.
+ * I nodi non raggiungibili hanno distanza Tree::infinity() e padre NO_PARENT.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param source : Nodo sorgente
+ */
+template <class TGraph>
+void DeltaStepping<TGraph>::run(const GraphNode& source)
+{
+    this->_reset();
+
+    uint32_t size = (uint32_t) this->_tentative.size();
+
+    if (source.getId() >= size || !this->_graph.isNodeEnabled(source))
+    {
+        return;
+    }
+
+    this->_source = source.getId();
+
+    Entry entry;
+
+    entry.distance = LinkWeight();
+    entry.node = this->_source;
+
+    this->_tentative[this->_source].store(entry.distance, std::memory_order_relaxed);
+    this->_buckets[0][0].push_back(entry);
+
+    // I secchi da current a _windowEnd - 1 sono nei secchi circolari, quelli successivi nel secchio lontano
+    uint32_t phase = 0;
+    uint64_t current = 0;
+
+    while (true)
+    {
+        while (current < this->_windowEnd && !this->_gather(current))
+        {
+            current++;
+        }
+
+        if (current == this->_windowEnd)
+        {
+            if (!this->_refill(current))
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        this->_inSettled.begin(size);
+        this->_settled.clear();
+        this->_bucketAmount++;
+
+        // Fasi leggere: il secchio viene svuotato finche' i rilassamenti lo riempiono
+        do
+        {
+            for (std::size_t i = 0; i < this->_frontier.size(); i++)
+            {
+                if (this->_inSettled.visit(this->_frontier[i].node))
+                {
+                    this->_settled.push_back(this->_frontier[i].node);
+                }
+            }
+
+            this->_relax(true, ++phase);
+        }
+        while (this->_gather(current));
+
+        // Le distanze del secchio sono definitive: si rilassano gli archi pesanti
+        this->_relax(false, ++phase);
+        current++;
+    }
+
+    this->_phaseAmount = phase;
+
+    this->_pool.parallelFor(0, size, _GRAIN_NODES, [this](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t u = from; u < to; u++)
+        {
+            this->_distances[u] = this->_tentative[u].load(std::memory_order_relaxed);
+        }
+    });
+
+    this->_findParents();
+}
+
+/**
+ * Restituisce la distanza di ogni nodo dalla sorgente nell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Vettore delle distanze, Tree::infinity() per i nodi non raggiungibili
+ */
+template <class TGraph>
+const std::vector<typename DeltaStepping<TGraph>::LinkWeight>& DeltaStepping<TGraph>::getDistances() const
+{
+    return this->_distances;
+}
+
+/**
+ * Restituisce il padre di ogni nodo nell'albero dei cammini minimi dell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Vettore dei padri, NO_PARENT per la sorgente e i nodi non raggiungibili
+ */
+template <class TGraph>
+const std::vector<uint32_t>& DeltaStepping<TGraph>::getParents() const
+{
+    return this->_parents;
+}
+
+/**
+ * Restituisce la distanza di un nodo dalla sorgente nell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo
+ * @return Distanza dalla sorgente, Tree::infinity() se non raggiungibile
+ */
+template <class TGraph>
+typename DeltaStepping<TGraph>::LinkWeight DeltaStepping<TGraph>::getDistance(const GraphNode& node) const
+{
+    if (node.getId() >= this->_distances.size())
+    {
+        return Tree::infinity();
+    }
+
+    return this->_distances[node.getId()];
+}
+
+/**
+ * Restituisce il padre di un nodo nell'albero dei cammini minimi dell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo
+ * @return Id del padre, NO_PARENT per la sorgente e i nodi non raggiungibili
+ */
+template <class TGraph>
+uint32_t DeltaStepping<TGraph>::getParent(const GraphNode& node) const
+{
+    if (node.getId() >= this->_parents.size())
+    {
+        return NO_PARENT;
+    }
+
+    return this->_parents[node.getId()];
+}
+
+/**
+ * Restituisce true se node e' stato raggiunto nell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo da controllare
+ * @return True se node e' raggiungibile, altrimenti false
+ */
+template <class TGraph>
+bool DeltaStepping<TGraph>::isReachable(const GraphNode& node) const
+{
+    return this->getDistance(node) != Tree::infinity();
+}
+
+/**
+ * Restituisce il numero di nodi raggiunti nell'ultima esecuzione, compresa la sorgente
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di nodi raggiunti
+ */
+template <class TGraph>
+uint32_t DeltaStepping<TGraph>::getReachedAmount() const
+{
+    return this->_reachedAmount;
+}
+
+/**
+ * Restituisce il numero di secchi non vuoti svuotati nell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di secchi
+ */
+template <class TGraph>
+uint32_t DeltaStepping<TGraph>::getBucketAmount() const
+{
+    return this->_bucketAmount;
+}
+
+/**
+ * Restituisce il numero di fasi parallele, leggere e pesanti, dell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di fasi
+ */
+template <class TGraph>
+uint32_t DeltaStepping<TGraph>::getPhaseAmount() const
+{
+    return this->_phaseAmount;
+}
+
+
+/**
+ * Restituisce l'indice del secchio che contiene la distanza data
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param distance : Distanza provvisoria
+ * @return Indice del secchio
+ */
+template <class TGraph>
+uint64_t DeltaStepping<TGraph>::_bucketOf(LinkWeight distance) const
+{
+    return (uint64_t) (distance / this->_delta);
+}
+
+/**
+ * Riporta in parallelo tutti i nodi allo stato non raggiunto e prepara i secchi
+ * circolari di ogni thread per l'ampiezza corrente
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void DeltaStepping<TGraph>::_reset()
+{
+    uint32_t size = (uint32_t) this->_tentative.size();
+    // Da un secchio i si raggiungono al piu' i secchi fino a i + 1 + maxWeight / delta:
+    // se la finestra e' piu' corta, i secchi oltre la finestra passano dal secchio lontano
+    uint64_t needed = this->_bucketOf(this->_maxWeight) + 2;
+    uint64_t slots = 1;
+
+    while (slots < (uint64_t) _SLOTS_PER_THREAD * this->_pool.getThreadAmount() && slots < needed)
+    {
+        slots *= 2;
+    }
+
+    this->_distances.resize(size);
+    this->_parents.resize(size);
+    this->_source = NO_PARENT;
+    this->_reachedAmount = 0;
+    this->_bucketAmount = 0;
+    this->_phaseAmount = 0;
+
+    this->_buckets.resize(this->_pool.getThreadAmount());
+    this->_far.resize(this->_pool.getThreadAmount());
+    this->_windowEnd = slots;
+
+    for (std::size_t t = 0; t < this->_buckets.size(); t++)
+    {
+        this->_buckets[t].resize(slots);
+        this->_far[t].clear();
+
+        for (std::size_t i = 0; i < slots; i++)
+        {
+            this->_buckets[t][i].clear();
+        }
+    }
+
+    this->_pool.parallelFor(0, size, _GRAIN_NODES, [this](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t u = from; u < to; u++)
+        {
+            this->_tentative[u].store(Tree::infinity(), std::memory_order_relaxed);
+            this->_phases[u].store(0, std::memory_order_relaxed);
+            this->_distances[u] = Tree::infinity();
+            this->_parents[u] = NO_PARENT;
+        }
+    });
+}
+
+/**
+ * Raccoglie nella frontiera i nodi del secchio dato inseriti da tutti i thread, scartando
+ * i duplicati e gli inserimenti superati da una distanza minore
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param bucket : Indice del secchio
+ * @return True se la frontiera non e' vuota, altrimenti false
+ */
+template <class TGraph>
+bool DeltaStepping<TGraph>::_gather(uint64_t bucket)
+{
+    uint64_t slot = bucket % this->_buckets[0].size();
+
+    this->_frontier.clear();
+    this->_inFrontier.begin((uint32_t) this->_tentative.size());
+
+    for (std::size_t t = 0; t < this->_buckets.size(); t++)
+    {
+        std::vector<Entry>& entries = this->_buckets[t][slot];
+
+        for (std::size_t i = 0; i < entries.size(); i++)
+        {
+            uint32_t u = entries[i].node;
+
+            if (entries[i].distance == this->_tentative[u].load(std::memory_order_relaxed) && this->_inFrontier.visit(u))
+            {
+                this->_frontier.push_back(entries[i]);
+            }
+        }
+
+        entries.clear();
+    }
+
+    return !this->_frontier.empty();
+}
+
+/**
+ * Sposta la finestra dei secchi circolari, ormai vuota, sul secchio non vuoto di indice
+ * minimo fra quelli lontani, e vi ridistribuisce i nodi lontani che ora vi ricadono.
+ * Gli inserimenti superati da una distanza minore vengono scartati.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param bucket : Secchio da cui riprendere, aggiornato al primo secchio della nuova finestra
+ * @return True se restano nodi da elaborare, altrimenti false
+ */
+template <class TGraph>
+bool DeltaStepping<TGraph>::_refill(uint64_t& bucket)
+{
+    uint64_t slots = this->_buckets[0].size();
+    uint64_t first = UINT64_MAX;
+
+    for (std::size_t t = 0; t < this->_far.size(); t++)
+    {
+        std::vector<Entry>& entries = this->_far[t];
+        std::size_t kept = 0;
+
+        for (std::size_t i = 0; i < entries.size(); i++)
+        {
+            if (entries[i].distance == this->_tentative[entries[i].node].load(std::memory_order_relaxed))
+            {
+                first = std::min(first, this->_bucketOf(entries[i].distance));
+                entries[kept++] = entries[i];
+            }
+        }
+
+        entries.resize(kept);
+    }
+
+    if (first == UINT64_MAX)
+    {
+        return false;
+    }
+
+    bucket = first;
+    this->_windowEnd = first + slots;
+
+    for (std::size_t t = 0; t < this->_far.size(); t++)
+    {
+        std::vector<Entry>& entries = this->_far[t];
+        std::size_t kept = 0;
+
+        for (std::size_t i = 0; i < entries.size(); i++)
+        {
+            uint64_t index = this->_bucketOf(entries[i].distance);
+
+            if (index < this->_windowEnd)
+            {
+                this->_buckets[t][index % slots].push_back(entries[i]);
+            }
+
+            else
+            {
+                entries[kept++] = entries[i];
+            }
+        }
+
+        entries.resize(kept);
+    }
+
+    return true;
+}
+
+/**
+ * Fase parallela: rilassa gli archi leggeri dei nodi della frontiera, oppure gli archi
+ * pesanti dei nodi del secchio appena svuotato. I nodi migliorati vengono inseriti nei
+ * secchi del thread che li ha migliorati, o nel suo secchio lontano se cadono oltre la finestra.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param light : Se true rilassa gli archi leggeri della frontiera, altrimenti quelli pesanti del secchio
+ * @param phase : Numero della fase, registrato nei nodi migliorati
+ */
+template <class TGraph>
+void DeltaStepping<TGraph>::_relax(bool light, uint32_t phase)
+{
+    uint32_t amount = (uint32_t) (light ? this->_frontier.size() : this->_settled.size());
+    uint64_t slots = this->_buckets[0].size();
+
+    this->_pool.parallelFor(0, amount, _GRAIN_ENTRIES, [this, light, phase, slots](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        std::vector< std::vector<Entry> >& buckets = this->_buckets[thread];
+        std::vector<Entry>& far = this->_far[thread];
+        Entry entry;
+
+        for (uint32_t i = from; i < to; i++)
+        {
+            // La distanza della frontiera e' quella letta prima della fase, non quella che
+            // altri thread stanno abbassando: cosi' il risultato non dipende dai thread
+            uint32_t u = light ? this->_frontier[i].node : this->_settled[i];
+            LinkWeight distanceU = light ? this->_frontier[i].distance : this->_tentative[u].load(std::memory_order_relaxed);
+
+            for (auto link : this->_graph.getOutLinks(GraphNode(u)))
+            {
+                if ((this->_delta < link.weight) == light)
+                {
+                    continue;
+                }
+
+                uint32_t v = link.id;
+                LinkWeight candidate = distanceU + link.weight;
+                LinkWeight current = this->_tentative[v].load(std::memory_order_relaxed);
+
+                while (candidate < current)
+                {
+                    if (this->_tentative[v].compare_exchange_weak(current, candidate, std::memory_order_relaxed))
+                    {
+                        this->_phases[v].store(phase, std::memory_order_relaxed);
+
+                        uint64_t index = this->_bucketOf(candidate);
+
+                        entry.distance = candidate;
+                        entry.node = v;
+
+                        if (index < this->_windowEnd)
+                        {
+                            buckets[index % slots].push_back(entry);
+                        }
+
+                        else
+                        {
+                            far.push_back(entry);
+                        }
+
+                        break;
+                    }
+                }
+            }
+        }
+    });
+}
+
+/**
+ * Sceglie in parallelo il padre di ogni nodo raggiunto: il predecessore di id minimo u
+ * con distanza(u) + peso = distanza(v) e distanza(u) minore di distanza(v) oppure, a pari
+ * distanza (archi di peso zero o trascurabile in virgola mobile), abbassata l'ultima volta
+ * in una fase precedente a quella di v. Il nodo che ha fissato la distanza di v soddisfa
+ * sempre la condizione, e la coppia (distanza, fase) strettamente decrescente lungo i
+ * padri esclude i cicli. Scorre gli archi entranti di ogni nodo, quindi richiede un grafo
+ * con indice degli archi entranti (CsrGraph) per costare O(archi).
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void DeltaStepping<TGraph>::_findParents()
+{
+    uint32_t size = (uint32_t) this->_distances.size();
+    std::atomic<uint32_t> reached(0);
+
+    this->_pool.parallelFor(0, size, _GRAIN_NODES / 16, [this, &reached](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        uint32_t amount = 0;
+
+        for (uint32_t v = from; v < to; v++)
+        {
+            LinkWeight distanceV = this->_distances[v];
+
+            if (distanceV == Tree::infinity())
+            {
+                continue;
+            }
+
+            amount++;
+
+            if (v == this->_source)
+            {
+                continue;
+            }
+
+            uint32_t phaseV = this->_phases[v].load(std::memory_order_relaxed);
+
+            for (auto link : this->_graph.getInLinks(GraphNode(v)))
+            {
+                uint32_t u = link.id;
+
+                LinkWeight distanceU = this->_distances[u];
+
+                if (u < this->_parents[v] && distanceU != Tree::infinity() && distanceU + link.weight == distanceV &&
+                    (distanceU < distanceV || this->_phases[u].load(std::memory_order_relaxed) < phaseV))
+                {
+                    this->_parents[v] = u;
+                }
+            }
+        }
+
+        reached.fetch_add(amount, std::memory_order_relaxed);
+    });
+
+    this->_reachedAmount = reached.load();
+}
+
+#endif // _DELTASTEPPING_H
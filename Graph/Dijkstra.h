@@ -0,0 +1,262 @@
+#ifndef _DIJKSTRA_H
+#define _DIJKSTRA_H
+
+#include "Graph.h"
+#include "ShortestPathTree.h"
+#include "../PriorityQueue/IndexedPriorityQueue.h"
+
+#include <vector>
+
+/**
+ * Elemento della coda con priorita' usata dall'algoritmo di Dijkstra.
+ * Gli elementi vengono ordinati per distanza provvisoria dalla sorgente.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class DijkstraEntry
+{
+    public:
+        TLinkWeight distance; // Distanza provvisoria dalla sorgente
+        uint32_t node; // Id del nodo
+
+    public:
+        bool operator<(const DijkstraEntry<TLinkWeight>& entry) const;
+};
+
+template <class TLinkWeight>
+bool DijkstraEntry<TLinkWeight>::operator<(const DijkstraEntry<TLinkWeight>& entry) const
+{
+    return (this->distance < entry.distance);
+}
+
+
+/**
+ * Motore per il calcolo dei cammini minimi con l'algoritmo di Dijkstra.
+ *
+ * I nodi vengono estratti in ordine di distanza provvisoria da una coda con priorita'
+ * indicizzata: quando la distanza di un nodo gia' in coda diminuisce, viene usato
+ * decreaseKey invece di inserire un duplicato.
+ *
+ * Il motore conserva l'albero dei cammini minimi, la coda e gli handle tra una chiamata
+ * e l'altra: ad ogni nuova esecuzione vengono ripristinati solo i nodi toccati da quella
+ * precedente, quindi interrogazioni ripetute non pagano l'inizializzazione di tutto il grafo.
+ *
+ * @tparam TGraph : Tipo del grafo su cui eseguire l'algoritmo
+ */
+template <class TGraph>
+class Dijkstra
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+        typedef ShortestPathTree<LinkWeight> Tree;
+        typedef IndexedPriorityQueue< DijkstraEntry<LinkWeight> > Queue;
+        typedef typename Queue::Handle Handle;
+
+    private:
+        const TGraph& _graph; // Grafo su cui calcolare i cammini
+        Tree _tree; // Albero dei cammini minimi dell'ultima esecuzione
+        Queue _queue; // Nodi da processare, ordinati per distanza
+        std::vector<Handle> _handles; // Handle nella coda di ogni nodo
+        std::vector<uint32_t> _touched; // Nodi a cui e' stata assegnata una distanza nell'ultima esecuzione
+        uint32_t _settledAmount; // Numero di nodi etichettati nell'ultima esecuzione
+
+    private:
+        void _prepare();
+        void _run(uint32_t source, uint32_t target);
+
+    public:
+        Dijkstra(const TGraph& graph);
+
+        const Tree& run(const GraphNode& source);
+        const Tree& run(const GraphNode& source, const GraphNode& target);
+
+        const Tree& getTree() const;
+        uint32_t getSettledAmount() const;
+};
+
+
+/**
+ * Crea un motore di Dijkstra sul grafo dato. Il grafo deve sopravvivere al motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo su cui calcolare i cammini minimi
+ */
+template <class TGraph>
+Dijkstra<TGraph>::Dijkstra(const TGraph& graph) : _graph(graph)
+{
+    this->_settledAmount = 0;
+}
+
+/**
+ * Calcola l'albero dei cammini minimi con radice source, etichettando tutti i nodi
+ * raggiungibili.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param source : Nodo sorgente
+ * @return Albero dei cammini minimi, valido fino alla prossima esecuzione del motore
+ */
+template <class TGraph>
+const typename Dijkstra<TGraph>::Tree& Dijkstra<TGraph>::run(const GraphNode& source)
+{
+    this->_run(source.getId(), Tree::NO_PARENT);
+    return this->_tree;
+}
+
+/**
+ * Calcola i cammini minimi con radice source, fermandosi non appena la distanza di
+ * target diventa definitiva. Solo target e i nodi etichettati prima di lui risultano
+ * raggiungibili nell'albero restituito.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param source : Nodo sorgente
+ * @param target : Nodo di arrivo
+ * @return Albero dei cammini minimi, valido fino alla prossima esecuzione del motore
+ */
+template <class TGraph>
+const typename Dijkstra<TGraph>::Tree& Dijkstra<TGraph>::run(const GraphNode& source, const GraphNode& target)
+{
+    this->_run(source.getId(), target.getId());
+    return this->_tree;
+}
+
+/**
+ * Restituisce l'albero dei cammini minimi dell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Albero dei cammini minimi
+ */
+template <class TGraph>
+const typename Dijkstra<TGraph>::Tree& Dijkstra<TGraph>::getTree() const
+{
+    return this->_tree;
+}
+
+/**
+ * Restituisce il numero di nodi etichettati nell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di nodi etichettati
+ */
+template <class TGraph>
+uint32_t Dijkstra<TGraph>::getSettledAmount() const
+{
+    return this->_settledAmount;
+}
+
+
+/**
+ * Prepara le strutture di supporto per una nuova esecuzione. Se le dimensioni del grafo
+ * non sono cambiate, vengono ripristinati solo i nodi toccati dall'esecuzione precedente.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void Dijkstra<TGraph>::_prepare()
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+
+    if (this->_tree.getSize() != size)
+    {
+        this->_tree.resize(size);
+        this->_handles.assign(size, Queue::NULL_HANDLE);
+    }
+
+    else
+    {
+        for (std::size_t i = 0; i < this->_touched.size(); i++)
+        {
+            this->_tree.reset(this->_touched[i]);
+            this->_handles[this->_touched[i]] = Queue::NULL_HANDLE;
+        }
+    }
+
+    this->_touched.clear();
+    this->_queue.clear();
+    this->_settledAmount = 0;
+}
+
+/**
+ * Esegue l'algoritmo di Dijkstra da source. Se target e' diverso da NO_PARENT,
+ * l'algoritmo si ferma quando target viene estratto dalla coda.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param source : Id della sorgente
+ * @param target : Id del nodo di arrivo, oppure NO_PARENT
+ */
+template <class TGraph>
+void Dijkstra<TGraph>::_run(uint32_t source, uint32_t target)
+{
+    this->_prepare();
+    this->_tree.setSource(source);
+
+    if (!this->_graph.isNodeEnabled(GraphNode(source)))
+    {
+        return;
+    }
+
+    DijkstraEntry<LinkWeight> entry;
+
+    entry.distance = LinkWeight();
+    entry.node = source;
+
+    this->_tree.setDistance(source, entry.distance, Tree::NO_PARENT);
+    this->_touched.push_back(source);
+    this->_handles[source] = this->_queue.push(entry);
+
+    // Il ciclo si ripete finche' esistono nodi da processare
+    while (!this->_queue.isEmpty())
+    {
+        uint32_t u = this->_queue.min().node;
+        LinkWeight distanceU = this->_queue.min().distance;
+
+        this->_queue.deleteMin();
+        this->_handles[u] = Queue::NULL_HANDLE;
+        this->_tree.settle(u);
+        this->_settledAmount++;
+
+        if (u == target)
+        {
+            break;
+        }
+
+        // Sfoglio gli archi uscenti di u senza allocare liste di adiacenza
+        for (auto link : this->_graph.getOutLinks(GraphNode(u)))
+        {
+            uint32_t v = link.id;
+
+            if (this->_tree.isReachable(v))
+            {
+                continue;
+            }
+
+            LinkWeight candidate = distanceU + link.weight;
+            LinkWeight current = this->_tree.getTentativeDistance(v);
+
+            if (candidate < current)
+            {
+                if (current == Tree::infinity())
+                {
+                    this->_touched.push_back(v);
+                }
+
+                this->_tree.setDistance(v, candidate, u);
+
+                entry.distance = candidate;
+                entry.node = v;
+
+                if (this->_handles[v] == Queue::NULL_HANDLE)
+                {
+                    this->_handles[v] = this->_queue.push(entry);
+                }
+
+                else
+                {
+                    this->_queue.decreaseKey(this->_handles[v], entry);
+                }
+            }
+        }
+    }
+}
+
+#endif // _DIJKSTRA_H
@@ -0,0 +1,692 @@
+#ifndef _EDGELISTLOADER_H
+#define _EDGELISTLOADER_H
+
+#include "CsrGraph.h"
+#include "../Lib/MappedFile.h"
+#include "../Lib/ThreadPool.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * Arco letto da una riga della lista di archi
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class EdgeListLink
+{
+    public:
+        uint32_t from; // Nodo di partenza
+        uint32_t to; // Nodo di arrivo
+        TLinkWeight weight; // Peso dell'arco
+};
+
+
+/**
+ * Caricatore parallelo di grafi da liste di archi testuali, una riga "from to weight"
+ * per arco, in un grafo compresso (CsrGraph), senza passare per Graph e addLink.
+ *
+ * Il file viene mappato in memoria (MappedFile) e diviso in blocchi che iniziano a
+ * inizio riga; i thread analizzano i blocchi in parallelo con std::from_chars, senza
+ * stream ne' locale. Gli archi vengono poi ordinati per nodo di partenza con un counting
+ * sort stabile a due livelli:
+ *  - ogni blocco conta i propri archi per gruppo di id consecutivi e li copia nella
+ *    posizione del gruppo, nell'ordine del file;
+ *  - ogni gruppo, in parallelo con gli altri, conta i propri archi per nodo di partenza
+ *    e li distribuisce, poi ordina gli archi di ogni nodo per nodo di arrivo.
+ * Gli array del grafo compresso vengono riempiti in parallelo e l'indice degli archi
+ * entranti si costruisce con lo stesso ordinamento, per nodo di arrivo.
+ *
+ * Formato delle righe:
+ *  - gli id sono interi non negativi minori di 2^32 - 1, separati da spazi o tabulazioni;
+ *  - il peso e' facoltativo (vale 1 se manca) e si legge come TLinkWeight, quindi con la
+ *    parte decimale e l'esponente solo se TLinkWeight e' in virgola mobile;
+ *  - le righe vuote e quelle che iniziano con '#' o '%' vengono ignorate;
+ *  - le righe malformate o con peso negativo vengono scartate e contate.
+ * Come con addLink, un arco ripetuto prende il peso della sua ultima riga. Il grafo ha
+ * come nodi tutti gli id da 0 all'id massimo letto, con l'etichetta di default.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco, numerico
+ */
+template <class TNodeLabel, class TLinkWeight>
+class EdgeListLoader
+{
+    public:
+        typedef EdgeListLink<TLinkWeight> Link;
+
+    private:
+        static const uint64_t _CHUNK_BYTES = 1 << 20; // Dimensione minima di un blocco del file
+        static const uint32_t _CHUNKS_PER_THREAD = 4; // Blocchi del file per thread, per bilanciare il carico
+        static const uint32_t _GROUPS_PER_THREAD = 8; // Gruppi di id per thread nell'ordinamento
+
+        ThreadPool& _pool; // Thread su cui eseguire il caricamento
+        MappedFile _file; // File in corso di caricamento
+
+        std::vector<uint64_t> _starts; // Inizio di ogni blocco del file, con in fondo la dimensione del file
+        std::vector< std::vector<Link> > _chunks; // Archi letti da ogni blocco
+        std::vector<uint32_t> _chunkNodes; // Id massimo + 1 letto da ogni blocco
+        std::vector<uint64_t> _chunkInvalid; // Righe scartate da ogni blocco
+        std::vector<uint64_t> _positions; // Posizione di scrittura di ogni blocco in ogni gruppo
+        std::vector<uint64_t> _groupOffsets; // Inizio degli archi di ogni gruppo
+        std::vector<uint64_t> _groupLinks; // Archi senza ripetizioni di ogni gruppo, poi il loro inizio nel grafo
+        std::vector<Link> _grouped; // Archi ordinati per gruppo del nodo di partenza
+        std::vector<Link> _sorted; // Archi ordinati per nodo di partenza e di arrivo
+        std::vector<uint64_t> _begins; // Inizio degli archi di ogni nodo in _sorted
+        std::vector<uint32_t> _degrees; // Archi senza ripetizioni di ogni nodo
+
+        uint64_t _byteAmount; // Byte letti nell'ultimo caricamento
+        uint64_t _lineAmount; // Righe con un arco valido nell'ultimo caricamento
+        uint64_t _invalidAmount; // Righe scartate nell'ultimo caricamento
+        uint64_t _duplicateAmount; // Archi ripetuti nell'ultimo caricamento
+
+    private:
+        void _split();
+        void _parse(uint32_t chunk);
+        static bool _parseLine(const char* cursor, const char* end, Link& link);
+        static const char* _skipBlanks(const char* cursor, const char* end);
+        void _group(uint32_t size, uint32_t shift, uint32_t Link::* key);
+        void _fillOutLinks(uint32_t size, uint32_t shift, CsrGraph<TNodeLabel, TLinkWeight>& graph);
+        void _fillInLinks(uint32_t size, uint32_t shift, CsrGraph<TNodeLabel, TLinkWeight>& graph);
+
+    public:
+        EdgeListLoader(ThreadPool& pool);
+
+        bool load(const std::string& path, CsrGraph<TNodeLabel, TLinkWeight>& graph);
+
+        uint64_t getByteAmount() const;
+        uint64_t getLineAmount() const;
+        uint64_t getInvalidAmount() const;
+        uint64_t getDuplicateAmount() const;
+};
+
+template <class TNodeLabel, class TLinkWeight>
+const uint64_t EdgeListLoader<TNodeLabel, TLinkWeight>::_CHUNK_BYTES;
+
+template <class TNodeLabel, class TLinkWeight>
+const uint32_t EdgeListLoader<TNodeLabel, TLinkWeight>::_CHUNKS_PER_THREAD;
+
+template <class TNodeLabel, class TLinkWeight>
+const uint32_t EdgeListLoader<TNodeLabel, TLinkWeight>::_GROUPS_PER_THREAD;
+
+
+/**
+ * Crea un caricatore che usa i thread di pool. Il pool deve sopravvivere al caricatore.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param pool : Thread su cui eseguire il caricamento
+ */
+template <class TNodeLabel, class TLinkWeight>
+EdgeListLoader<TNodeLabel, TLinkWeight>::EdgeListLoader(ThreadPool& pool) : _pool(pool)
+{
+    this->_byteAmount = 0;
+    this->_lineAmount = 0;
+    this->_invalidAmount = 0;
+    this->_duplicateAmount = 0;
+}
+
+/**
+ * Carica la lista di archi del file nel grafo compresso, sostituendone il contenuto.
+ * Un file senza archi validi produce un grafo vuoto.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param path : Percorso del file
+ * @param graph : Grafo in cui caricare gli archi
+ * @return True se il caricamento e' riuscito, false se il file non si puo' aprire o ha 2^32 archi o piu'
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool EdgeListLoader<TNodeLabel, TLinkWeight>::load(const std::string& path, CsrGraph<TNodeLabel, TLinkWeight>& graph)
+{
+    this->_byteAmount = 0;
+    this->_lineAmount = 0;
+    this->_invalidAmount = 0;
+    this->_duplicateAmount = 0;
+
+    if (!this->_file.open(path))
+    {
+        return false;
+    }
+
+    this->_file.prefetch();
+    this->_byteAmount = this->_file.getSize();
+    this->_split();
+
+    uint32_t chunks = (uint32_t) this->_starts.size() - 1;
+
+    this->_chunks.resize(chunks);
+    this->_chunkNodes.assign(chunks, 0);
+    this->_chunkInvalid.assign(chunks, 0);
+
+    this->_pool.parallelFor(0, chunks, 1, [this](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t c = from; c < to; c++)
+        {
+            this->_parse(c);
+        }
+    });
+
+    this->_file.close();
+
+    uint32_t size = 0;
+
+    for (uint32_t c = 0; c < chunks; c++)
+    {
+        size = std::max(size, this->_chunkNodes[c]);
+        this->_lineAmount += this->_chunks[c].size();
+        this->_invalidAmount += this->_chunkInvalid[c];
+    }
+
+    if (this->_lineAmount >= UINT32_MAX)
+    {
+        this->_chunks.clear();
+        return false;
+    }
+
+    // I gruppi coprono intervalli di id lunghi una potenza di due, cosi' che il gruppo di un nodo sia uno shift
+    uint32_t groups = std::max(1u, std::min(size, this->_pool.getThreadAmount() * _GROUPS_PER_THREAD));
+    uint32_t shift = 0;
+
+    while (((uint64_t) groups << shift) < size)
+    {
+        shift++;
+    }
+
+    this->_group(size, shift, &Link::from);
+    this->_fillOutLinks(size, shift, graph);
+    this->_fillInLinks(size, shift, graph);
+
+    return true;
+}
+
+/**
+ * Restituisce la dimensione del file dell'ultimo caricamento
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Byte letti
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint64_t EdgeListLoader<TNodeLabel, TLinkWeight>::getByteAmount() const
+{
+    return this->_byteAmount;
+}
+
+/**
+ * Restituisce il numero di righe con un arco valido dell'ultimo caricamento, compresi
+ * gli archi ripetuti
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di righe valide
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint64_t EdgeListLoader<TNodeLabel, TLinkWeight>::getLineAmount() const
+{
+    return this->_lineAmount;
+}
+
+/**
+ * Restituisce il numero di righe malformate o con peso negativo dell'ultimo caricamento
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di righe scartate
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint64_t EdgeListLoader<TNodeLabel, TLinkWeight>::getInvalidAmount() const
+{
+    return this->_invalidAmount;
+}
+
+/**
+ * Restituisce il numero di righe dell'ultimo caricamento il cui arco e' stato ripetuto
+ * piu' avanti nel file
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di archi ripetuti
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint64_t EdgeListLoader<TNodeLabel, TLinkWeight>::getDuplicateAmount() const
+{
+    return this->_duplicateAmount;
+}
+
+
+/**
+ * Divide il file mappato in blocchi di dimensione simile, spostando l'inizio di ogni
+ * blocco dopo il primo a capo successivo, cosi' che nessuna riga sia divisa
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void EdgeListLoader<TNodeLabel, TLinkWeight>::_split()
+{
+    const char* data = (const char*) this->_file.getData();
+    uint64_t size = this->_file.getSize();
+    uint64_t chunks = std::max<uint64_t>(1, std::min<uint64_t>(size / _CHUNK_BYTES, (uint64_t) this->_pool.getThreadAmount() * _CHUNKS_PER_THREAD));
+
+    this->_starts.assign(1, 0);
+
+    for (uint64_t c = 1; c < chunks; c++)
+    {
+        uint64_t start = std::max(c * size / chunks, this->_starts.back());
+
+        if (start > 0 && start < size)
+        {
+            const char* newLine = (const char*) std::memchr(data + start - 1, '\n', size - start + 1);
+
+            start = (newLine != nullptr) ? (uint64_t) (newLine - data) + 1 : size;
+        }
+
+        this->_starts.push_back(start);
+    }
+
+    this->_starts.push_back(size);
+}
+
+/**
+ * Legge gli archi di un blocco del file
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param chunk : Indice del blocco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void EdgeListLoader<TNodeLabel, TLinkWeight>::_parse(uint32_t chunk)
+{
+    const char* data = (const char*) this->_file.getData();
+    const char* cursor = data + this->_starts[chunk];
+    const char* end = data + this->_starts[chunk + 1];
+    std::vector<Link>& links = this->_chunks[chunk];
+    uint32_t nodes = 0;
+    uint64_t invalid = 0;
+    Link link;
+
+    links.clear();
+
+    while (cursor < end)
+    {
+        const char* lineEnd = (const char*) std::memchr(cursor, '\n', (std::size_t) (end - cursor));
+
+        if (lineEnd == nullptr)
+        {
+            lineEnd = end;
+        }
+
+        const char* first = EdgeListLoader<TNodeLabel, TLinkWeight>::_skipBlanks(cursor, lineEnd);
+
+        // Righe vuote e commenti
+        if (first != lineEnd && *first != '#' && *first != '%')
+        {
+            if (EdgeListLoader<TNodeLabel, TLinkWeight>::_parseLine(first, lineEnd, link))
+            {
+                links.push_back(link);
+                nodes = std::max(nodes, std::max(link.from, link.to) + 1);
+            }
+
+            else
+            {
+                invalid++;
+            }
+        }
+
+        cursor = lineEnd + 1;
+    }
+
+    this->_chunkNodes[chunk] = nodes;
+    this->_chunkInvalid[chunk] = invalid;
+}
+
+/**
+ * Legge l'arco di una riga, senza il carattere di a capo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param cursor : Primo carattere non vuoto della riga
+ * @param end : Fine della riga
+ * @param link : Arco letto
+ * @return True se la riga contiene un arco valido, altrimenti false
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool EdgeListLoader<TNodeLabel, TLinkWeight>::_parseLine(const char* cursor, const char* end, Link& link)
+{
+    uint64_t ids[2];
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        std::from_chars_result read = std::from_chars(cursor, end, ids[i]);
+
+        // L'id deve essere seguito da uno spazio o dalla fine della riga
+        if (read.ec != std::errc() || ids[i] >= UINT32_MAX || (read.ptr != end && *read.ptr != ' ' && *read.ptr != '\t' && *read.ptr != '\r'))
+        {
+            return false;
+        }
+
+        cursor = EdgeListLoader<TNodeLabel, TLinkWeight>::_skipBlanks(read.ptr, end);
+
+        if (i == 0 && cursor == end)
+        {
+            return false;
+        }
+    }
+
+    link.from = (uint32_t) ids[0];
+    link.to = (uint32_t) ids[1];
+    link.weight = TLinkWeight(1);
+
+    if (cursor != end)
+    {
+        std::from_chars_result read = std::from_chars(cursor, end, link.weight);
+
+        // Come in addLink non sono ammessi pesi negativi, ne' NaN
+        if (read.ec != std::errc() || !(link.weight >= 0) || EdgeListLoader<TNodeLabel, TLinkWeight>::_skipBlanks(read.ptr, end) != end)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Salta spazi, tabulazioni e ritorni a capo (delle righe terminate da "\r\n")
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param cursor : Posizione di partenza
+ * @param end : Fine della riga
+ * @return Primo carattere diverso da uno spazio, oppure end
+ */
+template <class TNodeLabel, class TLinkWeight>
+const char* EdgeListLoader<TNodeLabel, TLinkWeight>::_skipBlanks(const char* cursor, const char* end)
+{
+    while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r'))
+    {
+        cursor++;
+    }
+
+    return cursor;
+}
+
+/**
+ * Counting sort stabile a due livelli degli archi letti nei blocchi, per il nodo
+ * indicato da key. Gli archi ordinati finiscono in _sorted: quelli del nodo u iniziano
+ * in _begins[u] e sono _degrees[u], nell'ordine dei blocchi. I blocchi vengono svuotati.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param size : Numero di nodi del grafo
+ * @param shift : Logaritmo del numero di id di ogni gruppo
+ * @param key : Estremo dell'arco per cui ordinare
+ */
+template <class TNodeLabel, class TLinkWeight>
+void EdgeListLoader<TNodeLabel, TLinkWeight>::_group(uint32_t size, uint32_t shift, uint32_t Link::* key)
+{
+    uint32_t chunks = (uint32_t) this->_chunks.size();
+    uint32_t groups = (uint32_t) (((uint64_t) size + (1ULL << shift) - 1) >> shift);
+
+    // Primo livello: conteggio degli archi di ogni blocco per gruppo
+    this->_positions.assign((std::size_t) chunks * groups, 0);
+
+    this->_pool.parallelFor(0, chunks, 1, [this, groups, shift, key](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t c = from; c < to; c++)
+        {
+            uint64_t* counts = this->_positions.data() + (std::size_t) c * groups;
+
+            for (const Link& link : this->_chunks[c])
+            {
+                counts[link.*key >> shift]++;
+            }
+        }
+    });
+
+    // I blocchi scrivono in ogni gruppo uno dopo l'altro, nel loro ordine
+    uint64_t amount = 0;
+
+    this->_groupOffsets.assign(groups + 1, 0);
+
+    for (uint32_t g = 0; g < groups; g++)
+    {
+        for (uint32_t c = 0; c < chunks; c++)
+        {
+            uint64_t count = this->_positions[(std::size_t) c * groups + g];
+
+            this->_positions[(std::size_t) c * groups + g] = amount;
+            amount += count;
+        }
+
+        this->_groupOffsets[g + 1] = amount;
+    }
+
+    this->_grouped.resize(amount);
+
+    this->_pool.parallelFor(0, chunks, 1, [this, groups, shift, key](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t c = from; c < to; c++)
+        {
+            uint64_t* positions = this->_positions.data() + (std::size_t) c * groups;
+
+            for (const Link& link : this->_chunks[c])
+            {
+                this->_grouped[positions[link.*key >> shift]++] = link;
+            }
+
+            std::vector<Link>().swap(this->_chunks[c]);
+        }
+    });
+
+    // Secondo livello: ogni gruppo conta i propri archi per nodo e li distribuisce
+    this->_sorted.resize(amount);
+    this->_begins.resize(size);
+    this->_degrees.assign(size, 0);
+
+    this->_pool.parallelFor(0, groups, 1, [this, size, shift, key](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t g = from; g < to; g++)
+        {
+            uint32_t last = (uint32_t) std::min<uint64_t>(size, ((uint64_t) g + 1) << shift);
+            uint64_t position = this->_groupOffsets[g];
+
+            for (uint64_t i = this->_groupOffsets[g]; i < this->_groupOffsets[g + 1]; i++)
+            {
+                this->_degrees[this->_grouped[i].*key]++;
+            }
+
+            for (uint32_t u = g << shift; u < last; u++)
+            {
+                this->_begins[u] = position;
+                position += this->_degrees[u];
+                this->_degrees[u] = 0;
+            }
+
+            for (uint64_t i = this->_groupOffsets[g]; i < this->_groupOffsets[g + 1]; i++)
+            {
+                const Link& link = this->_grouped[i];
+                uint32_t u = link.*key;
+
+                this->_sorted[this->_begins[u] + this->_degrees[u]++] = link;
+            }
+        }
+    });
+
+    std::vector<Link>().swap(this->_grouped);
+}
+
+/**
+ * Riempie gli archi uscenti del grafo: ordina gli archi di ogni nodo per nodo di arrivo
+ * e delle ripetizioni tiene l'ultima del file, poi copia gli archi rimasti
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param size : Numero di nodi del grafo
+ * @param shift : Logaritmo del numero di id di ogni gruppo
+ * @param graph : Grafo da riempire
+ */
+template <class TNodeLabel, class TLinkWeight>
+void EdgeListLoader<TNodeLabel, TLinkWeight>::_fillOutLinks(uint32_t size, uint32_t shift, CsrGraph<TNodeLabel, TLinkWeight>& graph)
+{
+    uint32_t groups = (uint32_t) this->_groupOffsets.size() - 1;
+
+    this->_groupLinks.assign(groups + 1, 0);
+
+    this->_pool.parallelFor(0, groups, 1, [this, size, shift](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t g = from; g < to; g++)
+        {
+            uint32_t last = (uint32_t) std::min<uint64_t>(size, ((uint64_t) g + 1) << shift);
+            uint64_t kept = 0;
+
+            for (uint32_t u = g << shift; u < last; u++)
+            {
+                Link* begin = this->_sorted.data() + this->_begins[u];
+                Link* end = begin + this->_degrees[u];
+                Link* write = begin;
+
+                if (!std::is_sorted(begin, end, [](const Link& a, const Link& b) { return a.to < b.to; }))
+                {
+                    std::stable_sort(begin, end, [](const Link& a, const Link& b) { return a.to < b.to; });
+                }
+
+                for (Link* read = begin; read < end; read++)
+                {
+                    if (read + 1 == end || read[1].to != read->to)
+                    {
+                        *write++ = *read;
+                    }
+                }
+
+                this->_degrees[u] = (uint32_t) (write - begin);
+                kept += this->_degrees[u];
+            }
+
+            this->_groupLinks[g + 1] = kept;
+        }
+    });
+
+    for (uint32_t g = 0; g < groups; g++)
+    {
+        this->_groupLinks[g + 1] += this->_groupLinks[g];
+    }
+
+    uint64_t links = this->_groupLinks[groups];
+
+    this->_duplicateAmount = this->_lineAmount - links;
+
+    graph._gSize = size;
+    graph._nodeAmount = size;
+    graph._linkAmount = (uint32_t) links;
+    graph._enabled.assign(size, true);
+    graph._labels.assign(size, TNodeLabel());
+    graph._offsets.resize((std::size_t) size + 1);
+    graph._targets.resize(links);
+    graph._weights.resize(links);
+    graph._offsets[size] = links;
+
+    this->_pool.parallelFor(0, groups, 1, [this, size, shift, &graph](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t g = from; g < to; g++)
+        {
+            uint32_t last = (uint32_t) std::min<uint64_t>(size, ((uint64_t) g + 1) << shift);
+            uint64_t position = this->_groupLinks[g];
+
+            for (uint32_t u = g << shift; u < last; u++)
+            {
+                const Link* links = this->_sorted.data() + this->_begins[u];
+
+                graph._offsets[u] = position;
+
+                for (uint32_t i = 0; i < this->_degrees[u]; i++)
+                {
+                    graph._targets[position] = links[i].to;
+                    graph._weights[position] = links[i].weight;
+                    position++;
+                }
+            }
+        }
+    });
+
+    std::vector<Link>().swap(this->_sorted);
+}
+
+/**
+ * Costruisce in parallelo l'indice trasposto degli archi entranti del grafo, al posto
+ * del counting sort sequenziale di CsrGraph: ogni gruppo di nodi di partenza diventa un
+ * blocco e gli archi vengono ordinati per nodo di arrivo con lo stesso ordinamento
+ * stabile, quindi gli archi entranti di ogni nodo restano ordinati per nodo di partenza
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param size : Numero di nodi del grafo
+ * @param shift : Logaritmo del numero di id di ogni gruppo
+ * @param graph : Grafo da riempire
+ */
+template <class TNodeLabel, class TLinkWeight>
+void EdgeListLoader<TNodeLabel, TLinkWeight>::_fillInLinks(uint32_t size, uint32_t shift, CsrGraph<TNodeLabel, TLinkWeight>& graph)
+{
+    uint32_t groups = (uint32_t) this->_groupOffsets.size() - 1;
+
+    this->_chunks.resize(groups);
+
+    this->_pool.parallelFor(0, groups, 1, [this, size, shift, &graph](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t g = from; g < to; g++)
+        {
+            uint32_t last = (uint32_t) std::min<uint64_t>(size, ((uint64_t) g + 1) << shift);
+            std::vector<Link>& links = this->_chunks[g];
+            Link link;
+
+            links.clear();
+            links.reserve(this->_groupLinks[g + 1] - this->_groupLinks[g]);
+
+            for (link.from = g << shift; link.from < last; link.from++)
+            {
+                for (uint64_t pos = graph._offsets[link.from]; pos < graph._offsets[link.from + 1]; pos++)
+                {
+                    link.to = graph._targets[pos];
+                    link.weight = graph._weights[pos];
+                    links.push_back(link);
+                }
+            }
+        }
+    });
+
+    this->_group(size, shift, &Link::to);
+
+    graph._inOffsets.resize((std::size_t) size + 1);
+    graph._inSources.resize(this->_sorted.size());
+    graph._inWeights.resize(this->_sorted.size());
+    graph._inOffsets[size] = this->_sorted.size();
+
+    // Senza ripetizioni da togliere, le posizioni in _sorted sono gia' quelle finali
+    this->_pool.parallelFor(0, groups, 1, [this, size, shift, &graph](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t g = from; g < to; g++)
+        {
+            uint32_t last = (uint32_t) std::min<uint64_t>(size, ((uint64_t) g + 1) << shift);
+
+            for (uint32_t u = g << shift; u < last; u++)
+            {
+                graph._inOffsets[u] = this->_begins[u];
+            }
+
+            for (uint64_t pos = this->_groupOffsets[g]; pos < this->_groupOffsets[g + 1]; pos++)
+            {
+                graph._inSources[pos] = this->_sorted[pos].from;
+                graph._inWeights[pos] = this->_sorted[pos].weight;
+            }
+        }
+    });
+
+    std::vector<Link>().swap(this->_sorted);
+}
+
+#endif // _EDGELISTLOADER_H
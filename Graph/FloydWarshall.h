@@ -0,0 +1,513 @@
+#ifndef _FLOYDWARSHALL_H
+#define _FLOYDWARSHALL_H
+
+#include "Graph.h"
+#include "ShortestPath.h"
+#include "../Lib/MinPlus.h"
+#include "../Lib/ThreadPool.h"
+#include "../Lib/VisitedSet.h"
+
+#include <atomic>
+#include <limits>
+#include <vector>
+
+/**
+ * Motore per il calcolo dei cammini minimi fra tutte le coppie di nodi con l'algoritmo di
+ * Floyd-Warshall a blocchi, adatto a grafi densi o di qualche migliaio di nodi.
+ *
+ * Il grafo viene copiato in una matrice densa dei pesi (una riga per id di nodo, con le
+ * righe allungate a un multiplo di _TILE), poi la matrice viene divisa in blocchi di
+ * _TILE x _TILE elementi, che stanno in cache. Per ogni blocco k della diagonale:
+ *  - viene aggiornato il blocco (k, k);
+ *  - vengono aggiornati in parallelo i blocchi della riga k e della colonna k, che
+ *    dipendono solo da se' stessi e dal blocco (k, k);
+ *  - vengono aggiornati in parallelo tutti gli altri blocchi, che dipendono solo dai
+ *    blocchi della riga e della colonna k.
+ * Il ciclo interno e' un prodotto min-plus su righe contigue (minPlusRow), vettorizzato
+ * con SSE2 per pesi int e float, che aggiorna insieme distanze e passi successivi.
+ *
+ * Il risultato e' la matrice delle distanze, con ShortestPath::infinity() per le coppie non
+ * collegate, e la matrice dei passi successivi: getNextHop(u, v) e' il nodo che segue u
+ * nel cammino minimo da u a v, da cui getPath ricostruisce il cammino. Con archi di peso
+ * zero i passi successivi di Floyd-Warshall possono formare cicli fra nodi alla stessa
+ * distanza: in quel caso vengono ricalcolati con una visita all'indietro per ogni nodo di
+ * arrivo, lungo gli archi che stanno su un cammino minimo.
+ *
+ * La memoria occupata e' O(V^2) e il tempo O(V^3): per cammini da poche sorgenti su grafi
+ * grandi e sparsi conviene Dijkstra o DeltaStepping.
+ *
+ * @tparam TGraph : Tipo del grafo, con pesi non negativi e distanze minori della meta'
+ *                  del massimo rappresentabile
+ */
+template <class TGraph>
+class FloydWarshall
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+        typedef ShortestPath<LinkWeight> Path;
+
+        static const uint32_t NO_HOP = UINT32_MAX; // Passo successivo delle coppie non collegate
+
+    private:
+        static const uint32_t _TILE = 64; // Lato dei blocchi della matrice
+
+        const TGraph& _graph; // Grafo su cui calcolare i cammini
+        ThreadPool& _pool; // Thread su cui eseguire l'algoritmo
+        uint32_t _size; // Numero di righe significative della matrice
+        uint32_t _stride; // Lunghezza di una riga della matrice, multiplo di _TILE
+        std::vector<LinkWeight> _distances; // Matrice delle distanze, per righe
+        std::vector<uint32_t> _hops; // Matrice dei passi successivi, per righe
+        bool _zeroLinks; // Se true, il grafo ha archi di peso zero
+        std::vector<VisitedSet> _visited; // Nodi raggiunti dalla visita all'indietro di ogni thread
+        std::vector< std::vector<uint32_t> > _queues; // Coda della visita all'indietro di ogni thread
+        Path _path; // Ultimo cammino ricostruito
+
+    private:
+        static LinkWeight _unreachable();
+
+        void _load();
+        void _updateTile(uint32_t rowBlock, uint32_t columnBlock, uint32_t pivotBlock);
+        void _rebuildHops();
+        void _store();
+
+    public:
+        FloydWarshall(const TGraph& graph, ThreadPool& pool);
+
+        void run();
+
+        uint32_t getSize() const;
+        uint32_t getStride() const;
+        const std::vector<LinkWeight>& getDistances() const;
+        const std::vector<uint32_t>& getNextHops() const;
+
+        LinkWeight getDistance(const GraphNode& from, const GraphNode& to) const;
+        uint32_t getNextHop(const GraphNode& from, const GraphNode& to) const;
+        bool isReachable(const GraphNode& from, const GraphNode& to) const;
+        const Path& getPath(const GraphNode& from, const GraphNode& to);
+};
+
+template <class TGraph>
+const uint32_t FloydWarshall<TGraph>::NO_HOP;
+
+template <class TGraph>
+const uint32_t FloydWarshall<TGraph>::_TILE;
+
+
+/**
+ * Crea un motore Floyd-Warshall sul grafo dato, usando i thread di pool.
+ * Il grafo e il pool devono sopravvivere al motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo su cui calcolare i cammini minimi
+ * @param pool : Thread su cui eseguire l'algoritmo
+ */
+template <class TGraph>
+FloydWarshall<TGraph>::FloydWarshall(const TGraph& graph, ThreadPool& pool) : _graph(graph), _pool(pool)
+{
+    this->_size = 0;
+    this->_stride = 0;
+    this->_zeroLinks = false;
+}
+
+/**
+ * Calcola le distanze minime e i passi successivi fra tutte le coppie di nodi del grafo.
+ * Va richiamato dopo ogni modifica del grafo.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void FloydWarshall<TGraph>::run()
+{
+    this->_load();
+
+    uint32_t blocks = this->_stride / _TILE;
+
+    for (uint32_t k = 0; k < blocks; k++)
+    {
+        this->_updateTile(k, k, k);
+
+        // I primi blocks indici sono i blocchi della riga k, gli altri quelli della colonna k
+        this->_pool.parallelFor(0, 2 * blocks, 1, [this, k, blocks](uint32_t from, uint32_t to, uint32_t thread)
+        {
+            for (uint32_t t = from; t < to; t++)
+            {
+                uint32_t other = (t < blocks) ? t : t - blocks;
+
+                if (other == k)
+                {
+                    continue;
+                }
+
+                if (t < blocks)
+                {
+                    this->_updateTile(k, other, k);
+                }
+
+                else
+                {
+                    this->_updateTile(other, k, k);
+                }
+            }
+        });
+
+        this->_pool.parallelFor(0, blocks * blocks, 1, [this, k, blocks](uint32_t from, uint32_t to, uint32_t thread)
+        {
+            for (uint32_t t = from; t < to; t++)
+            {
+                uint32_t row = t / blocks;
+                uint32_t column = t % blocks;
+
+                if (row != k && column != k)
+                {
+                    this->_updateTile(row, column, k);
+                }
+            }
+        });
+    }
+
+    if (this->_zeroLinks)
+    {
+        this->_rebuildHops();
+    }
+
+    this->_store();
+}
+
+/**
+ * Restituisce il numero di nodi della matrice, cioe' il numero massimo di nodi del grafo
+ * all'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di righe significative della matrice
+ */
+template <class TGraph>
+uint32_t FloydWarshall<TGraph>::getSize() const
+{
+    return this->_size;
+}
+
+/**
+ * Restituisce la lunghezza di una riga delle matrici restituite da getDistances e
+ * getNextHops: l'elemento (u, v) e' in posizione u * getStride() + v
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Lunghezza di una riga
+ */
+template <class TGraph>
+uint32_t FloydWarshall<TGraph>::getStride() const
+{
+    return this->_stride;
+}
+
+/**
+ * Restituisce la matrice delle distanze dell'ultima esecuzione, per righe di getStride()
+ * elementi; le coppie non collegate hanno distanza ShortestPath::infinity()
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Matrice delle distanze
+ */
+template <class TGraph>
+const std::vector<typename FloydWarshall<TGraph>::LinkWeight>& FloydWarshall<TGraph>::getDistances() const
+{
+    return this->_distances;
+}
+
+/**
+ * Restituisce la matrice dei passi successivi dell'ultima esecuzione, per righe di
+ * getStride() elementi; le coppie non collegate hanno passo NO_HOP
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Matrice dei passi successivi
+ */
+template <class TGraph>
+const std::vector<uint32_t>& FloydWarshall<TGraph>::getNextHops() const
+{
+    return this->_hops;
+}
+
+/**
+ * Restituisce la distanza minima fra due nodi
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @return Distanza minima, ShortestPath::infinity() se to non e' raggiungibile da from
+ */
+template <class TGraph>
+typename FloydWarshall<TGraph>::LinkWeight FloydWarshall<TGraph>::getDistance(const GraphNode& from, const GraphNode& to) const
+{
+    if (from.getId() >= this->_size || to.getId() >= this->_size)
+    {
+        return Path::infinity();
+    }
+
+    return this->_distances[(std::size_t) from.getId() * this->_stride + to.getId()];
+}
+
+/**
+ * Restituisce il nodo che segue from nel cammino minimo da from a to
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @return Id del passo successivo, to stesso se from = to, NO_HOP se to non e' raggiungibile
+ */
+template <class TGraph>
+uint32_t FloydWarshall<TGraph>::getNextHop(const GraphNode& from, const GraphNode& to) const
+{
+    if (from.getId() >= this->_size || to.getId() >= this->_size)
+    {
+        return NO_HOP;
+    }
+
+    return this->_hops[(std::size_t) from.getId() * this->_stride + to.getId()];
+}
+
+/**
+ * Restituisce true se to e' raggiungibile da from
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @return True se esiste un cammino da from a to, altrimenti false
+ */
+template <class TGraph>
+bool FloydWarshall<TGraph>::isReachable(const GraphNode& from, const GraphNode& to) const
+{
+    return this->getNextHop(from, to) != NO_HOP;
+}
+
+/**
+ * Ricostruisce il cammino minimo da from a to seguendo i passi successivi.
+ * Il riferimento restituito resta valido fino alla chiamata successiva.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @return Cammino minimo, non trovato se to non e' raggiungibile da from
+ */
+template <class TGraph>
+const typename FloydWarshall<TGraph>::Path& FloydWarshall<TGraph>::getPath(const GraphNode& from, const GraphNode& to)
+{
+    this->_path.clear();
+
+    if (!this->isReachable(from, to))
+    {
+        return this->_path;
+    }
+
+    uint32_t current = from.getId();
+
+    this->_path.append(current);
+
+    while (current != to.getId())
+    {
+        current = this->_hops[(std::size_t) current * this->_stride + to.getId()];
+        this->_path.append(current);
+    }
+
+    this->_path.setCost(this->getDistance(from, to));
+
+    return this->_path;
+}
+
+
+/**
+ * Restituisce il valore usato durante il calcolo per le coppie non collegate: la meta'
+ * del massimo, cosi' che la somma di due distanze non vada mai in overflow
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Distanza infinita interna
+ */
+template <class TGraph>
+typename FloydWarshall<TGraph>::LinkWeight FloydWarshall<TGraph>::_unreachable()
+{
+    return std::numeric_limits<LinkWeight>::max() / 2;
+}
+
+/**
+ * Copia in parallelo il grafo nella matrice dei pesi: ogni nodo ha distanza zero da
+ * se' stesso, ogni arco ha il suo peso (il minimo fra archi paralleli) e le altre coppie
+ * sono scollegate. I nodi disabilitati e le righe aggiunte per arrivare a un multiplo
+ * di _TILE restano scollegati da tutti.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void FloydWarshall<TGraph>::_load()
+{
+    this->_size = this->_graph.getMaxNodeAmount();
+    this->_stride = (this->_size + _TILE - 1) / _TILE * _TILE;
+
+    std::size_t cells = (std::size_t) this->_stride * this->_stride;
+
+    this->_distances.resize(cells);
+    this->_hops.resize(cells);
+
+    std::atomic<bool> zeroLinks(false);
+
+    this->_pool.parallelFor(0, this->_stride, 1, [this, &zeroLinks](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t u = from; u < to; u++)
+        {
+            LinkWeight* distances = &this->_distances[(std::size_t) u * this->_stride];
+            uint32_t* hops = &this->_hops[(std::size_t) u * this->_stride];
+
+            for (uint32_t v = 0; v < this->_stride; v++)
+            {
+                distances[v] = _unreachable();
+                hops[v] = NO_HOP;
+            }
+
+            if (u >= this->_size || !this->_graph.isNodeEnabled(GraphNode(u)))
+            {
+                continue;
+            }
+
+            distances[u] = LinkWeight();
+            hops[u] = u;
+
+            for (auto link : this->_graph.getOutLinks(GraphNode(u)))
+            {
+                if (link.weight == LinkWeight())
+                {
+                    zeroLinks.store(true, std::memory_order_relaxed);
+                }
+
+                if (link.weight < distances[link.id])
+                {
+                    distances[link.id] = link.weight;
+                    hops[link.id] = link.id;
+                }
+            }
+        }
+    });
+
+    this->_zeroLinks = zeroLinks.load();
+}
+
+/**
+ * Aggiorna il blocco (rowBlock, columnBlock) con i cammini che passano per i nodi del
+ * blocco pivotBlock. Il ciclo esterno scorre i nodi intermedi, cosi' che il blocco possa
+ * coincidere con quelli della riga e della colonna pivotBlock: la riga e la colonna del
+ * nodo intermedio k non cambiano durante il passo k, perche' la distanza di k da se'
+ * stesso e' zero.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param rowBlock : Indice della riga di blocchi
+ * @param columnBlock : Indice della colonna di blocchi
+ * @param pivotBlock : Indice del blocco dei nodi intermedi
+ */
+template <class TGraph>
+void FloydWarshall<TGraph>::_updateTile(uint32_t rowBlock, uint32_t columnBlock, uint32_t pivotBlock)
+{
+    std::size_t stride = this->_stride;
+    std::size_t firstRow = (std::size_t) rowBlock * _TILE;
+    std::size_t firstColumn = (std::size_t) columnBlock * _TILE;
+    std::size_t firstPivot = (std::size_t) pivotBlock * _TILE;
+
+    // Se il blocco non e' ne' nella riga ne' nella colonna pivotBlock i nodi intermedi
+    // possono essere scorsi nel ciclo interno, tenendo in cache una sola riga del blocco
+    bool independent = (rowBlock != pivotBlock && columnBlock != pivotBlock);
+
+    for (std::size_t outer = 0; outer < _TILE; outer++)
+    {
+        for (std::size_t inner = 0; inner < _TILE; inner++)
+        {
+            std::size_t i = firstRow + (independent ? outer : inner);
+            std::size_t k = firstPivot + (independent ? inner : outer);
+            LinkWeight distance = this->_distances[i * stride + k];
+
+            // Se k non e' raggiungibile da i nessun cammino di i puo' migliorare
+            if (!(distance < _unreachable()))
+            {
+                continue;
+            }
+
+            minPlusRow(&this->_distances[i * stride + firstColumn], &this->_hops[i * stride + firstColumn],
+                       &this->_distances[k * stride + firstColumn], distance, this->_hops[i * stride + k], _TILE);
+        }
+    }
+}
+
+/**
+ * Ricalcola in parallelo i passi successivi, una colonna per nodo di arrivo t: una visita
+ * in ampiezza all'indietro da t lungo gli archi (u, v) con distanza(u, t) = peso +
+ * distanza(v, t) assegna a ogni nodo u il nodo v da cui e' stato scoperto. Il numero di
+ * archi fino a t decresce lungo i passi, quindi non ci sono cicli neanche fra nodi alla
+ * stessa distanza. I nodi non scoperti (possibile solo per arrotondamenti in virgola
+ * mobile) conservano il passo calcolato da Floyd-Warshall.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void FloydWarshall<TGraph>::_rebuildHops()
+{
+    this->_visited.resize(this->_pool.getThreadAmount());
+    this->_queues.resize(this->_pool.getThreadAmount());
+
+    this->_pool.parallelFor(0, this->_size, 1, [this](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        VisitedSet& visited = this->_visited[thread];
+        std::vector<uint32_t>& queue = this->_queues[thread];
+        std::size_t stride = this->_stride;
+
+        for (uint32_t target = from; target < to; target++)
+        {
+            if (!this->_graph.isNodeEnabled(GraphNode(target)))
+            {
+                continue;
+            }
+
+            visited.begin(this->_size);
+            visited.visit(target);
+            queue.clear();
+            queue.push_back(target);
+
+            for (std::size_t head = 0; head < queue.size(); head++)
+            {
+                uint32_t v = queue[head];
+                LinkWeight distance = this->_distances[v * stride + target];
+
+                for (auto link : this->_graph.getInLinks(GraphNode(v)))
+                {
+                    uint32_t u = link.id;
+
+                    if (!visited.isVisited(u) && this->_distances[u * stride + target] == distance + link.weight)
+                    {
+                        visited.visit(u);
+                        this->_hops[u * stride + target] = v;
+                        queue.push_back(u);
+                    }
+                }
+            }
+        }
+    });
+}
+
+/**
+ * Sostituisce in parallelo la distanza infinita interna con ShortestPath::infinity()
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void FloydWarshall<TGraph>::_store()
+{
+    this->_pool.parallelFor(0, this->_stride, 1, [this](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t u = from; u < to; u++)
+        {
+            std::size_t row = (std::size_t) u * this->_stride;
+
+            for (uint32_t v = 0; v < this->_stride; v++)
+            {
+                if (this->_hops[row + v] == NO_HOP)
+                {
+                    this->_distances[row + v] = Path::infinity();
+                }
+            }
+        }
+    });
+}
+
+#endif // _FLOYDWARSHALL_H
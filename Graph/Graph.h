@@ -2,10 +2,35 @@
 #define _GRAPH_H
 
 #include "IGraph.h"
+#include "ShortestPath.h"
+#include "ShortestPathTree.h"
+#include "LinkIterator.h"
+#include "../UnionFind/UnionFind.h"
 #include <string>
 #include <iostream>
 #include <limits>
+#include <vector>
 
+template <class TGraph>
+class Dijkstra;
+
+template <class TGraph>
+class BidirectionalDijkstra;
+
+template <class TGraph>
+class Reachability;
+
+template <class TGraph>
+class GraphTraversal;
+
+template <class TLinkWeight>
+class PathVisitor;
+
+template <class TLinkWeight>
+class PrintVisitor;
+
+template <class TNodeLabel, class TLinkWeight>
+class CsrGraph;
 
 /**
  * Descrive un generico arco di un grafo. Dato che la classe Graph rappresenta un grafo
@@ -134,7 +159,7 @@ GraphNode& GraphNode::operator=(const GraphNode& node)
 /**
  * Contiene informazioni aggiuntive ad un nodo del grafo.
  * Tra le informazioni aggiuntive vengono indicate se il nodo e' attivo, la sua
- * etichetta e una lista archi uscenti da esso.
+ * etichetta, una lista archi uscenti da esso e il numero di archi uscenti ed entranti.
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
@@ -150,6 +175,8 @@ class GraphNodeInfo
         bool isEnabled;
         TNodeLabel label; // Etichetta del nodo
         LinkInfo<TLinkWeight>* adjacencyMatrixCols; // Archi uscenti dal nodo
+        uint32_t outDegree; // Numero di archi uscenti dal nodo
+        uint32_t inDegree; // Numero di archi entranti nel nodo
 
     public:
         GraphNodeInfo();
@@ -171,6 +198,9 @@ GraphNodeInfo<TNodeLabel, TLinkWeight>::GraphNodeInfo()
      * Essendo inattivo, non possiede etichetta o archi uscenti.
      * L'array adjacencyMatrixCols verra' creato non appena il nodo sara' attivo
      */
+    this->adjacencyMatrixCols = nullptr;
+    this->outDegree = 0;
+    this->inDegree = 0;
 }
 
 /**
@@ -191,7 +221,205 @@ GraphNodeInfo<TNodeLabel, TLinkWeight>::~GraphNodeInfo()
 
 
 
+/**
+ * Iteratore sugli archi uscenti di un nodo, cioe' sulle celle attive di una riga
+ * della matrice di adiacenza. Le celle senza arco vengono saltate.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class MatrixRowIterator
+{
+    private:
+        const LinkInfo<TLinkWeight>* _row; // Riga della matrice di adiacenza
+        uint32_t _pos; // Colonna corrente
+        uint32_t _size; // Numero di colonne della riga
+
+    private:
+        void _skipInactive();
+
+    public:
+        MatrixRowIterator(const LinkInfo<TLinkWeight>* row, uint32_t pos, uint32_t size);
+
+        GraphNeighbour<TLinkWeight> operator*() const;
+        MatrixRowIterator<TLinkWeight>& operator++();
+        bool operator!=(const MatrixRowIterator<TLinkWeight>& it) const;
+};
+
+/**
+ * Crea un iteratore che parte dalla colonna pos della riga, posizionandosi sul primo arco attivo
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param row : Riga della matrice di adiacenza
+ * @param pos : Colonna di partenza
+ * @param size : Numero di colonne della riga
+ */
+template <class TLinkWeight>
+MatrixRowIterator<TLinkWeight>::MatrixRowIterator(const LinkInfo<TLinkWeight>* row, uint32_t pos, uint32_t size)
+{
+    this->_row = row;
+    this->_pos = pos;
+    this->_size = size;
+
+    this->_skipInactive();
+}
+
+/**
+ * Restituisce l'arco corrente
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Nodo di arrivo e peso dell'arco
+ */
+template <class TLinkWeight>
+GraphNeighbour<TLinkWeight> MatrixRowIterator<TLinkWeight>::operator*() const
+{
+    GraphNeighbour<TLinkWeight> neighbour;
+
+    neighbour.id = this->_pos;
+    neighbour.weight = this->_row[this->_pos].weight;
+
+    return neighbour;
+}
+
+/**
+ * Avanza al prossimo arco attivo della riga
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Iteratore aggiornato
+ */
+template <class TLinkWeight>
+MatrixRowIterator<TLinkWeight>& MatrixRowIterator<TLinkWeight>::operator++()
+{
+    this->_pos++;
+    this->_skipInactive();
+
+    return *this;
+}
+
+template <class TLinkWeight>
+bool MatrixRowIterator<TLinkWeight>::operator!=(const MatrixRowIterator<TLinkWeight>& it) const
+{
+    return (this->_pos != it._pos);
+}
+
+/**
+ * Salta le colonne che non contengono un arco attivo
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+void MatrixRowIterator<TLinkWeight>::_skipInactive()
+{
+    while (this->_pos < this->_size && !this->_row[this->_pos].linkExists)
+    {
+        this->_pos++;
+    }
+}
+
+
+/**
+ * Iteratore sugli archi entranti in un nodo, cioe' sulle celle attive di una colonna
+ * della matrice di adiacenza. Le righe dei nodi inattivi vengono saltate.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+class MatrixColumnIterator
+{
+    private:
+        const GraphNodeInfo<TNodeLabel, TLinkWeight>* _rows; // Righe della matrice di adiacenza
+        uint32_t _column; // Colonna da percorrere, cioe' il nodo di arrivo
+        uint32_t _pos; // Riga corrente
+        uint32_t _size; // Numero di righe
+
+    private:
+        void _skipInactive();
+
+    public:
+        MatrixColumnIterator(const GraphNodeInfo<TNodeLabel, TLinkWeight>* rows, uint32_t column, uint32_t pos, uint32_t size);
+
+        GraphNeighbour<TLinkWeight> operator*() const;
+        MatrixColumnIterator<TNodeLabel, TLinkWeight>& operator++();
+        bool operator!=(const MatrixColumnIterator<TNodeLabel, TLinkWeight>& it) const;
+};
+
+/**
+ * Crea un iteratore che parte dalla riga pos della colonna, posizionandosi sul primo arco attivo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param rows : Righe della matrice di adiacenza
+ * @param column : Colonna da percorrere
+ * @param pos : Riga di partenza
+ * @param size : Numero di righe
+ */
+template <class TNodeLabel, class TLinkWeight>
+MatrixColumnIterator<TNodeLabel, TLinkWeight>::MatrixColumnIterator(const GraphNodeInfo<TNodeLabel, TLinkWeight>* rows, uint32_t column, uint32_t pos, uint32_t size)
+{
+    this->_rows = rows;
+    this->_column = column;
+    this->_pos = pos;
+    this->_size = size;
+
+    this->_skipInactive();
+}
+
+/**
+ * Restituisce l'arco corrente
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Nodo di partenza e peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+GraphNeighbour<TLinkWeight> MatrixColumnIterator<TNodeLabel, TLinkWeight>::operator*() const
+{
+    GraphNeighbour<TLinkWeight> neighbour;
+
+    neighbour.id = this->_pos;
+    neighbour.weight = this->_rows[this->_pos].adjacencyMatrixCols[this->_column].weight;
+
+    return neighbour;
+}
+
+/**
+ * Avanza al prossimo arco attivo della colonna
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Iteratore aggiornato
+ */
+template <class TNodeLabel, class TLinkWeight>
+MatrixColumnIterator<TNodeLabel, TLinkWeight>& MatrixColumnIterator<TNodeLabel, TLinkWeight>::operator++()
+{
+    this->_pos++;
+    this->_skipInactive();
+
+    return *this;
+}
+
+template <class TNodeLabel, class TLinkWeight>
+bool MatrixColumnIterator<TNodeLabel, TLinkWeight>::operator!=(const MatrixColumnIterator<TNodeLabel, TLinkWeight>& it) const
+{
+    return (this->_pos != it._pos);
+}
 
+/**
+ * Salta le righe dei nodi inattivi o senza arco verso la colonna
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MatrixColumnIterator<TNodeLabel, TLinkWeight>::_skipInactive()
+{
+    while (this->_pos < this->_size &&
+           !(this->_rows[this->_pos].isEnabled && this->_rows[this->_pos].adjacencyMatrixCols[this->_column].linkExists))
+    {
+        this->_pos++;
+    }
+}
 
 
 /**
@@ -199,6 +427,22 @@ GraphNodeInfo<TNodeLabel, TLinkWeight>::~GraphNodeInfo()
  * Al suo interno troviamo: il numero massimo di nodi ammessi, il numero corrente di nodi
  * nel grafo e il numero di archi presenti nel grafo.
  *
+ * Quando la matrice e' piena, addNode() ne raddoppia righe e colonne, quindi il costo di
+ * crescita per nodo inserito e' ammortizzato. Gli id liberati da eraseNode() finiscono in
+ * una lista di id liberi e vengono riusati, a partire dall'ultimo liberato, prima degli id
+ * mai usati: l'inserimento trova un id in tempo costante. La crescita invalida gli
+ * intervalli restituiti da getOutLinks() e getInLinks().
+ *
+ * I gradi dei nodi e i loro istogrammi sono aggiornati da addLink, eraseLink ed eraseNode,
+ * cosi' che gradi, gradi medi e istogrammi si leggano in tempo costante.
+ *
+ * Le componenti connesse (con gli archi considerati non orientati) sono mantenute in una
+ * struttura union-find: addLink unisce le componenti dei due estremi in tempo quasi
+ * costante, quindi areConnected e getComponentAmount non richiedono visite. Una
+ * cancellazione che tocca degli archi puo' spezzare una componente, e l'union-find non
+ * sa separare gli insiemi: le componenti vengono ricalcolate, in O(V^2), alla prima
+ * interrogazione successiva.
+ *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
  */
@@ -206,29 +450,46 @@ template <class TNodeLabel, class TLinkWeight>
 class Graph : public IGraph<GraphNode, TNodeLabel, Link<GraphNode>, TLinkWeight>
 {
     public:
-        typedef Link<GraphNode> Link;
+        typedef ::Link<GraphNode> Link;
         typedef LinkedList<uint32_t> GraphNodeList;
         typedef LinkedList<Link> LinkList;
+        typedef TNodeLabel NodeLabel;
+        typedef TLinkWeight LinkWeight;
+        typedef LinkRange< MatrixRowIterator<TLinkWeight> > OutLinkRange;
+        typedef LinkRange< MatrixColumnIterator<TNodeLabel, TLinkWeight> > InLinkRange;
 
-    private:
-        const int _INFINITY = INT_MAX; // Costante utile per l'algoritmo di Disjkstra
-        const int _NON_EXISTING = -2; // Costante utile per l'algoritmo di Disjkstra
+        template <class TypeNodeLabel, class TypeLinkWeight>
+        friend class CsrGraph;
 
+    private:
         GraphNodeInfo<TNodeLabel, TLinkWeight>* _adjacencyMatrixRows; // Contiene i nodi presenti nel grafo.
-        uint32_t _gSize; // Numero massimo di nodi inseribili nel grafo.
+        uint32_t _gSize; // Numero di righe allocate, cioe' nodi inseribili prima della prossima crescita
         uint32_t _nodeAmount; // Numero di nodi presenti attualmente nel grafo
         uint32_t _linkAmount; // Numero di archi presenti attualmente nel grafo
+        uint32_t _nextId; // Primo id mai assegnato ad un nodo
+        std::vector<uint32_t> _freeIds; // Id liberati da eraseNode, da riusare
+        std::vector<uint32_t> _outDegreeHistogram; // Numero di nodi per ogni grado uscente
+        std::vector<uint32_t> _inDegreeHistogram; // Numero di nodi per ogni grado entrante
+        UnionFind _components; // Componenti connesse, un elemento per riga della matrice
+        bool _componentsValid; // Se false, una cancellazione ha reso _components da ricalcolare
 
     private:
-        void _dfs(const GraphNode& start, bool* isVisited) const;
-        void _dfsWalk(const GraphNode& start, const GraphNode& end, bool* isVisited, bool& endWalk, GraphNodeList& walkList);
+        uint32_t _allocateId();
+        void _grow(uint32_t size);
+        void _updateComponents();
+
+        static void _histogramAdd(std::vector<uint32_t>& histogram, uint32_t degree);
+        static void _histogramRemove(std::vector<uint32_t>& histogram, uint32_t degree);
 
     public:
         Graph(uint32_t size);
         ~Graph();
 
+        void reserve(uint32_t size);
+
         uint32_t getNodeAmount() const;
         uint32_t getLinkAmount() const;
+        uint32_t getMaxNodeAmount() const;
 
         void create();
 
@@ -252,21 +513,33 @@ class Graph : public IGraph<GraphNode, TNodeLabel, Link<GraphNode>, TLinkWeight>
         GraphNodeList getAdjacentToANode(const GraphNode& node) const;
         GraphNodeList getAdjacentFromANode(const GraphNode& node) const;
 
+        OutLinkRange getOutLinks(const GraphNode& node) const;
+        InLinkRange getInLinks(const GraphNode& node) const;
+
         uint32_t getDegreeTo(const GraphNode& node) const;
         uint32_t getDegreeFrom(const GraphNode& node) const;
 
         double getDegreeToAvg() const;
         double getDegreeFromAvg() const;
 
+        const std::vector<uint32_t>& getDegreeToHistogram() const;
+        const std::vector<uint32_t>& getDegreeFromHistogram() const;
+
         GraphNodeList getAdjacentNode(const GraphNode& node) const;
         GraphNodeList getAllNodes() const;
 
         void bfs(const GraphNode& start) const;
         void dfs(const GraphNode& start) const;
         void dijkstra(const GraphNode& start) const;
+        GraphNodeList shortestPath(const GraphNode& start, const GraphNode& end, TLinkWeight& cost) const;
+
+        bool areConnected(const GraphNode& first, const GraphNode& second);
+        uint32_t getComponent(const GraphNode& node);
+        uint32_t getComponentAmount();
 
         GraphNodeList dfsWalk(const GraphNode& start, const GraphNode& end);
         GraphNodeList getSameReachableNodes(const GraphNode& node);
+        void getSameReachableNodes(const std::vector<GraphNode>& nodes, std::vector<GraphNodeList>& results);
 
         template <class TypeNodeLabel, class TypeLinkWeight>
         friend std::ostream& operator<<(std::ostream&, Graph<TypeNodeLabel, TypeLinkWeight>& graph);
@@ -276,6 +549,7 @@ class Graph : public IGraph<GraphNode, TNodeLabel, Link<GraphNode>, TLinkWeight>
 
 /**
  * Costruisce una matrice di adiacenza con un numero di righe pari a size.
+ * size e' solo la capacita' iniziale: il grafo cresce quando viene riempito.
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
@@ -287,16 +561,13 @@ Graph<TNodeLabel, TLinkWeight>::Graph(uint32_t size)
     this->_gSize = size;
     this->_nodeAmount = 0;
     this->_linkAmount = 0;
+    this->_nextId = 0;
+    this->_components.reset(size);
+    this->_componentsValid = true;
 
     // Creo la matrice di adiacenza allocandoli le prime size righe.
+    // Le colonne di una riga vengono allocate quando il nodo diventa attivo
     this->_adjacencyMatrixRows = new GraphNodeInfo<TNodeLabel, TLinkWeight>[this->_gSize]();
-
-
-    // Alloco le colonne
-    for (uint32_t i = 0; i < this->_gSize; i++)
-    {
-        this->_adjacencyMatrixRows[i].adjacencyMatrixCols = nullptr;
-    }
 }
 
 /**
@@ -347,6 +618,21 @@ uint32_t Graph<TNodeLabel, TLinkWeight>::getLinkAmount() const
 }
 
 
+/**
+ * Restituisce il numero di righe allocate nella matrice di adiacenza. Gli id dei nodi
+ * sono compresi fra 0 e questo valore escluso; il valore cresce quando il grafo si riempie.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero massimo di nodi
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t Graph<TNodeLabel, TLinkWeight>::getMaxNodeAmount() const
+{
+    return this->_gSize;
+}
+
+
 template <class TNodeLabel, class TLinkWeight>
 void Graph<TNodeLabel, TLinkWeight>::create() { }
 
@@ -376,7 +662,7 @@ bool Graph<TNodeLabel, TLinkWeight>::isNodeEnabled(const GraphNode& node) const
 {
     uint32_t id = node.getId();
 
-    return (this->_adjacencyMatrixRows[id].isEnabled);
+    return (id < this->_gSize && this->_adjacencyMatrixRows[id].isEnabled);
 }
 
 /**
@@ -418,9 +704,10 @@ TNodeLabel Graph<TNodeLabel, TLinkWeight>::getLabel(const GraphNode& node) const
     if (this->isNodeEnabled(node))
     {
         uint32_t id = node.getId();
-        this->_adjacencyMatrixRows[id].label;
+        return this->_adjacencyMatrixRows[id].label;
     }
 
+    return TNodeLabel();
 }
 
 /**
@@ -453,8 +740,8 @@ TLinkWeight Graph<TNodeLabel, TLinkWeight>::getWeight(const GraphNode& from, con
 /**
  * Aggiungo un nodo nel grafo con una sua etichetta.
  *
- * Se ho raggiunto il limite massimo di nodi, il nuovo nodo non verra'
- * inserito nel grafo
+ * Il nodo riceve l'ultimo id liberato da eraseNode, oppure il primo id mai usato;
+ * se la matrice di adiacenza e' piena, viene raddoppiata.
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
@@ -464,28 +751,20 @@ TLinkWeight Graph<TNodeLabel, TLinkWeight>::getWeight(const GraphNode& from, con
 template <class TNodeLabel, class TLinkWeight>
 void Graph<TNodeLabel, TLinkWeight>::addNode(GraphNode& node, TNodeLabel label)
 {
-    if (this->_nodeAmount >= this->_gSize)
-    {
-        return; // Ho superato il numero massimo di nodi consentiti
-    }
+    uint32_t id = this->_allocateId();
 
-    for (uint32_t i = 0; i < this->_gSize; i++)
-    {
-        if (!this->_adjacencyMatrixRows[i].isEnabled)
-        {
-            // Ho una riga della matrice di adiacenza libera
-
-            node.setId(i);
-            this->_adjacencyMatrixRows[i].isEnabled = true;
-            this->_adjacencyMatrixRows[i].label = label;
+    node.setId(id);
+    this->_adjacencyMatrixRows[id].isEnabled = true;
+    this->_adjacencyMatrixRows[id].label = label;
 
-            // Alloco dello spazio per le colonne della riga di adiacenza
-            this->_adjacencyMatrixRows[i].adjacencyMatrixCols = new LinkInfo<TLinkWeight>[this->_gSize]();
-            this->_nodeAmount++;
+    // Alloco dello spazio per le colonne della riga di adiacenza
+    this->_adjacencyMatrixRows[id].adjacencyMatrixCols = new LinkInfo<TLinkWeight>[this->_gSize]();
+    this->_adjacencyMatrixRows[id].outDegree = 0;
+    this->_adjacencyMatrixRows[id].inDegree = 0;
+    this->_nodeAmount++;
 
-            break;
-        }
-    }
+    Graph<TNodeLabel, TLinkWeight>::_histogramAdd(this->_outDegreeHistogram, 0);
+    Graph<TNodeLabel, TLinkWeight>::_histogramAdd(this->_inDegreeHistogram, 0);
 }
 
 
@@ -499,26 +778,23 @@ void Graph<TNodeLabel, TLinkWeight>::addNode(GraphNode& node, TNodeLabel label)
 template <class TNodeLabel, class TLinkWeight>
 void Graph<TNodeLabel, TLinkWeight>::addNode(GraphNode& node)
 {
-    if (this->_nodeAmount >= this->_gSize)
-    {
-        return; // Ho superato il numero massimo di nodi consentiti
-    }
+    this->addNode(node, TNodeLabel());
+}
 
-    for (uint32_t i = 0; i < this->_gSize; i++)
+/**
+ * Porta la capacita' del grafo ad almeno size nodi, cosi' che i successivi inserimenti
+ * non debbano far crescere la matrice
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param size : Numero di nodi da poter inserire senza crescita
+ */
+template <class TNodeLabel, class TLinkWeight>
+void Graph<TNodeLabel, TLinkWeight>::reserve(uint32_t size)
+{
+    if (size > this->_gSize)
     {
-        if (!this->_adjacencyMatrixRows[i].isEnabled)
-        {
-            // Ho una riga della matrice di adiacenza libera
-
-            node.setId(i);
-            this->_adjacencyMatrixRows[i].isEnabled = true;
-
-            // Alloco dello spazio per le colonne della riga di adiacenza
-            this->_adjacencyMatrixRows[i].adjacencyMatrixCols = new LinkInfo<TLinkWeight>[this->_gSize]();
-            this->_nodeAmount++;
-
-            break;
-        }
+        this->_grow(size);
     }
 }
 
@@ -549,11 +825,31 @@ void Graph<TNodeLabel, TLinkWeight>::addLink(GraphNode& from, GraphNode& to, TLi
 
     uint32_t fromId = from.getId();
     uint32_t toId = to.getId();
+    LinkInfo<TLinkWeight>& link = this->_adjacencyMatrixRows[fromId].adjacencyMatrixCols[toId];
 
-    this->_adjacencyMatrixRows[fromId].adjacencyMatrixCols[toId].linkExists = true;
-    this->_adjacencyMatrixRows[fromId].adjacencyMatrixCols[toId].weight = weight;
+    link.weight = weight;
 
+    // Se l'arco esiste gia' ne aggiorno solo il peso
+    if (link.linkExists)
+    {
+        return;
+    }
+
+    link.linkExists = true;
     this->_linkAmount++;
+
+    if (this->_componentsValid)
+    {
+        this->_components.unite(fromId, toId);
+    }
+
+    uint32_t& outDegree = this->_adjacencyMatrixRows[fromId].outDegree;
+    Graph<TNodeLabel, TLinkWeight>::_histogramRemove(this->_outDegreeHistogram, outDegree);
+    Graph<TNodeLabel, TLinkWeight>::_histogramAdd(this->_outDegreeHistogram, ++outDegree);
+
+    uint32_t& inDegree = this->_adjacencyMatrixRows[toId].inDegree;
+    Graph<TNodeLabel, TLinkWeight>::_histogramRemove(this->_inDegreeHistogram, inDegree);
+    Graph<TNodeLabel, TLinkWeight>::_histogramAdd(this->_inDegreeHistogram, ++inDegree);
 }
 
 
@@ -574,7 +870,28 @@ void Graph<TNodeLabel, TLinkWeight>::eraseNode(GraphNode& node)
 
     // Disabilito il nodo
     uint32_t idToRemove = node.getId();
-    this->_adjacencyMatrixRows[idToRemove].isEnabled = false;
+    GraphNodeInfo<TNodeLabel, TLinkWeight>& removed = this->_adjacencyMatrixRows[idToRemove];
+    removed.isEnabled = false;
+
+    // Un nodo isolato e' gia' un insieme a se', e le altre componenti non cambiano
+    if (removed.outDegree != 0 || removed.inDegree != 0)
+    {
+        this->_componentsValid = false;
+    }
+
+    // Elimino tutti gli archi uscenti dal nodo da cancellare, compreso un eventuale cappio
+    for (uint32_t j = 0; j < this->_gSize; j++)
+    {
+        if (removed.adjacencyMatrixCols[j].linkExists)
+        {
+            removed.adjacencyMatrixCols[j].linkExists = false;
+            this->_linkAmount--;
+
+            uint32_t& inDegree = this->_adjacencyMatrixRows[j].inDegree;
+            Graph<TNodeLabel, TLinkWeight>::_histogramRemove(this->_inDegreeHistogram, inDegree);
+            Graph<TNodeLabel, TLinkWeight>::_histogramAdd(this->_inDegreeHistogram, --inDegree);
+        }
+    }
 
     // Elimino tutti gli archi entranti nel nodo da cancellare
     for (uint32_t i = 0; i < this->_gSize; i++)
@@ -585,21 +902,25 @@ void Graph<TNodeLabel, TLinkWeight>::eraseNode(GraphNode& node)
             {
                 this->_adjacencyMatrixRows[i].adjacencyMatrixCols[idToRemove].linkExists = false;
                 this->_linkAmount--;
+
+                uint32_t& outDegree = this->_adjacencyMatrixRows[i].outDegree;
+                Graph<TNodeLabel, TLinkWeight>::_histogramRemove(this->_outDegreeHistogram, outDegree);
+                Graph<TNodeLabel, TLinkWeight>::_histogramAdd(this->_outDegreeHistogram, --outDegree);
             }
         }
     }
 
-    // Elimino tutti gli archi uscenti dal nodo da cancellare
-    for (uint32_t j = 0; j < this->_gSize; j++)
-    {
-        if (this->_adjacencyMatrixRows[idToRemove].adjacencyMatrixCols[j].linkExists)
-        {
-            this->_linkAmount--;
-        }
-    }
+    // Il nodo esce dagli istogrammi con i gradi con cui vi era registrato
+    Graph<TNodeLabel, TLinkWeight>::_histogramRemove(this->_outDegreeHistogram, removed.outDegree);
+    Graph<TNodeLabel, TLinkWeight>::_histogramRemove(this->_inDegreeHistogram, removed.inDegree);
+    removed.outDegree = 0;
+    removed.inDegree = 0;
 
     delete[] this->_adjacencyMatrixRows[idToRemove].adjacencyMatrixCols;
     this->_adjacencyMatrixRows[idToRemove].adjacencyMatrixCols = nullptr;
+
+    this->_freeIds.push_back(idToRemove);
+    this->_nodeAmount--;
 }
 
 
@@ -621,9 +942,24 @@ void Graph<TNodeLabel, TLinkWeight>::eraseLink(GraphNode& from, GraphNode& to)
 
     uint32_t fromId = from.getId();
     uint32_t toId = to.getId();
+    LinkInfo<TLinkWeight>& link = this->_adjacencyMatrixRows[fromId].adjacencyMatrixCols[toId];
+
+    if (!link.linkExists)
+    {
+        return;
+    }
 
-    this->_adjacencyMatrixRows[fromId].adjacencyMatrixCols[toId].linkExists = false;
+    link.linkExists = false;
     this->_linkAmount--;
+    this->_componentsValid = false;
+
+    uint32_t& outDegree = this->_adjacencyMatrixRows[fromId].outDegree;
+    Graph<TNodeLabel, TLinkWeight>::_histogramRemove(this->_outDegreeHistogram, outDegree);
+    Graph<TNodeLabel, TLinkWeight>::_histogramAdd(this->_outDegreeHistogram, --outDegree);
+
+    uint32_t& inDegree = this->_adjacencyMatrixRows[toId].inDegree;
+    Graph<TNodeLabel, TLinkWeight>::_histogramRemove(this->_inDegreeHistogram, inDegree);
+    Graph<TNodeLabel, TLinkWeight>::_histogramAdd(this->_inDegreeHistogram, --inDegree);
 }
 
 
@@ -691,22 +1027,11 @@ typename Graph<TNodeLabel, TLinkWeight>::GraphNodeList Graph<TNodeLabel, TLinkWe
 {
     GraphNodeList nodes;
 
-    if (!this->isNodeEnabled(node))
+    for (auto link : this->getOutLinks(node))
     {
-        return nodes;
+        nodes.append(link.id);
     }
 
-    uint32_t id = node.getId();
-
-    for (uint32_t j = 0; j < this->_gSize; j++)
-    {
-        if (this->_adjacencyMatrixRows[id].adjacencyMatrixCols[j].linkExists)
-        {
-            nodes.append(j);
-        }
-    }
-
-    nodes.removeDuplicate();
     return nodes;
 }
 
@@ -726,104 +1051,166 @@ typename Graph<TNodeLabel, TLinkWeight>::GraphNodeList Graph<TNodeLabel, TLinkWe
 {
     GraphNodeList nodes;
 
-    if (!this->isNodeEnabled(node))
+    for (auto link : this->getInLinks(node))
     {
-        return nodes;
+        nodes.append(link.id);
     }
 
+    return nodes;
+}
+
+/**
+ * Restituisce l'intervallo degli archi uscenti da node, senza allocare memoria.
+ * Ogni elemento contiene il nodo di arrivo e il peso dell'arco.
+ * Se node non esiste, allora l'intervallo e' vuoto.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo di partenza
+ * @return Intervallo degli archi uscenti
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename Graph<TNodeLabel, TLinkWeight>::OutLinkRange Graph<TNodeLabel, TLinkWeight>::getOutLinks(const GraphNode& node) const
+{
     uint32_t id = node.getId();
 
-    for (uint32_t i = 0; i < this->_gSize; i++)
+    if (id >= this->_gSize || !this->_adjacencyMatrixRows[id].isEnabled)
     {
-        if (this->_adjacencyMatrixRows[i].isEnabled)
-        {
-            if (this->_adjacencyMatrixRows[i].adjacencyMatrixCols[id].linkExists)
-            {
-                nodes.append(i);
-            }
-        }
+        return OutLinkRange(MatrixRowIterator<TLinkWeight>(nullptr, 0, 0), MatrixRowIterator<TLinkWeight>(nullptr, 0, 0));
     }
 
-    nodes.removeDuplicate();
-    return nodes;
+    const LinkInfo<TLinkWeight>* row = this->_adjacencyMatrixRows[id].adjacencyMatrixCols;
+
+    return OutLinkRange(MatrixRowIterator<TLinkWeight>(row, 0, this->_gSize),
+                        MatrixRowIterator<TLinkWeight>(row, this->_gSize, this->_gSize));
+}
+
+/**
+ * Restituisce l'intervallo degli archi entranti in node, senza allocare memoria.
+ * Ogni elemento contiene il nodo di partenza e il peso dell'arco.
+ * Se node non esiste, allora l'intervallo e' vuoto.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo di arrivo
+ * @return Intervallo degli archi entranti
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename Graph<TNodeLabel, TLinkWeight>::InLinkRange Graph<TNodeLabel, TLinkWeight>::getInLinks(const GraphNode& node) const
+{
+    uint32_t id = node.getId();
+
+    if (id >= this->_gSize || !this->_adjacencyMatrixRows[id].isEnabled)
+    {
+        return InLinkRange(MatrixColumnIterator<TNodeLabel, TLinkWeight>(nullptr, 0, 0, 0),
+                           MatrixColumnIterator<TNodeLabel, TLinkWeight>(nullptr, 0, 0, 0));
+    }
+
+    return InLinkRange(MatrixColumnIterator<TNodeLabel, TLinkWeight>(this->_adjacencyMatrixRows, id, 0, this->_gSize),
+                       MatrixColumnIterator<TNodeLabel, TLinkWeight>(this->_adjacencyMatrixRows, id, this->_gSize, this->_gSize));
 }
 
 /**
- * Restituisce il numero di archi uscenti dal nodo
+ * Restituisce il numero di archi uscenti dal nodo, in tempo costante
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
  * @param node : Nodo a cui calcolare il numero di archi uscenti
- * @return numero di archi uscenti dal nodo
+ * @return numero di archi uscenti dal nodo, zero se il nodo non esiste
  */
 template <class TNodeLabel, class TLinkWeight>
 uint32_t Graph<TNodeLabel, TLinkWeight>::getDegreeTo(const GraphNode& node) const
 {
-    GraphNodeList nodes = this->getAdjacentToANode(node);
-    return nodes.getSize();
+    if (!this->isNodeEnabled(node))
+    {
+        return 0;
+    }
+
+    return this->_adjacencyMatrixRows[node.getId()].outDegree;
 }
 
 
 /**
- * Restituisce il numero di archi entranti nel nodo
+ * Restituisce il numero di archi entranti nel nodo, in tempo costante
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
- * @param node : Nodo a cui calcolare il numero di archi uscenti
- * @return numero di archi entranti nel nodo
+ * @param node : Nodo a cui calcolare il numero di archi entranti
+ * @return numero di archi entranti nel nodo, zero se il nodo non esiste
  */
 template <class TNodeLabel, class TLinkWeight>
 uint32_t Graph<TNodeLabel, TLinkWeight>::getDegreeFrom(const GraphNode& node) const
 {
-    GraphNodeList nodes = this->getAdjacentFromANode(node);
-    return nodes.getSize();
+    if (!this->isNodeEnabled(node))
+    {
+        return 0;
+    }
+
+    return this->_adjacencyMatrixRows[node.getId()].inDegree;
 }
 
 
 /**
- * Restituisce il numero medio di archi uscenti presenti nel grafo
+ * Restituisce il numero medio di archi uscenti presenti nel grafo.
+ * Ogni arco esce da un solo nodo, quindi la media e' il numero di archi diviso il numero di nodi.
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
- * @return numero medio di archi uscenti presenti nel grafo
+ * @return numero medio di archi uscenti presenti nel grafo, zero se il grafo e' vuoto
  */
 template <class TNodeLabel, class TLinkWeight>
 double Graph<TNodeLabel, TLinkWeight>::getDegreeToAvg() const
 {
-    double degreeSum = 0.0;
-
-    for (uint32_t i = 0; i < this->_gSize; i++)
+    if (this->_nodeAmount == 0)
     {
-        if (this->_adjacencyMatrixRows[i].isEnabled)
-        {
-            degreeSum += this->getDegreeTo(GraphNode(i));
-        }
+        return 0.0;
     }
 
-    return (degreeSum / this->_nodeAmount);
+    return ((double) this->_linkAmount / this->_nodeAmount);
 }
 
 /**
- * Restituisce il numero medio di archi entranti presenti nel grafo
+ * Restituisce il numero medio di archi entranti presenti nel grafo.
+ * Ogni arco entra in un solo nodo, quindi coincide con il numero medio di archi uscenti.
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
- * @return numero medio di archi entranti presenti nel grafo
+ * @return numero medio di archi entranti presenti nel grafo, zero se il grafo e' vuoto
  */
 template <class TNodeLabel, class TLinkWeight>
 double Graph<TNodeLabel, TLinkWeight>::getDegreeFromAvg() const
 {
-    double degreeSum = 0.0;
+    return this->getDegreeToAvg();
+}
 
-    for (uint32_t i = 0; i < this->_gSize; i++)
-    {
-        if (this->_adjacencyMatrixRows[i].isEnabled)
-        {
-            degreeSum += this->getDegreeFrom(GraphNode(i));
-        }
-    }
+/**
+ * Restituisce l'istogramma dei gradi uscenti: l'elemento di posizione k e' il numero di
+ * nodi con k archi uscenti. L'ultimo elemento corrisponde al grado uscente massimo e il
+ * vettore e' vuoto se il grafo non ha nodi.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Istogramma dei gradi uscenti
+ */
+template <class TNodeLabel, class TLinkWeight>
+const std::vector<uint32_t>& Graph<TNodeLabel, TLinkWeight>::getDegreeToHistogram() const
+{
+    return this->_outDegreeHistogram;
+}
 
-    return (degreeSum / this->_nodeAmount);
+/**
+ * Restituisce l'istogramma dei gradi entranti: l'elemento di posizione k e' il numero di
+ * nodi con k archi entranti. L'ultimo elemento corrisponde al grado entrante massimo e il
+ * vettore e' vuoto se il grafo non ha nodi.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Istogramma dei gradi entranti
+ */
+template <class TNodeLabel, class TLinkWeight>
+const std::vector<uint32_t>& Graph<TNodeLabel, TLinkWeight>::getDegreeFromHistogram() const
+{
+    return this->_inDegreeHistogram;
 }
 
 /**
@@ -837,27 +1224,22 @@ double Graph<TNodeLabel, TLinkWeight>::getDegreeFromAvg() const
 template <class TNodeLabel, class TLinkWeight>
 typename Graph<TNodeLabel, TLinkWeight>::GraphNodeList Graph<TNodeLabel, TLinkWeight>::getAdjacentNode(const GraphNode& node) const
 {
-    GraphNodeList nodesTo = this->getAdjacentToANode(node);
-    GraphNodeList nodesFrom = this->getAdjacentFromANode(node);
     GraphNodeList adjacentNodes;
 
-    GraphNodeList::Iterator it = nodesTo.begin();
-
-    while (!nodesTo.isEnd(it))
+    for (auto link : this->getOutLinks(node))
     {
-        adjacentNodes.append(it->getNodeValue());
-        it = it->getNext();
+        adjacentNodes.append(link.id);
     }
 
-    it = nodesFrom.begin();
-
-    while (!nodesFrom.isEnd(it))
+    // Aggiungo i nodi entranti che non sono gia' stati inseriti come nodi uscenti
+    for (auto link : this->getInLinks(node))
     {
-        adjacentNodes.append(it->getNodeValue());
-        it = it->getNext();
+        if (!this->_adjacencyMatrixRows[node.getId()].adjacencyMatrixCols[link.id].linkExists)
+        {
+            adjacentNodes.append(link.id);
+        }
     }
 
-    adjacentNodes.removeDuplicate();
     return adjacentNodes;
 }
 
@@ -896,58 +1278,16 @@ typename Graph<TNodeLabel, TLinkWeight>::GraphNodeList Graph<TNodeLabel, TLinkWe
 template <class TNodeLabel, class TLinkWeight>
 void Graph<TNodeLabel, TLinkWeight>::bfs(const GraphNode& start) const
 {
-    if (this->isEmpty())
-    {
-        return;
-    }
-
-    if (!this->isNodeEnabled(start))
+    if (this->isEmpty() || !this->isNodeEnabled(start))
     {
         return;
     }
 
-    // Inserisco il nodo di partenza nella coda
-
-    Queue<GraphNode> queue;
-    queue.enqueue(start);
-
-    bool isVisited[this->_gSize];
-
-    for (uint32_t i = 0; i < this->_gSize; i++)
-    {
-        isVisited[i] = false;
-    }
-
-    isVisited[start.getId()] = true;
-
-    // Vado a visitare tutti i nodi del grafo
-    while (!queue.isEmpty())
-    {
-        GraphNode node = queue.top();
-        queue.dequeue();
-
-        GraphNodeList adj = this->getAdjacentToANode(node);
-        std::cout << "Nodo: " << node.getId() << " --> ";
-
-        /**
-         * Visito tutti i vicini del nodo e, una volta visitati, vado al vicino successivo
-         * Tutti i nodi non visitati, dopo averli visitati, verranno messi in coda per
-         * poi essere visitati successivamente
-         */
-
-        for (auto it = adj.begin(); !adj.isEnd(it); it = it->getNext())
-        {
-            std::cout << "(" << node.getId() << "," << it->getNodeValue() << ") ";
-
-            if (isVisited[it->getNodeValue()] == false)
-            {
-                isVisited[it->getNodeValue()] = true;
-                queue.enqueue(it->getNodeValue()); // Metto in coda tutti i vicini del nodo in cui mi trovo attualmente
-            }
-        }
+    GraphTraversal< Graph<TNodeLabel, TLinkWeight> > traversal(*this);
+    PrintVisitor<TLinkWeight> visitor(std::cout);
 
-        std::cout << std::endl;
-    }
+    traversal.bfs(start, visitor);
+    std::cout << std::endl;
 }
 
 
@@ -962,32 +1302,21 @@ void Graph<TNodeLabel, TLinkWeight>::bfs(const GraphNode& start) const
 template <class TNodeLabel, class TLinkWeight>
 void Graph<TNodeLabel, TLinkWeight>::dfs(const GraphNode& start) const
 {
-    /**
-     * L'array ha dimensioni uguali a quelle del numero massimo di nodi consentiti
-     * nel grafo.
-     *
-     * Il suo scopo e' quello di fornire supporto alla chiamta ricorsiva del metodo
-     * privata _dfs(const GraphNode& start, bool* isVisited)
-     *
-     * Al suo interno troviamo solo valori booleani dove, ogni cella mi dice se il nodo e'
-     * stato visitato o meno. Se in una posizione i, il valore e' false, allora il nodo non e'
-     * stato visitato o scoperto mentre, se ha valore true, il nodo e' stato scoperto.
-     */
-    bool isVisited[this->_gSize];
-
-    for (uint32_t i = 0; i < this->_gSize; i++)
+    if (this->isEmpty() || !this->isNodeEnabled(start))
     {
-        isVisited[i] = false;
+        return;
     }
 
-    this->_dfs(start, isVisited);
+    GraphTraversal< Graph<TNodeLabel, TLinkWeight> > traversal(*this);
+    PrintVisitor<TLinkWeight> visitor(std::cout);
+
+    traversal.dfs(start, visitor);
 }
 
 
 /**
- * Attua l'algoritmo di Dijkstra per trovare un albero di copertura minima all'interno
- * del grafo.
- * Se il vettore di padri e' vuoto, allora
+ * Attua l'algoritmo di Dijkstra per trovare l'albero dei cammini minimi con radice start
+ * e lo stampa. Per interrogare o riutilizzare l'albero si usi direttamente il motore Dijkstra.
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
@@ -996,12 +1325,6 @@ void Graph<TNodeLabel, TLinkWeight>::dfs(const GraphNode& start) const
 template <class TNodeLabel, class TLinkWeight>
 void Graph<TNodeLabel, TLinkWeight>::dijkstra(const GraphNode& start) const
 {
-    std::vector<int> spt(this->_gSize);                   // shortest path tree rappresentato con vettori di padri
-    for(int i = 0; i < this->_gSize; i++)
-    {
-        spt[i] = this->_NON_EXISTING;
-    }
-
     if(!this->isNodeEnabled(start))
     {
         std::cout << "[Nodo vuoto]" << std::endl;
@@ -1014,91 +1337,111 @@ void Graph<TNodeLabel, TLinkWeight>::dijkstra(const GraphNode& start) const
         return;
     }
 
+    Dijkstra< Graph<TNodeLabel, TLinkWeight> > engine(*this);
+    const ShortestPathTree<TLinkWeight>& spt = engine.run(start);
 
-    TLinkWeight distances[this->_gSize];          // Contiene per ogni nodo i il valore della lunghezza del cammino minimo da r a i
-
-    // Struttura dati che contiene i nodi da processare
-    // gli elementi della coda con priorità S sono nodi del grafo e le loro priorità corrispondono alla distanza da r.
-    PriorityQueue<int> S;
-
-    bool Smember[this->_gSize];    // Smember[i]=true significa che il nodo i dovrà essere processato perche' è contenuto in S
-    for(int i = 0; i < this->_gSize; i++)
-    {
-        Smember[i]=false;
-    }
-
-    //uso la struttura dati booleana Smember perchè il tipo dato priority queue non prevede una funzione di ricerca
-
-    GraphNodeList currentAdjacentList;
-    int i;  //indice generico
-    int u,v; //id di nodi
+    std::cout << "SPT" << std::endl;
+    std::cout << "Leggenda: " << "(id_partenza, id_arrivo, costo)" << std::endl;
+    std::cout << "Parteza algoritmo: " << start.getId() << std::endl;
 
-    for(i = 0;i<this->_gSize;i++)
+    for (uint32_t j = 0; j < this->_gSize; j++)
     {
-        if(this->_adjacencyMatrixRows[i].isEnabled)
+        if (spt.isReachable(j) && j != start.getId())
         {
-            distances[i] = this->_INFINITY;
-        }
-        else
-        {
-            distances[i] = this->_NON_EXISTING;
+            std::cout << "(" << spt.getParent(j) << ", " << j << ", " << spt.getDistance(j) << ")" << std::endl;
         }
     }
+}
 
-    spt[start.getId()] = -1;
-    distances[start.getId()] = 0;
-    S.insert((int) start.getId());
-    Smember[start.getId()] = true;
+/**
+ * Calcola il cammino minimo da start ad end con l'algoritmo di Dijkstra bidirezionale,
+ * senza etichettare tutto il grafo. Per interrogazioni ripetute, o per usare A* con
+ * un'euristica, si usino direttamente i motori BidirectionalDijkstra e AStar.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param start : Nodo di partenza
+ * @param end : Nodo di arrivo
+ * @param cost : Costo del cammino, il massimo valore di TLinkWeight se end non e' raggiungibile
+ * @return Lista dei nodi del cammino, vuota se end non e' raggiungibile
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename Graph<TNodeLabel, TLinkWeight>::GraphNodeList Graph<TNodeLabel, TLinkWeight>::shortestPath(const GraphNode& start, const GraphNode& end, TLinkWeight& cost) const
+{
+    BidirectionalDijkstra< Graph<TNodeLabel, TLinkWeight> > engine(*this);
+    const ShortestPath<TLinkWeight>& path = engine.run(start, end);
 
-    // Il ciclo si ripete finchè esistono nodi da processare
-    while(!S.isEmpty())
-    {
-        u = S.min();       //recupero dalla priority queue il prossimo elemento da processare
-        S.deleteMin();       //lo tolgo dalla priority queue perchè ora lo si processa
-        Smember[u] = false;
+    cost = path.getCost();
 
-        currentAdjacentList = this->getAdjacentToANode(GraphNode(u));
+    return path.getPath();
+}
 
-        //sfoglio gli adiacenti di u
-        for(auto pos=currentAdjacentList.begin(); !currentAdjacentList.isEnd(pos); pos = pos->getNext())
-        {
-            v = (int) pos->getNodeValue();
-            TLinkWeight actualWeight = distances[u] + this->getWeight(GraphNode(u), GraphNode(v));  // _adjacencyMatrixRows[u].adjacencyMatrixCols[v].weight;
 
-            if(distances[v] == this->_INFINITY || actualWeight < distances[v] )
-            {
-                //in questo caso si è appena trovato che la distanza da r a v (calcolata con actualWeight) è minore della precedente distanza da r a v.
-                //quindi aggiorniamo il valore distances[v]
-                spt[v] = u;
-                distances[v] = actualWeight;
-
-                //la lunghezza del cammino minimo da r a v (ovvero dv) è stata modificata:
-                //il nodo v viene inserito nuovamente in S (se assente) perché è possibile che v
-                //possa ora essere un nodo intermedio più conveniente per raggiungere altri nodi.
-                if(Smember[v] == false)
-                {
-                    S.insert(v);
-                    Smember[v]=true;
-                }
-            }
-        }
-    }
 
-    std::cout << "SPT" << std::endl;
-    std::cout << "Leggenda: " << "(id_partenza, id_arrivo, costo)" << std::endl;
-    std::cout << "Parteza algoritmo: " << start.getId() << std::endl;
 
-    for (int j = 0; j < this->_gSize; j++)
+/**
+ * Restituisce true se first e second sono nella stessa componente connessa, cioe' se
+ * esiste un cammino fra i due considerando gli archi non orientati. Se dall'ultima
+ * interrogazione non sono stati cancellati archi il costo e' quasi costante.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param first : Primo nodo
+ * @param second : Secondo nodo
+ * @return True se i due nodi sono collegati, altrimenti false
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool Graph<TNodeLabel, TLinkWeight>::areConnected(const GraphNode& first, const GraphNode& second)
+{
+    if (!this->isNodeEnabled(first) || !this->isNodeEnabled(second))
     {
-        if (spt[j] != -1)
-        {
-            std::cout << "(" << spt[j] << ", " << j << ", " << distances[j] << ")" << std::endl;
-        }
+        return false;
     }
+
+    this->_updateComponents();
+
+    return this->_components.connected(first.getId(), second.getId());
 }
 
+/**
+ * Restituisce il rappresentante della componente connessa di un nodo: due nodi sono
+ * collegati se e solo se hanno lo stesso rappresentante. Il rappresentante puo' cambiare
+ * dopo ogni modifica del grafo.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo
+ * @return Id del rappresentante, UINT32_MAX se il nodo non esiste
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t Graph<TNodeLabel, TLinkWeight>::getComponent(const GraphNode& node)
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return UINT32_MAX;
+    }
+
+    this->_updateComponents();
+
+    return this->_components.find(node.getId());
+}
 
+/**
+ * Restituisce il numero di componenti connesse del grafo, con gli archi considerati non
+ * orientati; un nodo isolato e' una componente
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di componenti connesse
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t Graph<TNodeLabel, TLinkWeight>::getComponentAmount()
+{
+    this->_updateComponents();
 
+    // Le righe senza nodo sono insiemi a se' che non vanno contati
+    return this->_components.getSetAmount() - (this->_gSize - this->_nodeAmount);
+}
 
 /**
  * Permette di trovare un cammino da un nodo start verso un nodo end all'interno del grafo
@@ -1113,20 +1456,25 @@ template <class TNodeLabel, class TLinkWeight>
 typename Graph<TNodeLabel, TLinkWeight>::GraphNodeList Graph<TNodeLabel, TLinkWeight>::dfsWalk(const GraphNode& start, const GraphNode& end)
 {
     GraphNodeList walkList;
-    bool visitedNodes[this->_gSize];
-    for(int i = 0; i < this->_gSize; i++)
+    GraphTraversal< Graph<TNodeLabel, TLinkWeight> > traversal(*this);
+    PathVisitor<TLinkWeight> visitor(end.getId());
+
+    traversal.dfs(start, visitor);
+
+    if (visitor.found)
     {
-        visitedNodes[i] = false;
+        for (std::size_t i = 0; i < visitor.path.size(); i++)
+        {
+            walkList.append(visitor.path[i]);
+        }
     }
 
-    bool endWalk = false;
-    this->_dfsWalk(start, end, visitedNodes, endWalk, walkList);
-
     return walkList;
 }
 
 /**
- * Restituisce una lista di nodi, raggiungibili da node e che abbiano la sua stessa etichetta
+ * Restituisce una lista di nodi, raggiungibili da node e che abbiano la sua stessa etichetta.
+ * I nodi raggiungibili vengono calcolati con una sola visita, poi filtrati per etichetta.
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
@@ -1136,124 +1484,169 @@ typename Graph<TNodeLabel, TLinkWeight>::GraphNodeList Graph<TNodeLabel, TLinkWe
 template <class TNodeLabel, class TLinkWeight>
 typename Graph<TNodeLabel, TLinkWeight>::GraphNodeList Graph<TNodeLabel, TLinkWeight>::getSameReachableNodes(const GraphNode& node)
 {
-    GraphNodeList outList;
+    Reachability< Graph<TNodeLabel, TLinkWeight> > engine(*this);
+    return engine.getSameReachableNodes(node);
+}
+
+/**
+ * Calcola getSameReachableNodes per ogni nodo di nodes, riusando le stesse strutture
+ * di supporto per tutte le visite. results[i] conterra' la risposta per nodes[i].
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param nodes : Nodi di partenza
+ * @param results : Liste dei nodi raggiungibili con la stessa etichetta
+ */
+template <class TNodeLabel, class TLinkWeight>
+void Graph<TNodeLabel, TLinkWeight>::getSameReachableNodes(const std::vector<GraphNode>& nodes, std::vector<GraphNodeList>& results)
+{
+    Reachability< Graph<TNodeLabel, TLinkWeight> > engine(*this);
+    engine.getSameReachableNodes(nodes, results);
+}
 
-    if(!this->isNodeEnabled(node))
+
+/**
+ * Restituisce un id libero per un nuovo nodo: l'ultimo liberato da eraseNode, oppure
+ * il primo mai usato. Se tutte le righe sono occupate, la matrice viene raddoppiata.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Id libero
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t Graph<TNodeLabel, TLinkWeight>::_allocateId()
+{
+    if (!this->_freeIds.empty())
     {
-        return outList;
+        uint32_t id = this->_freeIds.back();
+        this->_freeIds.pop_back();
+
+        return id;
     }
 
-    if(this->isEmpty())
+    if (this->_nextId == this->_gSize)
     {
-        return outList;
+        this->_grow(this->_gSize == 0 ? 1 : 2 * this->_gSize);
     }
 
-    TNodeLabel startingNodeLabel = this->_adjacencyMatrixRows[node.getId()].label;
+    return this->_nextId++;
+}
 
-    for(int i = 0; i < this->_gSize;i++)
+/**
+ * Porta la matrice di adiacenza a size righe e size colonne, copiando nodi e archi.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param size : Nuovo numero di righe, maggiore di quello attuale
+ */
+template <class TNodeLabel, class TLinkWeight>
+void Graph<TNodeLabel, TLinkWeight>::_grow(uint32_t size)
+{
+    GraphNodeInfo<TNodeLabel, TLinkWeight>* rows = new GraphNodeInfo<TNodeLabel, TLinkWeight>[size]();
+
+    for (uint32_t i = 0; i < this->_gSize; i++)
     {
-        if(this->_adjacencyMatrixRows[i].isEnabled && i != node.getId() && this->_adjacencyMatrixRows[i].label == startingNodeLabel)
+        GraphNodeInfo<TNodeLabel, TLinkWeight>& oldRow = this->_adjacencyMatrixRows[i];
+
+        if (!oldRow.isEnabled)
         {
-            if(!this->dfsWalk(node, GraphNode(i)).isEmpty())
-            {
-                outList.append(i);
-            }
+            continue;
         }
-    }
 
-    return outList;
-}
+        rows[i].isEnabled = true;
+        rows[i].label = oldRow.label;
+        rows[i].outDegree = oldRow.outDegree;
+        rows[i].inDegree = oldRow.inDegree;
+        rows[i].adjacencyMatrixCols = new LinkInfo<TLinkWeight>[size]();
 
+        for (uint32_t j = 0; j < this->_gSize; j++)
+        {
+            rows[i].adjacencyMatrixCols[j] = oldRow.adjacencyMatrixCols[j];
+        }
 
+        // La vecchia riga non deve piu' liberare le colonne alla sua distruzione
+        delete[] oldRow.adjacencyMatrixCols;
+        oldRow.adjacencyMatrixCols = nullptr;
+        oldRow.isEnabled = false;
+    }
 
+    delete[] this->_adjacencyMatrixRows;
+
+    this->_adjacencyMatrixRows = rows;
+    this->_gSize = size;
+    this->_components.grow(size);
+}
 
 /**
- * Metodo privato di supporto per ricerca di un cammino da un nodo u verso un nodo v
- * del grafo tramite l'algoritmo Depth-First-Search (DFS).
- * L'algoritmo attua la previsita del grafo.
+ * Se una cancellazione ha invalidato le componenti connesse, le ricalcola unendo gli
+ * estremi di tutti gli archi del grafo
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
-
- * @param start : Nodo di partenza
- * @param end : Nodo di arrivo
- * @param isVisited : Array booleano
- * @param endWalk : Flag che segnala se ho raggiunto la fine del cammino
- * @param walkList : Lista di nodi percorsi
  */
 template <class TNodeLabel, class TLinkWeight>
-void Graph<TNodeLabel, TLinkWeight>::_dfsWalk(const GraphNode& start, const GraphNode& end, bool* isVisited, bool& endWalk, GraphNodeList& walkList)
+void Graph<TNodeLabel, TLinkWeight>::_updateComponents()
 {
-    int idFirstNode = start.getId();
-    int idSecondNode;
-
-    isVisited[idFirstNode] = true;
-    walkList.append(idFirstNode);
+    if (this->_componentsValid)
+    {
+        return;
+    }
 
-    auto adjacentNodeToList = this->getAdjacentToANode(GraphNode(idFirstNode));
+    this->_components.reset(this->_gSize);
 
-    for (auto p = adjacentNodeToList.begin(); !adjacentNodeToList.isEnd(p) && !endWalk; p = p->getNext())
+    for (uint32_t i = 0; i < this->_gSize; i++)
     {
-        idSecondNode = p->getNodeValue();
-
-        if(idSecondNode == end.getId())
+        if (!this->_adjacencyMatrixRows[i].isEnabled)
         {
-            endWalk = true;
-            walkList.append(idSecondNode);
+            continue;
         }
 
-        else if(isVisited[idSecondNode] == false)
+        for (auto link : this->getOutLinks(GraphNode(i)))
         {
-            this->_dfsWalk(GraphNode(idSecondNode), end, isVisited, endWalk, walkList);
+            this->_components.unite(i, link.id);
         }
     }
 
-    if(endWalk == false)
-    {
-        auto d = walkList.find(idFirstNode);
-        if(d != nullptr)
-        {
-            walkList.remove(d);
-        }
-    }
+    this->_componentsValid = true;
 }
 
+/**
+ * Aggiunge all'istogramma un nodo con il grado dato
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param histogram : Istogramma dei gradi
+ * @param degree : Grado del nodo
+ */
+template <class TNodeLabel, class TLinkWeight>
+void Graph<TNodeLabel, TLinkWeight>::_histogramAdd(std::vector<uint32_t>& histogram, uint32_t degree)
+{
+    if (degree >= histogram.size())
+    {
+        histogram.resize(degree + 1, 0);
+    }
 
+    histogram[degree]++;
+}
 
 /**
- * Metodo privato di supporto per la visita del grafo tramite l'algoritmo Depth-First-Search (DFS).
- * L'algoritmo attua la previsita del grafo.
+ * Toglie dall'istogramma un nodo con il grado dato. Gli zeri in coda vengono rimossi,
+ * cosi' che l'ultimo elemento corrisponda sempre al grado massimo.
  *
  * @tparam TNodeLabel : Tipo dell'etichetta
  * @tparam TLinkWeight : Tipo del peso dell'arco
- * @param start : Nodo di partenza della visita
- * @param isVisited : Array booleano di supporto alla chiamata
+ * @param histogram : Istogramma dei gradi
+ * @param degree : Grado del nodo
  */
 template <class TNodeLabel, class TLinkWeight>
-void Graph<TNodeLabel, TLinkWeight>::_dfs(const GraphNode& start, bool* isVisited) const
+void Graph<TNodeLabel, TLinkWeight>::_histogramRemove(std::vector<uint32_t>& histogram, uint32_t degree)
 {
-    isVisited[start.getId()] = true;
-    std::cout << "Nodo: " << start.getId() << " --> "; // Previsita
+    histogram[degree]--;
 
-    GraphNodeList adj = this->getAdjacentToANode(start);
-    for (auto it = adj.begin(); !adj.isEnd(it); it = it->getNext())
+    while (!histogram.empty() && histogram.back() == 0)
     {
-        std::cout << "(" << start.getId() << "," << it->getNodeValue() << ") ";
-
-        if (!isVisited[it->getNodeValue()])
-        {
-            std::cout << std::endl;
-            this->_dfs(GraphNode(it->getNodeValue()), isVisited);
-
-            if (!adj.isEnd(it->getNext()))
-            {
-                std::cout << std::endl << "Nodo: " << start.getId() << " --> ";
-            }
-        }
+        histogram.pop_back();
     }
-
-    // Decommentala per avere la postvisita, commentanto la riga con il commento "Previsita"
-    //    std::cout << "Nodo: " << start.getId() << " --> "; // Postvisita
 }
 
 
@@ -1300,4 +1693,9 @@ std::ostream& operator<<(std::ostream& out, Graph<TypeNodeLabel, TypeLinkWeight>
     return out;
 }
 
+#include "Dijkstra.h"
+#include "BidirectionalDijkstra.h"
+#include "Reachability.h"
+#include "GraphTraversal.h"
+
 #endif // _GRAPH_H
@@ -0,0 +1,361 @@
+#ifndef _GRAPHTRAVERSAL_H
+#define _GRAPHTRAVERSAL_H
+
+#include "Graph.h"
+#include "../Lib/VisitedSet.h"
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+/**
+ * Visitatore di base per GraphTraversal: tutti i metodi sono vuoti.
+ *
+ * Un visitatore puo' derivare da questa classe e ridefinire solo i metodi che gli servono.
+ * I metodi non sono virtuali: GraphTraversal riceve il tipo concreto del visitatore come
+ * parametro template, quindi le chiamate vengono risolte a tempo di compilazione e possono
+ * essere espanse inline.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class TraversalVisitor
+{
+    public:
+        void preVisit(uint32_t node) { }
+        void postVisit(uint32_t node) { }
+        void visitLink(uint32_t from, uint32_t to, const TLinkWeight& weight) { }
+        bool isFinished() const { return false; }
+};
+
+
+/**
+ * Motore per la visita in profondita' (DFS) e in ampiezza (BFS) di un grafo.
+ *
+ * Le visite sono iterative: la DFS usa uno stack esplicito di frame e la BFS una coda,
+ * entrambi allocati nello heap e conservati fra una visita e l'altra, quindi la profondita'
+ * del grafo non e' limitata dallo stack del thread. I nodi visitati sono segnati in un
+ * VisitedSet, che si svuota in tempo costante: visite consecutive costano quanto i nodi
+ * raggiunti e non quanto l'intero grafo.
+ *
+ * Durante la visita vengono chiamati i metodi del visitatore:
+ *  - preVisit(node) quando il nodo viene visitato per la prima volta;
+ *  - visitLink(from, to, weight) per ogni arco uscente esaminato, anche verso nodi gia' visitati;
+ *  - postVisit(node) quando tutti gli archi uscenti del nodo sono stati esaminati.
+ * Dopo ogni chiamata, se isFinished() restituisce true la visita si interrompe.
+ *
+ * @tparam TGraph : Tipo del grafo da visitare
+ */
+template <class TGraph>
+class GraphTraversal
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+        typedef LinkedList<uint32_t> GraphNodeList;
+
+    private:
+        typedef decltype(std::declval<const TGraph&>().getOutLinks(GraphNode()).begin()) LinkIterator;
+
+        /**
+         * Frame della visita in profondita': nodo visitato e prossimo arco da esaminare
+         */
+        class Frame
+        {
+            public:
+                uint32_t node; // Nodo visitato
+                LinkIterator next; // Prossimo arco uscente da esaminare
+                LinkIterator end; // Fine degli archi uscenti
+        };
+
+        const TGraph& _graph; // Grafo da visitare
+        VisitedSet _visited; // Nodi visitati nell'ultima visita
+        std::vector<Frame> _stack; // Stack della visita in profondita'
+        std::vector<uint32_t> _queue; // Coda della visita in ampiezza
+
+    public:
+        GraphTraversal(const TGraph& graph);
+
+        template <class TVisitor>
+        void dfs(const GraphNode& start, TVisitor& visitor);
+
+        template <class TVisitor>
+        void bfs(const GraphNode& start, TVisitor& visitor);
+
+        bool isVisited(const GraphNode& node) const;
+
+        GraphNodeList getDfsOrder(const GraphNode& start);
+        GraphNodeList getBfsOrder(const GraphNode& start);
+};
+
+
+/**
+ * Visitatore che raccoglie i nodi nell'ordine in cui vengono visitati
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class OrderVisitor : public TraversalVisitor<TLinkWeight>
+{
+    public:
+        LinkedList<uint32_t> order; // Nodi in ordine di visita
+
+    public:
+        void preVisit(uint32_t node) { this->order.append(node); }
+};
+
+
+/**
+ * Visitatore che cerca un cammino verso un nodo di arrivo durante una visita in profondita'.
+ *
+ * I nodi sullo stack della visita formano sempre un cammino dal nodo di partenza al nodo
+ * corrente: il visitatore li tiene in path e, appena esamina un arco verso end, aggiunge
+ * end al cammino e interrompe la visita.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class PathVisitor : public TraversalVisitor<TLinkWeight>
+{
+    public:
+        std::vector<uint32_t> path; // Cammino dal nodo di partenza al nodo corrente
+        uint32_t end; // Nodo di arrivo
+        bool found; // True se il cammino verso end e' stato trovato
+
+    public:
+        PathVisitor(uint32_t end) : end(end), found(false) { }
+
+        void preVisit(uint32_t node) { this->path.push_back(node); }
+        void postVisit(uint32_t node) { this->path.pop_back(); }
+
+        void visitLink(uint32_t from, uint32_t to, const TLinkWeight& weight)
+        {
+            if (to == this->end)
+            {
+                this->path.push_back(to);
+                this->found = true;
+            }
+        }
+
+        bool isFinished() const { return this->found; }
+};
+
+
+/**
+ * Visitatore che stampa, per ogni nodo visitato, gli archi uscenti esaminati.
+ * Quando la visita in profondita' torna ad un nodo dopo averne visitato un discendente,
+ * la sua riga viene ripresa con una nuova intestazione.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class PrintVisitor : public TraversalVisitor<TLinkWeight>
+{
+    private:
+        std::ostream& _out; // Stream su cui stampare
+        uint32_t _current; // Nodo della riga corrente
+        bool _isFirst; // True se non e' ancora stato stampato nessun nodo
+
+    public:
+        PrintVisitor(std::ostream& out) : _out(out), _current(0), _isFirst(true) { }
+
+        void preVisit(uint32_t node)
+        {
+            if (!this->_isFirst)
+            {
+                this->_out << std::endl;
+            }
+
+            this->_out << "Nodo: " << node << " --> ";
+            this->_current = node;
+            this->_isFirst = false;
+        }
+
+        void visitLink(uint32_t from, uint32_t to, const TLinkWeight& weight)
+        {
+            if (from != this->_current)
+            {
+                this->_out << std::endl << "Nodo: " << from << " --> ";
+                this->_current = from;
+            }
+
+            this->_out << "(" << from << "," << to << ") ";
+        }
+};
+
+
+/**
+ * Crea un motore di visita sul grafo dato. Il grafo deve sopravvivere al motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo da visitare
+ */
+template <class TGraph>
+GraphTraversal<TGraph>::GraphTraversal(const TGraph& graph) : _graph(graph) { }
+
+/**
+ * Visita in profondita' i nodi raggiungibili da start
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @tparam TVisitor : Tipo del visitatore
+ * @param start : Nodo di partenza
+ * @param visitor : Visitatore da notificare
+ */
+template <class TGraph>
+template <class TVisitor>
+void GraphTraversal<TGraph>::dfs(const GraphNode& start, TVisitor& visitor)
+{
+    this->_visited.begin(this->_graph.getMaxNodeAmount());
+    this->_stack.clear();
+
+    if (!this->_graph.isNodeEnabled(start))
+    {
+        return;
+    }
+
+    auto links = this->_graph.getOutLinks(start);
+
+    this->_visited.visit(start.getId());
+    this->_stack.push_back(Frame{ start.getId(), links.begin(), links.end() });
+    visitor.preVisit(start.getId());
+
+    while (!this->_stack.empty() && !visitor.isFinished())
+    {
+        Frame& top = this->_stack.back();
+
+        if (!(top.next != top.end))
+        {
+            uint32_t u = top.node;
+
+            this->_stack.pop_back();
+            visitor.postVisit(u);
+
+            continue;
+        }
+
+        uint32_t u = top.node;
+        auto link = *top.next;
+        ++top.next;
+
+        visitor.visitLink(u, link.id, link.weight);
+
+        if (visitor.isFinished())
+        {
+            break;
+        }
+
+        if (this->_visited.visit(link.id))
+        {
+            // Scendo nel vicino: il frame di u verra' ripreso quando il vicino termina
+            auto nextLinks = this->_graph.getOutLinks(GraphNode(link.id));
+
+            this->_stack.push_back(Frame{ link.id, nextLinks.begin(), nextLinks.end() });
+            visitor.preVisit(link.id);
+        }
+    }
+}
+
+/**
+ * Visita in ampiezza i nodi raggiungibili da start
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @tparam TVisitor : Tipo del visitatore
+ * @param start : Nodo di partenza
+ * @param visitor : Visitatore da notificare
+ */
+template <class TGraph>
+template <class TVisitor>
+void GraphTraversal<TGraph>::bfs(const GraphNode& start, TVisitor& visitor)
+{
+    this->_visited.begin(this->_graph.getMaxNodeAmount());
+    this->_queue.clear();
+
+    if (!this->_graph.isNodeEnabled(start))
+    {
+        return;
+    }
+
+    this->_visited.visit(start.getId());
+    this->_queue.push_back(start.getId());
+
+    // La coda e' un vettore letto dalla testa: ogni nodo vi entra una sola volta
+    for (std::size_t head = 0; head < this->_queue.size(); head++)
+    {
+        uint32_t u = this->_queue[head];
+
+        visitor.preVisit(u);
+
+        if (visitor.isFinished())
+        {
+            return;
+        }
+
+        for (auto link : this->_graph.getOutLinks(GraphNode(u)))
+        {
+            visitor.visitLink(u, link.id, link.weight);
+
+            if (visitor.isFinished())
+            {
+                return;
+            }
+
+            if (this->_visited.visit(link.id))
+            {
+                this->_queue.push_back(link.id);
+            }
+        }
+
+        visitor.postVisit(u);
+
+        if (visitor.isFinished())
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * Restituisce true se node e' stato raggiunto nell'ultima visita
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo da controllare
+ * @return True se node e' stato raggiunto, altrimenti false
+ */
+template <class TGraph>
+bool GraphTraversal<TGraph>::isVisited(const GraphNode& node) const
+{
+    return this->_visited.isVisited(node.getId());
+}
+
+/**
+ * Restituisce i nodi raggiungibili da start in ordine di visita in profondita'
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param start : Nodo di partenza
+ * @return Lista dei nodi in previsita
+ */
+template <class TGraph>
+typename GraphTraversal<TGraph>::GraphNodeList GraphTraversal<TGraph>::getDfsOrder(const GraphNode& start)
+{
+    OrderVisitor<LinkWeight> visitor;
+    this->dfs(start, visitor);
+
+    return visitor.order;
+}
+
+/**
+ * Restituisce i nodi raggiungibili da start in ordine di visita in ampiezza
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param start : Nodo di partenza
+ * @return Lista dei nodi in ordine di distanza da start
+ */
+template <class TGraph>
+typename GraphTraversal<TGraph>::GraphNodeList GraphTraversal<TGraph>::getBfsOrder(const GraphNode& start)
+{
+    OrderVisitor<LinkWeight> visitor;
+    this->bfs(start, visitor);
+
+    return visitor.order;
+}
+
+#endif // _GRAPHTRAVERSAL_H
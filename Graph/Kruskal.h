@@ -0,0 +1,121 @@
+#ifndef _KRUSKAL_H
+#define _KRUSKAL_H
+
+#include "Graph.h"
+#include "SpanningForest.h"
+#include "../UnionFind/UnionFind.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Motore per il calcolo della foresta ricoprente minima con l'algoritmo di Kruskal.
+ *
+ * Gli archi del grafo, considerati non orientati, vengono ordinati per peso e scorsi in
+ * ordine: un arco entra nella foresta se collega due alberi distinti, verificato e
+ * registrato con una struttura union-find. Ci si ferma appena la foresta ha un arco in
+ * meno dei nodi, cioe' quando il grafo e' connesso e l'albero e' completo.
+ *
+ * Il costo e' dominato dall'ordinamento, O(E log E).
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+class Kruskal
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+        typedef SpanningLink<LinkWeight> Link;
+        typedef SpanningForest<LinkWeight> Forest;
+
+    private:
+        const TGraph& _graph; // Grafo di cui calcolare la foresta
+        std::vector<Link> _links; // Archi del grafo, ordinati
+        UnionFind _trees; // Alberi della foresta in costruzione
+        Forest _forest; // Foresta dell'ultima esecuzione
+
+    public:
+        Kruskal(const TGraph& graph);
+
+        const Forest& run();
+        const Forest& getForest() const;
+};
+
+
+/**
+ * Crea un motore di Kruskal sul grafo dato, che deve sopravvivere al motore
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo di cui calcolare la foresta ricoprente minima
+ */
+template <class TGraph>
+Kruskal<TGraph>::Kruskal(const TGraph& graph) : _graph(graph) { }
+
+/**
+ * Calcola la foresta ricoprente minima del grafo.
+ * Il riferimento restituito resta valido fino all'esecuzione successiva.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Foresta ricoprente minima
+ */
+template <class TGraph>
+const typename Kruskal<TGraph>::Forest& Kruskal<TGraph>::run()
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+    uint32_t nodes = 0;
+    Link link;
+
+    this->_links.clear();
+    this->_forest.clear();
+
+    for (uint32_t u = 0; u < size; u++)
+    {
+        if (!this->_graph.isNodeEnabled(GraphNode(u)))
+        {
+            continue;
+        }
+
+        nodes++;
+        link.from = u;
+
+        for (auto out : this->_graph.getOutLinks(GraphNode(u)))
+        {
+            // I cappi non collegano mai due alberi distinti
+            if (out.id != u)
+            {
+                link.to = out.id;
+                link.weight = out.weight;
+                this->_links.push_back(link);
+            }
+        }
+    }
+
+    std::sort(this->_links.begin(), this->_links.end());
+    this->_trees.reset(size);
+
+    for (std::size_t i = 0; i < this->_links.size() && this->_forest.getLinkAmount() + 1 < nodes; i++)
+    {
+        if (this->_trees.unite(this->_links[i].from, this->_links[i].to))
+        {
+            this->_forest.add(this->_links[i]);
+        }
+    }
+
+    this->_forest.setTreeAmount(nodes - this->_forest.getLinkAmount());
+
+    return this->_forest;
+}
+
+/**
+ * Restituisce la foresta dell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Foresta ricoprente minima
+ */
+template <class TGraph>
+const typename Kruskal<TGraph>::Forest& Kruskal<TGraph>::getForest() const
+{
+    return this->_forest;
+}
+
+#endif // _KRUSKAL_H
@@ -0,0 +1,159 @@
+#ifndef _LINKITERATOR_H
+#define _LINKITERATOR_H
+
+#include <cstdint>
+
+/**
+ * Vicino di un nodo restituito dagli iteratori sugli archi: contiene l'id del nodo
+ * all'altro capo dell'arco e il peso dell'arco.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class GraphNeighbour
+{
+    public:
+        uint32_t id; // Id del nodo vicino
+        TLinkWeight weight; // Peso dell'arco
+};
+
+
+/**
+ * Intervallo di archi percorribile con un ciclo for basato su intervallo:
+ *
+ *     for (auto link : graph.getOutLinks(node)) { link.id; link.weight; }
+ *
+ * Non alloca memoria: contiene solo l'iteratore di inizio e quello di fine.
+ *
+ * @tparam TIterator : Tipo dell'iteratore sugli archi
+ */
+template <class TIterator>
+class LinkRange
+{
+    private:
+        TIterator _begin; // Primo arco dell'intervallo
+        TIterator _end; // Posizione successiva all'ultimo arco
+
+    public:
+        LinkRange(const TIterator& begin, const TIterator& end);
+
+        TIterator begin() const;
+        TIterator end() const;
+};
+
+/**
+ * Crea un intervallo di archi
+ *
+ * @tparam TIterator : Tipo dell'iteratore sugli archi
+ * @param begin : Primo arco dell'intervallo
+ * @param end : Posizione successiva all'ultimo arco
+ */
+template <class TIterator>
+LinkRange<TIterator>::LinkRange(const TIterator& begin, const TIterator& end) : _begin(begin), _end(end) { }
+
+/**
+ * Restituisce l'iteratore al primo arco
+ *
+ * @tparam TIterator : Tipo dell'iteratore sugli archi
+ * @return Iteratore al primo arco
+ */
+template <class TIterator>
+TIterator LinkRange<TIterator>::begin() const
+{
+    return this->_begin;
+}
+
+/**
+ * Restituisce l'iteratore successivo all'ultimo arco
+ *
+ * @tparam TIterator : Tipo dell'iteratore sugli archi
+ * @return Iteratore di fine
+ */
+template <class TIterator>
+TIterator LinkRange<TIterator>::end() const
+{
+    return this->_end;
+}
+
+
+/**
+ * Iteratore sugli archi memorizzati in modo contiguo in due array paralleli,
+ * uno con i nodi all'altro capo dell'arco e uno con i pesi (formato CSR).
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class CsrLinkIterator
+{
+    private:
+        const uint32_t* _node; // Nodo all'altro capo dell'arco corrente
+        const TLinkWeight* _weight; // Peso dell'arco corrente
+
+    public:
+        CsrLinkIterator(const uint32_t* node, const TLinkWeight* weight);
+
+        GraphNeighbour<TLinkWeight> operator*() const;
+        CsrLinkIterator<TLinkWeight>& operator++();
+        bool operator!=(const CsrLinkIterator<TLinkWeight>& it) const;
+};
+
+/**
+ * Crea un iteratore che punta all'arco con nodo node e peso weight
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Puntatore al nodo dell'arco
+ * @param weight : Puntatore al peso dell'arco
+ */
+template <class TLinkWeight>
+CsrLinkIterator<TLinkWeight>::CsrLinkIterator(const uint32_t* node, const TLinkWeight* weight)
+{
+    this->_node = node;
+    this->_weight = weight;
+}
+
+/**
+ * Restituisce l'arco corrente
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Vicino e peso dell'arco
+ */
+template <class TLinkWeight>
+GraphNeighbour<TLinkWeight> CsrLinkIterator<TLinkWeight>::operator*() const
+{
+    GraphNeighbour<TLinkWeight> neighbour;
+
+    neighbour.id = *(this->_node);
+    neighbour.weight = *(this->_weight);
+
+    return neighbour;
+}
+
+/**
+ * Avanza all'arco successivo
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Iteratore aggiornato
+ */
+template <class TLinkWeight>
+CsrLinkIterator<TLinkWeight>& CsrLinkIterator<TLinkWeight>::operator++()
+{
+    this->_node++;
+    this->_weight++;
+
+    return *this;
+}
+
+/**
+ * Restituisce true se i due iteratori puntano ad archi diversi
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param it : Iteratore da confrontare
+ * @return True se gli iteratori sono diversi, altrimenti false
+ */
+template <class TLinkWeight>
+bool CsrLinkIterator<TLinkWeight>::operator!=(const CsrLinkIterator<TLinkWeight>& it) const
+{
+    return (this->_node != it._node);
+}
+
+#endif // _LINKITERATOR_H
@@ -0,0 +1,989 @@
+#ifndef _MAPPEDGRAPH_H
+#define _MAPPEDGRAPH_H
+
+#include "Graph.h"
+#include "../Lib/MappedFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Classe che descrive un grafo pesato e orientato in sola lettura, interrogato
+ * direttamente su un'istantanea binaria mappata in memoria (MappedFile).
+ *
+ * L'istantanea si scrive una volta con save() a partire da un qualunque grafo (Graph,
+ * CsrGraph, ...) e contiene il grafo nel formato CSR, con lo stesso indice trasposto
+ * degli archi entranti di CsrGraph. Aprirla con open() non legge ne' copia il contenuto:
+ * controlla l'intestazione e la dimensione del file e fa puntare gli array direttamente
+ * alla mappatura, quindi costa lo stesso tempo per un grafo di mille o di un miliardo di
+ * archi. Le pagine vengono caricate dal disco al primo accesso.
+ *
+ * Formato (versione 1), con interi nell'ordine dei byte della macchina che l'ha scritto:
+ *
+ *   intestazione: magic "GSNP", versione, sizeof(etichetta), sizeof(peso),
+ *                 id di nodo, nodi attivi, archi, riservato      (8 x uint32_t)
+ *   enabled:      uint8_t[id di nodo]       1 se il nodo e' attivo
+ *   labels:       TNodeLabel[id di nodo]
+ *   offsets:      uint64_t[id di nodo + 1]  archi uscenti, come in CsrGraph
+ *   targets:      uint32_t[archi]
+ *   weights:      TLinkWeight[archi]
+ *   inOffsets:    uint64_t[id di nodo + 1]  archi entranti
+ *   inSources:    uint32_t[archi]
+ *   inWeights:    TLinkWeight[archi]
+ *
+ * Ogni sezione inizia a una posizione multipla di 8 byte, cosi' che gli array siano
+ * allineati nella mappatura (che inizia a un confine di pagina). Per questo etichette e
+ * pesi devono essere trivially copyable e con allineamento non superiore a 8.
+ *
+ * open() si fida del contenuto oltre l'intestazione: per file di provenienza incerta si
+ * chiama verify(), che controlla in O(V + E) che ogni arco sia coerente.
+ * Come in CsrGraph gli id dei nodi restano quelli del grafo salvato; le operazioni che
+ * modificano il grafo non sono ammesse e non fanno nulla.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+class MappedGraph : public IGraph<GraphNode, TNodeLabel, Link<GraphNode>, TLinkWeight>
+{
+    static_assert(std::is_trivially_copyable<TNodeLabel>::value, "Le etichette devono essere trivially copyable");
+    static_assert(std::is_trivially_copyable<TLinkWeight>::value, "I pesi devono essere trivially copyable");
+    static_assert(alignof(TNodeLabel) <= 8 && alignof(TLinkWeight) <= 8, "Etichette e pesi devono essere allineati al piu' a 8 byte");
+
+    public:
+        typedef ::Link<GraphNode> Link;
+        typedef LinkedList<uint32_t> GraphNodeList;
+        typedef TNodeLabel NodeLabel;
+        typedef TLinkWeight LinkWeight;
+        typedef LinkRange< CsrLinkIterator<TLinkWeight> > OutLinkRange;
+        typedef LinkRange< CsrLinkIterator<TLinkWeight> > InLinkRange;
+
+    private:
+        static const uint32_t _MAGIC = 0x504E5347; // "GSNP" all'inizio delle istantanee
+        static const uint32_t _VERSION = 1; // Versione del formato delle istantanee
+        static const uint32_t _HEADER = 8; // Numero di interi a 32 bit dell'intestazione
+        static const uint32_t _SECTIONS = 8; // Numero di sezioni dopo l'intestazione
+        static const uint64_t _ALIGNMENT = 8; // Allineamento in byte dell'inizio di ogni sezione
+        static const uint64_t _NO_LINK = UINT64_MAX; // Posizione di un arco inesistente
+
+        MappedFile _file; // Istantanea mappata in memoria
+
+        uint32_t _gSize; // Numero di id di nodo gestiti dal grafo
+        uint32_t _nodeAmount; // Numero di nodi attivi nel grafo
+        uint32_t _linkAmount; // Numero di archi nel grafo
+
+        const uint8_t* _enabled; // Se diverso da 0, il nodo con quell'id e' attivo
+        const TNodeLabel* _labels; // Etichetta di ogni nodo
+        const uint64_t* _offsets; // Inizio degli archi uscenti di ogni nodo, lungo _gSize + 1
+        const uint32_t* _targets; // Nodo di arrivo di ogni arco
+        const TLinkWeight* _weights; // Peso di ogni arco
+
+        const uint64_t* _inOffsets; // Inizio degli archi entranti di ogni nodo, lungo _gSize + 1
+        const uint32_t* _inSources; // Nodo di partenza di ogni arco entrante
+        const TLinkWeight* _inWeights; // Peso di ogni arco entrante
+
+    private:
+        void _reset();
+        uint64_t _findLink(uint32_t fromId, uint32_t toId) const;
+        static bool _verifyLinks(uint32_t size, uint32_t links, const uint8_t* enabled, const uint64_t* offsets, const uint32_t* heads);
+
+        static uint64_t _layout(uint32_t size, uint32_t links, uint64_t sections[_SECTIONS]);
+        template <class T>
+        static void _write(std::ostream& out, const std::vector<T>& values);
+
+    public:
+        MappedGraph();
+
+        template <class TGraph>
+        static bool save(std::ostream& out, const TGraph& graph);
+
+        bool open(const std::string& path);
+        void close();
+        bool isOpen() const;
+        bool verify() const;
+        void prefetch() const;
+
+        uint32_t getNodeAmount() const;
+        uint32_t getLinkAmount() const;
+        uint32_t getMaxNodeAmount() const;
+
+        void create();
+
+        bool isEmpty() const;
+        bool isNodeEnabled(const GraphNode& node) const;
+        bool isLinkActive(const GraphNode& from, const GraphNode& to) const;
+
+        TNodeLabel getLabel(const GraphNode& node) const;
+        TLinkWeight getWeight(const GraphNode& from, const GraphNode& to) const;
+
+        void addNode(GraphNode& node, TNodeLabel label);
+        void addNode(GraphNode& node);
+        void addLink(GraphNode& from, GraphNode& to, TLinkWeight weight);
+
+        void eraseNode(GraphNode& node);
+        void eraseLink(GraphNode& from, GraphNode& to);
+
+        void setLabel(GraphNode& node, TNodeLabel label);
+        void setWeight(GraphNode& from, GraphNode& to, TLinkWeight weight);
+
+        GraphNodeList getAdjacentToANode(const GraphNode& node) const;
+        GraphNodeList getAdjacentFromANode(const GraphNode& node) const;
+
+        OutLinkRange getOutLinks(const GraphNode& node) const;
+        InLinkRange getInLinks(const GraphNode& node) const;
+
+        uint32_t getDegreeTo(const GraphNode& node) const;
+        uint32_t getDegreeFrom(const GraphNode& node) const;
+
+        GraphNodeList getAdjacentNode(const GraphNode& node) const;
+        GraphNodeList getAllNodes() const;
+
+        template <class TypeNodeLabel, class TypeLinkWeight>
+        friend std::ostream& operator<<(std::ostream&, const MappedGraph<TypeNodeLabel, TypeLinkWeight>& graph);
+};
+
+template <class TNodeLabel, class TLinkWeight>
+const uint32_t MappedGraph<TNodeLabel, TLinkWeight>::_MAGIC;
+
+template <class TNodeLabel, class TLinkWeight>
+const uint32_t MappedGraph<TNodeLabel, TLinkWeight>::_VERSION;
+
+template <class TNodeLabel, class TLinkWeight>
+const uint32_t MappedGraph<TNodeLabel, TLinkWeight>::_HEADER;
+
+template <class TNodeLabel, class TLinkWeight>
+const uint32_t MappedGraph<TNodeLabel, TLinkWeight>::_SECTIONS;
+
+template <class TNodeLabel, class TLinkWeight>
+const uint64_t MappedGraph<TNodeLabel, TLinkWeight>::_ALIGNMENT;
+
+template <class TNodeLabel, class TLinkWeight>
+const uint64_t MappedGraph<TNodeLabel, TLinkWeight>::_NO_LINK;
+
+
+/**
+ * Crea un grafo vuoto, senza istantanea aperta
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+MappedGraph<TNodeLabel, TLinkWeight>::MappedGraph()
+{
+    this->_reset();
+}
+
+/**
+ * Scrive sullo stream l'istantanea di un grafo, da riaprire con open(). Lo stream va
+ * aperto in modalita' binaria. Gli archi di ogni nodo vengono ordinati per nodo di
+ * arrivo e l'indice degli archi entranti viene costruito con un counting sort, quindi
+ * basta che il grafo offra getOutLinks(); per un Graph la lettura costa O(V^2).
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @tparam TGraph : Tipo del grafo da salvare
+ * @param out : Stream su cui scrivere
+ * @param graph : Grafo da salvare
+ * @return True se la scrittura e' riuscita, false in caso di errore o se il grafo ha 2^32 archi o piu'
+ */
+template <class TNodeLabel, class TLinkWeight>
+template <class TGraph>
+bool MappedGraph<TNodeLabel, TLinkWeight>::save(std::ostream& out, const TGraph& graph)
+{
+    uint32_t size = graph.getMaxNodeAmount();
+    uint32_t nodes = 0;
+
+    std::vector<uint8_t> enabled(size, 0);
+    std::vector<TNodeLabel> labels(size, TNodeLabel());
+    std::vector<uint64_t> offsets(size + 1, 0);
+    std::vector<uint32_t> targets;
+    std::vector<TLinkWeight> weights;
+    std::vector< GraphNeighbour<TLinkWeight> > neighbours;
+
+    // Archi uscenti, ordinati per nodo di arrivo come richiede la ricerca binaria di _findLink
+    for (uint32_t u = 0; u < size; u++)
+    {
+        offsets[u + 1] = offsets[u];
+
+        if (!graph.isNodeEnabled(GraphNode(u)))
+        {
+            continue;
+        }
+
+        enabled[u] = 1;
+        labels[u] = graph.getLabel(GraphNode(u));
+        nodes++;
+        neighbours.clear();
+
+        for (auto link : graph.getOutLinks(GraphNode(u)))
+        {
+            neighbours.push_back(link);
+        }
+
+        std::sort(neighbours.begin(), neighbours.end(), [](const GraphNeighbour<TLinkWeight>& first, const GraphNeighbour<TLinkWeight>& second)
+        {
+            return first.id < second.id;
+        });
+
+        for (std::size_t i = 0; i < neighbours.size(); i++)
+        {
+            targets.push_back(neighbours[i].id);
+            weights.push_back(neighbours[i].weight);
+        }
+
+        offsets[u + 1] = targets.size();
+    }
+
+    if (targets.size() >= UINT32_MAX)
+    {
+        return false;
+    }
+
+    // Archi entranti, con lo stesso counting sort di CsrGraph
+    std::vector<uint64_t> inOffsets(size + 1, 0);
+    std::vector<uint32_t> inSources(targets.size());
+    std::vector<TLinkWeight> inWeights(targets.size());
+
+    for (std::size_t pos = 0; pos < targets.size(); pos++)
+    {
+        inOffsets[targets[pos] + 1]++;
+    }
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        inOffsets[i + 1] += inOffsets[i];
+    }
+
+    std::vector<uint64_t> next(inOffsets.begin(), inOffsets.end() - 1);
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        for (uint64_t pos = offsets[i]; pos < offsets[i + 1]; pos++)
+        {
+            uint64_t inPos = next[targets[pos]]++;
+
+            inSources[inPos] = i;
+            inWeights[inPos] = weights[pos];
+        }
+    }
+
+    uint32_t header[_HEADER] = { _MAGIC, _VERSION, (uint32_t) sizeof(TNodeLabel), (uint32_t) sizeof(TLinkWeight), size, nodes, (uint32_t) targets.size(), 0 };
+
+    out.write((const char*) header, sizeof(header));
+
+    MappedGraph<TNodeLabel, TLinkWeight>::_write(out, enabled);
+    MappedGraph<TNodeLabel, TLinkWeight>::_write(out, labels);
+    MappedGraph<TNodeLabel, TLinkWeight>::_write(out, offsets);
+    MappedGraph<TNodeLabel, TLinkWeight>::_write(out, targets);
+    MappedGraph<TNodeLabel, TLinkWeight>::_write(out, weights);
+    MappedGraph<TNodeLabel, TLinkWeight>::_write(out, inOffsets);
+    MappedGraph<TNodeLabel, TLinkWeight>::_write(out, inSources);
+    MappedGraph<TNodeLabel, TLinkWeight>::_write(out, inWeights);
+
+    return out.good();
+}
+
+/**
+ * Mappa in memoria un'istantanea scritta da save(), sostituendo quella attuale. Vengono
+ * controllati solo l'intestazione, la dimensione del file e gli estremi degli offset: il
+ * resto del file non viene letto. Se il file non e' valido (formato, versione o tipi
+ * diversi, dimensione incoerente), il grafo resta vuoto.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param path : Percorso dell'istantanea
+ * @return True se l'istantanea e' stata aperta, altrimenti false
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool MappedGraph<TNodeLabel, TLinkWeight>::open(const std::string& path)
+{
+    uint32_t header[_HEADER];
+    uint64_t sections[_SECTIONS];
+
+    this->close();
+
+    if (!this->_file.open(path) || this->_file.getSize() < sizeof(header))
+    {
+        this->close();
+        return false;
+    }
+
+    const uint8_t* data = this->_file.getData();
+
+    std::memcpy(header, data, sizeof(header));
+
+    if (header[0] != _MAGIC || header[1] != _VERSION || header[2] != sizeof(TNodeLabel) || header[3] != sizeof(TLinkWeight) ||
+        header[5] > header[4] || MappedGraph<TNodeLabel, TLinkWeight>::_layout(header[4], header[6], sections) != this->_file.getSize())
+    {
+        this->close();
+        return false;
+    }
+
+    this->_gSize = header[4];
+    this->_nodeAmount = header[5];
+    this->_linkAmount = header[6];
+
+    this->_enabled = data + sections[0];
+    this->_labels = (const TNodeLabel*) (data + sections[1]);
+    this->_offsets = (const uint64_t*) (data + sections[2]);
+    this->_targets = (const uint32_t*) (data + sections[3]);
+    this->_weights = (const TLinkWeight*) (data + sections[4]);
+    this->_inOffsets = (const uint64_t*) (data + sections[5]);
+    this->_inSources = (const uint32_t*) (data + sections[6]);
+    this->_inWeights = (const TLinkWeight*) (data + sections[7]);
+
+    if (this->_offsets[0] != 0 || this->_offsets[this->_gSize] != this->_linkAmount ||
+        this->_inOffsets[0] != 0 || this->_inOffsets[this->_gSize] != this->_linkAmount)
+    {
+        this->close();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Chiude l'istantanea aperta e lascia il grafo vuoto. Gli intervalli di archi ottenuti
+ * in precedenza non sono piu' validi.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::close()
+{
+    this->_file.close();
+    this->_reset();
+}
+
+/**
+ * Restituisce true se un'istantanea e' aperta, altrimenti false
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return True se un'istantanea e' aperta
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool MappedGraph<TNodeLabel, TLinkWeight>::isOpen() const
+{
+    return this->_file.isOpen();
+}
+
+/**
+ * Controlla tutto il contenuto dell'istantanea aperta: offset crescenti, archi fra nodi
+ * attivi e ordinati per nodo all'altro capo, numero di nodi attivi. Legge l'intero file,
+ * quindi costa O(V + E); va chiamato prima di interrogare file di provenienza incerta.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return True se l'istantanea e' coerente, altrimenti false
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool MappedGraph<TNodeLabel, TLinkWeight>::verify() const
+{
+    uint32_t nodes = 0;
+
+    for (uint32_t u = 0; u < this->_gSize; u++)
+    {
+        if (this->_enabled[u] > 1)
+        {
+            return false;
+        }
+
+        nodes += this->_enabled[u];
+    }
+
+    return nodes == this->_nodeAmount &&
+           MappedGraph<TNodeLabel, TLinkWeight>::_verifyLinks(this->_gSize, this->_linkAmount, this->_enabled, this->_offsets, this->_targets) &&
+           MappedGraph<TNodeLabel, TLinkWeight>::_verifyLinks(this->_gSize, this->_linkAmount, this->_enabled, this->_inOffsets, this->_inSources);
+}
+
+/**
+ * Chiede al sistema operativo di caricare in anticipo tutta l'istantanea, cosi' che le
+ * prime interrogazioni non attendano il disco
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::prefetch() const
+{
+    this->_file.prefetch();
+}
+
+/**
+ * Restituisce il numero di nodi attualmente presente nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di nodi presenti nel grafo
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t MappedGraph<TNodeLabel, TLinkWeight>::getNodeAmount() const
+{
+    return this->_nodeAmount;
+}
+
+/**
+ * Restituisce il numero di archi attualmente presente nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di archi presenti nel grafo
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t MappedGraph<TNodeLabel, TLinkWeight>::getLinkAmount() const
+{
+    return this->_linkAmount;
+}
+
+/**
+ * Restituisce il numero di id di nodo gestiti dal grafo. Gli id dei nodi
+ * sono compresi fra 0 e questo valore escluso.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero massimo di nodi
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t MappedGraph<TNodeLabel, TLinkWeight>::getMaxNodeAmount() const
+{
+    return this->_gSize;
+}
+
+
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::create() { }
+
+
+/**
+ * Restituisce true se il grafo e' vuoto, altrimenti false.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return True se il grafo e' vuoto, altrimenti false.
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool MappedGraph<TNodeLabel, TLinkWeight>::isEmpty() const
+{
+    return (this->_nodeAmount == 0);
+}
+
+/**
+ * Restituisce true se il nodo e' attivo, altrimenti false.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da verificare
+ * @return True se il nodo e' attivo, altrimenti false.
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool MappedGraph<TNodeLabel, TLinkWeight>::isNodeEnabled(const GraphNode& node) const
+{
+    uint32_t id = node.getId();
+
+    return (id < this->_gSize && this->_enabled[id] != 0);
+}
+
+/**
+ * Restituisce true se l'arco e' attivo, altrimenti false.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from : Nodo di partenza
+ * @param to: Nodo di arrivo
+ * @return True se l'arco e' attivo, altrimenti false.
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool MappedGraph<TNodeLabel, TLinkWeight>::isLinkActive(const GraphNode& from, const GraphNode& to) const
+{
+    if (!this->isNodeEnabled(from) || !this->isNodeEnabled(to))
+    {
+        return false;
+    }
+
+    return (this->_findLink(from.getId(), to.getId()) != _NO_LINK);
+}
+
+/**
+ * Restituisce l'etichetta contenuta nel nodo, oppure un'etichetta vuota se il nodo non e' attivo.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo a cui leggere l'etichetta
+ * @return Etichetta del nodo.
+ */
+template <class TNodeLabel, class TLinkWeight>
+TNodeLabel MappedGraph<TNodeLabel, TLinkWeight>::getLabel(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return TNodeLabel();
+    }
+
+    return this->_labels[node.getId()];
+}
+
+/**
+ * Restituisce il peso dell'arco, oppure un peso vuoto se l'arco non esiste.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from: Nodo di partenza
+ * @param to: Nodo di arrivo
+ * @return Peso dell'arco che va da from a to
+ */
+template <class TNodeLabel, class TLinkWeight>
+TLinkWeight MappedGraph<TNodeLabel, TLinkWeight>::getWeight(const GraphNode& from, const GraphNode& to) const
+{
+    if (!this->isNodeEnabled(from) || !this->isNodeEnabled(to))
+    {
+        return TLinkWeight();
+    }
+
+    uint64_t pos = this->_findLink(from.getId(), to.getId());
+
+    if (pos == _NO_LINK)
+    {
+        return TLinkWeight();
+    }
+
+    return this->_weights[pos];
+}
+
+
+/**
+ * Operazione non ammessa: il grafo mappato e' in sola lettura.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da aggiungere
+ * @param label : Etichetta del nodo
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::addNode(GraphNode& node, TNodeLabel label) { }
+
+/**
+ * Operazione non ammessa: il grafo mappato e' in sola lettura.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da aggiungere
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::addNode(GraphNode& node) { }
+
+/**
+ * Operazione non ammessa: il grafo mappato e' in sola lettura.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @param weight : Peso arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::addLink(GraphNode& from, GraphNode& to, TLinkWeight weight) { }
+
+/**
+ * Operazione non ammessa: il grafo mappato e' in sola lettura.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da cancellare
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::eraseNode(GraphNode& node) { }
+
+/**
+ * Operazione non ammessa: il grafo mappato e' in sola lettura.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::eraseLink(GraphNode& from, GraphNode& to) { }
+
+/**
+ * Operazione non ammessa: il grafo mappato e' in sola lettura.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo a cui aggiungere un'etichetta
+ * @param label : Etichetta da aggiungere
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::setLabel(GraphNode& node, TNodeLabel label) { }
+
+/**
+ * Operazione non ammessa: il grafo mappato e' in sola lettura.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from : Nodo di partenza
+ * @param to : Nodo di arrivo
+ * @param weight : Peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::setWeight(GraphNode& from, GraphNode& to, TLinkWeight weight) { }
+
+/**
+ * Restituisce una lista di id di nodi che sono puntati da node.
+ * Se node non esiste, allora restituisce una lista vuota.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da cui ricavare la lista
+ * @return Lista di id di nodi che sono puntati da node
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename MappedGraph<TNodeLabel, TLinkWeight>::GraphNodeList MappedGraph<TNodeLabel, TLinkWeight>::getAdjacentToANode(const GraphNode& node) const
+{
+    GraphNodeList nodes;
+
+    for (auto link : this->getOutLinks(node))
+    {
+        nodes.append(link.id);
+    }
+
+    return nodes;
+}
+
+/**
+ * Restituisce una lista di id di nodi che puntano a node.
+ * Se node non esiste, allora restituisce una lista vuota.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo da cui ricavare la lista
+ * @return Lista di id di nodi che puntano a node
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename MappedGraph<TNodeLabel, TLinkWeight>::GraphNodeList MappedGraph<TNodeLabel, TLinkWeight>::getAdjacentFromANode(const GraphNode& node) const
+{
+    GraphNodeList nodes;
+
+    for (auto link : this->getInLinks(node))
+    {
+        nodes.append(link.id);
+    }
+
+    return nodes;
+}
+
+/**
+ * Restituisce l'intervallo degli archi uscenti da node, letto direttamente dalla
+ * mappatura. Se node non esiste, allora l'intervallo e' vuoto.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo di partenza
+ * @return Intervallo degli archi uscenti
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename MappedGraph<TNodeLabel, TLinkWeight>::OutLinkRange MappedGraph<TNodeLabel, TLinkWeight>::getOutLinks(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return OutLinkRange(CsrLinkIterator<TLinkWeight>(nullptr, nullptr), CsrLinkIterator<TLinkWeight>(nullptr, nullptr));
+    }
+
+    uint32_t id = node.getId();
+    uint64_t first = this->_offsets[id];
+    uint64_t last = this->_offsets[id + 1];
+
+    return OutLinkRange(CsrLinkIterator<TLinkWeight>(this->_targets + first, this->_weights + first),
+                        CsrLinkIterator<TLinkWeight>(this->_targets + last, this->_weights + last));
+}
+
+/**
+ * Restituisce l'intervallo degli archi entranti in node, letto direttamente dalla
+ * mappatura. Se node non esiste, allora l'intervallo e' vuoto.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo di arrivo
+ * @return Intervallo degli archi entranti
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename MappedGraph<TNodeLabel, TLinkWeight>::InLinkRange MappedGraph<TNodeLabel, TLinkWeight>::getInLinks(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return InLinkRange(CsrLinkIterator<TLinkWeight>(nullptr, nullptr), CsrLinkIterator<TLinkWeight>(nullptr, nullptr));
+    }
+
+    uint32_t id = node.getId();
+    uint64_t first = this->_inOffsets[id];
+    uint64_t last = this->_inOffsets[id + 1];
+
+    return InLinkRange(CsrLinkIterator<TLinkWeight>(this->_inSources + first, this->_inWeights + first),
+                       CsrLinkIterator<TLinkWeight>(this->_inSources + last, this->_inWeights + last));
+}
+
+/**
+ * Restituisce il numero di archi uscenti dal nodo in tempo costante
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo a cui calcolare il numero di archi uscenti
+ * @return numero di archi uscenti dal nodo
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t MappedGraph<TNodeLabel, TLinkWeight>::getDegreeTo(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return 0;
+    }
+
+    uint32_t id = node.getId();
+
+    return (uint32_t) (this->_offsets[id + 1] - this->_offsets[id]);
+}
+
+/**
+ * Restituisce il numero di archi entranti nel nodo in tempo costante
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo a cui calcolare il numero di archi entranti
+ * @return numero di archi entranti nel nodo
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint32_t MappedGraph<TNodeLabel, TLinkWeight>::getDegreeFrom(const GraphNode& node) const
+{
+    if (!this->isNodeEnabled(node))
+    {
+        return 0;
+    }
+
+    uint32_t id = node.getId();
+
+    return (uint32_t) (this->_inOffsets[id + 1] - this->_inOffsets[id]);
+}
+
+/**
+ * Restituisce una lista contenente tutti gli id dei nodi adiacenti a node
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo a cui trovare i suoi vicini
+ * @return Lista di id di nodi adiacenti a node
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename MappedGraph<TNodeLabel, TLinkWeight>::GraphNodeList MappedGraph<TNodeLabel, TLinkWeight>::getAdjacentNode(const GraphNode& node) const
+{
+    GraphNodeList adjacentNodes = this->getAdjacentToANode(node);
+
+    // Aggiungo i nodi entranti che non sono gia' stati inseriti come nodi uscenti
+    for (auto link : this->getInLinks(node))
+    {
+        if (this->_findLink(node.getId(), link.id) == _NO_LINK)
+        {
+            adjacentNodes.append(link.id);
+        }
+    }
+
+    return adjacentNodes;
+}
+
+/**
+ * Restituisce una lista contenente gli id di tutti i nodi presenti nel grafo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Lista degli id di tutti i nodi del grafo
+ */
+template <class TNodeLabel, class TLinkWeight>
+typename MappedGraph<TNodeLabel, TLinkWeight>::GraphNodeList MappedGraph<TNodeLabel, TLinkWeight>::getAllNodes() const
+{
+    GraphNodeList nodes;
+
+    for (uint32_t i = 0; i < this->_gSize; i++)
+    {
+        if (this->_enabled[i] != 0)
+        {
+            nodes.append(i);
+        }
+    }
+
+    return nodes;
+}
+
+
+/**
+ * Riporta il grafo vuoto, senza toccare la mappatura
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TNodeLabel, class TLinkWeight>
+void MappedGraph<TNodeLabel, TLinkWeight>::_reset()
+{
+    this->_gSize = 0;
+    this->_nodeAmount = 0;
+    this->_linkAmount = 0;
+
+    this->_enabled = nullptr;
+    this->_labels = nullptr;
+    this->_offsets = nullptr;
+    this->_targets = nullptr;
+    this->_weights = nullptr;
+    this->_inOffsets = nullptr;
+    this->_inSources = nullptr;
+    this->_inWeights = nullptr;
+}
+
+/**
+ * Cerca l'arco (fromId, toId) con una ricerca binaria tra gli archi uscenti di fromId.
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param fromId : Id del nodo di partenza
+ * @param toId : Id del nodo di arrivo
+ * @return Posizione dell'arco negli array degli archi, oppure _NO_LINK
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint64_t MappedGraph<TNodeLabel, TLinkWeight>::_findLink(uint32_t fromId, uint32_t toId) const
+{
+    const uint32_t* first = this->_targets + this->_offsets[fromId];
+    const uint32_t* last = this->_targets + this->_offsets[fromId + 1];
+    const uint32_t* found = std::lower_bound(first, last, toId);
+
+    if (found != last && *found == toId)
+    {
+        return (uint64_t) (found - this->_targets);
+    }
+
+    return _NO_LINK;
+}
+
+/**
+ * Controlla un indice CSR dell'istantanea: offset crescenti, archi solo da nodi attivi
+ * verso nodi attivi, estremi strettamente crescenti fra gli archi di ogni nodo
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param size : Numero di id di nodo
+ * @param links : Numero di archi
+ * @param enabled : Nodi attivi
+ * @param offsets : Inizio degli archi di ogni nodo, lungo size + 1
+ * @param heads : Nodo all'altro capo di ogni arco
+ * @return True se l'indice e' coerente, altrimenti false
+ */
+template <class TNodeLabel, class TLinkWeight>
+bool MappedGraph<TNodeLabel, TLinkWeight>::_verifyLinks(uint32_t size, uint32_t links, const uint8_t* enabled, const uint64_t* offsets, const uint32_t* heads)
+{
+    for (uint32_t u = 0; u < size; u++)
+    {
+        if (offsets[u] > offsets[u + 1] || offsets[u + 1] > links || (enabled[u] == 0 && offsets[u] != offsets[u + 1]))
+        {
+            return false;
+        }
+
+        for (uint64_t pos = offsets[u]; pos < offsets[u + 1]; pos++)
+        {
+            if (heads[pos] >= size || enabled[heads[pos]] == 0 || (pos > offsets[u] && heads[pos - 1] >= heads[pos]))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Calcola la posizione di ogni sezione di un'istantanea e la sua dimensione totale
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param size : Numero di id di nodo
+ * @param links : Numero di archi
+ * @param sections : Posizione in byte dell'inizio di ogni sezione, riempito dal metodo
+ * @return Dimensione in byte dell'istantanea
+ */
+template <class TNodeLabel, class TLinkWeight>
+uint64_t MappedGraph<TNodeLabel, TLinkWeight>::_layout(uint32_t size, uint32_t links, uint64_t sections[_SECTIONS])
+{
+    uint64_t lengths[_SECTIONS] =
+    {
+        (uint64_t) size,
+        (uint64_t) size * sizeof(TNodeLabel),
+        ((uint64_t) size + 1) * sizeof(uint64_t),
+        (uint64_t) links * sizeof(uint32_t),
+        (uint64_t) links * sizeof(TLinkWeight),
+        ((uint64_t) size + 1) * sizeof(uint64_t),
+        (uint64_t) links * sizeof(uint32_t),
+        (uint64_t) links * sizeof(TLinkWeight)
+    };
+    uint64_t position = _HEADER * sizeof(uint32_t);
+
+    for (uint32_t i = 0; i < _SECTIONS; i++)
+    {
+        sections[i] = position;
+        position += (lengths[i] + _ALIGNMENT - 1) / _ALIGNMENT * _ALIGNMENT;
+    }
+
+    return position;
+}
+
+/**
+ * Scrive un vettore sullo stream in formato binario, seguito dagli zeri che portano la
+ * sezione successiva a un multiplo di _ALIGNMENT byte
+ *
+ * @tparam TNodeLabel : Tipo dell'etichetta
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @tparam T : Tipo degli elementi
+ * @param out : Stream su cui scrivere
+ * @param values : Valori da scrivere
+ */
+template <class TNodeLabel, class TLinkWeight>
+template <class T>
+void MappedGraph<TNodeLabel, TLinkWeight>::_write(std::ostream& out, const std::vector<T>& values)
+{
+    static const char padding[_ALIGNMENT] = { 0 };
+    uint64_t length = values.size() * sizeof(T);
+
+    if (length > 0)
+    {
+        out.write((const char*) values.data(), (std::streamsize) length);
+    }
+
+    out.write(padding, (std::streamsize) ((_ALIGNMENT - length % _ALIGNMENT) % _ALIGNMENT));
+}
+
+
+template <class TypeNodeLabel, class TypeLinkWeight>
+std::ostream& operator<<(std::ostream& out, const MappedGraph<TypeNodeLabel, TypeLinkWeight>& graph)
+{
+    if(graph.isEmpty())
+    {
+        out << "[grafo vuoto]";
+        out << std::endl << std::endl;
+        return out;
+    }
+
+    for(uint32_t i = 0; i < graph._gSize; i++)
+    {
+        if(graph._enabled[i] != 0)
+        {
+            out << std::endl << "[" << i << ", " << graph._labels[i] << "]--->\t";
+
+            for(uint64_t pos = graph._offsets[i]; pos < graph._offsets[i + 1]; pos++)
+            {
+                out << "(" << graph._targets[pos] << ", " << graph._weights[pos] << ")\t";
+            }
+        }
+    }
+
+    out << std::endl << std::endl;
+    return out;
+}
+
+#endif // _MAPPEDGRAPH_H
@@ -0,0 +1,536 @@
+#ifndef _PARALLELBFS_H
+#define _PARALLELBFS_H
+
+#include "Graph.h"
+#include "../Lib/AtomicBitSet.h"
+#include "../Lib/Bits.h"
+#include "../Lib/ThreadPool.h"
+
+#include <atomic>
+#include <vector>
+
+/**
+ * Motore per la visita in ampiezza (BFS) parallela, a livelli sincroni, che alterna
+ * passi top-down e bottom-up a seconda della dimensione della frontiera (Beamer).
+ *
+ * Ad ogni livello la frontiera e' un insieme di bit:
+ *  - nel passo top-down i thread si dividono le parole della frontiera e ogni nodo della
+ *    frontiera prova a reclamare i suoi vicini non ancora visitati con una CAS sul padre;
+ *  - nel passo bottom-up i thread si dividono i nodi non ancora visitati e ognuno cerca,
+ *    fra i suoi predecessori, un nodo della frontiera, fermandosi al primo trovato.
+ * Il top-down costa quanto gli archi uscenti dalla frontiera, il bottom-up al piu' quanto
+ * gli archi entranti nei nodi non visitati: si passa al bottom-up quando gli archi della
+ * frontiera superano 1 / alpha degli archi dei nodi non visitati, e si torna al top-down
+ * quando la frontiera si restringe sotto 1 / beta dei nodi.
+ *
+ * Il passo bottom-up richiede che getInLinks() costi quanto il grado entrante del nodo,
+ * come nel CsrGraph; per il Graph, dove costa O(V), conviene impostare alpha a zero per
+ * usare solo passi top-down.
+ *
+ * I gradi uscenti dei nodi vengono calcolati alla creazione del motore: se il grafo viene
+ * modificato bisogna chiamare update() prima della visita successiva.
+ *
+ * @tparam TGraph : Tipo del grafo da visitare
+ */
+template <class TGraph>
+class ParallelBfs
+{
+    public:
+        static const uint32_t UNREACHED = UINT32_MAX; // Livello e padre dei nodi non raggiunti
+        static const uint32_t DEFAULT_ALPHA = 14; // Soglia per il passaggio al bottom-up
+        static const uint32_t DEFAULT_BETA = 24; // Soglia per il ritorno al top-down
+
+    private:
+        static const uint32_t _GRAIN_WORDS = 64; // Parole della frontiera per blocco di lavoro
+        static const uint32_t _GRAIN_NODES = 16384; // Nodi per blocco di inizializzazione
+
+        const TGraph& _graph; // Grafo da visitare
+        ThreadPool& _pool; // Thread su cui eseguire la visita
+        uint32_t _alpha; // Soglia per il passaggio al bottom-up, zero per disattivarlo
+        uint32_t _beta; // Soglia per il ritorno al top-down
+
+        std::vector<uint32_t> _outDegrees; // Grado uscente di ogni nodo
+        uint64_t _linkAmount; // Numero totale di archi
+
+        std::vector< std::atomic<uint32_t> > _claims; // Padre di ogni nodo durante la visita
+        std::vector<uint32_t> _levels; // Livello di ogni nodo nell'ultima visita
+        std::vector<uint32_t> _parents; // Padre di ogni nodo nell'ultima visita
+        AtomicBitSet _frontier; // Nodi del livello corrente
+        AtomicBitSet _next; // Nodi del livello successivo
+
+        uint32_t _reachedAmount; // Nodi raggiunti nell'ultima visita
+        uint32_t _depth; // Numero di livelli dell'ultima visita
+        uint32_t _topDownSteps; // Passi top-down dell'ultima visita
+        uint32_t _bottomUpSteps; // Passi bottom-up dell'ultima visita
+
+    private:
+        void _reset();
+        uint32_t _topDownStep(uint32_t level, uint64_t& frontierLinks);
+        uint32_t _bottomUpStep(uint32_t level, uint64_t& frontierLinks);
+
+    public:
+        ParallelBfs(const TGraph& graph, ThreadPool& pool);
+
+        void update();
+        void setThresholds(uint32_t alpha, uint32_t beta);
+
+        void run(const GraphNode& start);
+
+        const std::vector<uint32_t>& getLevels() const;
+        const std::vector<uint32_t>& getParents() const;
+
+        uint32_t getLevel(const GraphNode& node) const;
+        uint32_t getParent(const GraphNode& node) const;
+        bool isReachable(const GraphNode& node) const;
+
+        uint32_t getReachedAmount() const;
+        uint32_t getDepth() const;
+        uint32_t getTopDownSteps() const;
+        uint32_t getBottomUpSteps() const;
+};
+
+template <class TGraph>
+const uint32_t ParallelBfs<TGraph>::UNREACHED;
+
+template <class TGraph>
+const uint32_t ParallelBfs<TGraph>::DEFAULT_ALPHA;
+
+template <class TGraph>
+const uint32_t ParallelBfs<TGraph>::DEFAULT_BETA;
+
+
+/**
+ * Crea un motore di visita parallela sul grafo dato, usando i thread di pool.
+ * Il grafo e il pool devono sopravvivere al motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo da visitare
+ * @param pool : Thread su cui eseguire la visita
+ */
+template <class TGraph>
+ParallelBfs<TGraph>::ParallelBfs(const TGraph& graph, ThreadPool& pool) : _graph(graph), _pool(pool)
+{
+    this->_alpha = DEFAULT_ALPHA;
+    this->_beta = DEFAULT_BETA;
+    this->_reachedAmount = 0;
+    this->_depth = 0;
+    this->_topDownSteps = 0;
+    this->_bottomUpSteps = 0;
+
+    this->update();
+}
+
+/**
+ * Ricalcola in parallelo i gradi uscenti dei nodi. Va chiamato se il grafo e' cambiato
+ * dopo la creazione del motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void ParallelBfs<TGraph>::update()
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+    std::atomic<uint64_t> linkAmount(0);
+
+    this->_outDegrees.assign(size, 0);
+
+    this->_pool.parallelFor(0, size, _GRAIN_NODES, [this, &linkAmount](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        uint64_t links = 0;
+
+        for (uint32_t u = from; u < to; u++)
+        {
+            uint32_t degree = 0;
+
+            if (this->_graph.isNodeEnabled(GraphNode(u)))
+            {
+                auto links = this->_graph.getOutLinks(GraphNode(u));
+
+                for (auto it = links.begin(); it != links.end(); ++it)
+                {
+                    degree++;
+                }
+            }
+
+            this->_outDegrees[u] = degree;
+            links += degree;
+        }
+
+        linkAmount.fetch_add(links, std::memory_order_relaxed);
+    });
+
+    this->_linkAmount = linkAmount.load();
+
+    if (this->_claims.size() != size)
+    {
+        std::vector< std::atomic<uint32_t> > claims(size);
+        this->_claims.swap(claims);
+    }
+
+    this->_frontier.resize(size);
+    this->_next.resize(size);
+}
+
+/**
+ * Imposta le soglie per il cambio di direzione. Con alpha uguale a zero la visita usa
+ * solo passi top-down.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param alpha : Si passa al bottom-up quando gli archi della frontiera superano 1 / alpha
+ *                degli archi dei nodi non visitati
+ * @param beta : Si torna al top-down quando la frontiera scende sotto 1 / beta dei nodi
+ */
+template <class TGraph>
+void ParallelBfs<TGraph>::setThresholds(uint32_t alpha, uint32_t beta)
+{
+    this->_alpha = alpha;
+    this->_beta = (beta == 0) ? 1 : beta;
+}
+
+/**
+ * Visita in ampiezza i nodi raggiungibili da start, calcolando per ognuno il livello
+ * (distanza in archi da start) e il padre nell'albero della visita. Il padre di start
+ * e' start stesso; i nodi non raggiunti hanno livello e padre UNREACHED.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param start : Nodo di partenza
+ */
+template <class TGraph>
+void ParallelBfs<TGraph>::run(const GraphNode& start)
+{
+    this->_reset();
+
+    if (!this->_graph.isNodeEnabled(start) || start.getId() >= this->_outDegrees.size())
+    {
+        return;
+    }
+
+    uint32_t size = (uint32_t) this->_outDegrees.size();
+    uint32_t root = start.getId();
+
+    this->_claims[root].store(root, std::memory_order_relaxed);
+    this->_levels[root] = 0;
+    this->_frontier.clear();
+    this->_frontier.set(root);
+
+    uint32_t frontierSize = 1;
+    uint64_t frontierLinks = this->_outDegrees[root]; // Archi uscenti dalla frontiera
+    uint64_t unexploredLinks = this->_linkAmount - frontierLinks; // Archi uscenti dai nodi non visitati
+    bool isGrowing = true; // True se la frontiera e' cresciuta nell'ultimo passo
+    bool isBottomUp = false;
+
+    this->_reachedAmount = 1;
+
+    for (uint32_t level = 0; frontierSize > 0; level++)
+    {
+        this->_depth = level + 1;
+
+        if (!isBottomUp)
+        {
+            isBottomUp = (this->_alpha != 0 && frontierLinks * this->_alpha > unexploredLinks);
+        }
+
+        else if (!isGrowing && frontierSize < size / this->_beta)
+        {
+            isBottomUp = false;
+        }
+
+        this->_pool.parallelFor(0, this->_next.getWordAmount(), _GRAIN_NODES, [this](uint32_t fromWord, uint32_t toWord, uint32_t thread)
+        {
+            this->_next.clear(fromWord, toWord);
+        });
+
+        uint32_t nextSize;
+
+        if (isBottomUp)
+        {
+            nextSize = this->_bottomUpStep(level, frontierLinks);
+            this->_bottomUpSteps++;
+        }
+
+        else
+        {
+            nextSize = this->_topDownStep(level, frontierLinks);
+            this->_topDownSteps++;
+        }
+
+        isGrowing = (nextSize > frontierSize);
+        frontierSize = nextSize;
+        unexploredLinks -= frontierLinks;
+        this->_reachedAmount += frontierSize;
+        this->_frontier.swap(this->_next);
+    }
+
+    this->_pool.parallelFor(0, size, _GRAIN_NODES, [this](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t u = from; u < to; u++)
+        {
+            this->_parents[u] = this->_claims[u].load(std::memory_order_relaxed);
+        }
+    });
+}
+
+/**
+ * Restituisce il livello di ogni nodo nell'ultima visita, UNREACHED se non raggiunto
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Vettore dei livelli, indicizzato per id del nodo
+ */
+template <class TGraph>
+const std::vector<uint32_t>& ParallelBfs<TGraph>::getLevels() const
+{
+    return this->_levels;
+}
+
+/**
+ * Restituisce il padre di ogni nodo nell'ultima visita, UNREACHED se non raggiunto
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Vettore dei padri, indicizzato per id del nodo
+ */
+template <class TGraph>
+const std::vector<uint32_t>& ParallelBfs<TGraph>::getParents() const
+{
+    return this->_parents;
+}
+
+/**
+ * Restituisce il livello di un nodo nell'ultima visita
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo
+ * @return Distanza in archi dal nodo di partenza, UNREACHED se non raggiunto
+ */
+template <class TGraph>
+uint32_t ParallelBfs<TGraph>::getLevel(const GraphNode& node) const
+{
+    if (node.getId() >= this->_levels.size())
+    {
+        return UNREACHED;
+    }
+
+    return this->_levels[node.getId()];
+}
+
+/**
+ * Restituisce il padre di un nodo nell'albero dell'ultima visita
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo
+ * @return Id del padre, UNREACHED se non raggiunto
+ */
+template <class TGraph>
+uint32_t ParallelBfs<TGraph>::getParent(const GraphNode& node) const
+{
+    if (node.getId() >= this->_parents.size())
+    {
+        return UNREACHED;
+    }
+
+    return this->_parents[node.getId()];
+}
+
+/**
+ * Restituisce true se node e' stato raggiunto nell'ultima visita
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo da controllare
+ * @return True se node e' raggiungibile, altrimenti false
+ */
+template <class TGraph>
+bool ParallelBfs<TGraph>::isReachable(const GraphNode& node) const
+{
+    return this->getLevel(node) != UNREACHED;
+}
+
+/**
+ * Restituisce il numero di nodi raggiunti nell'ultima visita, compreso il nodo di partenza
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di nodi raggiunti
+ */
+template <class TGraph>
+uint32_t ParallelBfs<TGraph>::getReachedAmount() const
+{
+    return this->_reachedAmount;
+}
+
+/**
+ * Restituisce il numero di livelli dell'ultima visita, cioe' il massimo livello piu' uno
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di livelli, zero se la visita non e' partita
+ */
+template <class TGraph>
+uint32_t ParallelBfs<TGraph>::getDepth() const
+{
+    return this->_depth;
+}
+
+/**
+ * Restituisce il numero di passi top-down dell'ultima visita
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di passi top-down
+ */
+template <class TGraph>
+uint32_t ParallelBfs<TGraph>::getTopDownSteps() const
+{
+    return this->_topDownSteps;
+}
+
+/**
+ * Restituisce il numero di passi bottom-up dell'ultima visita
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di passi bottom-up
+ */
+template <class TGraph>
+uint32_t ParallelBfs<TGraph>::getBottomUpSteps() const
+{
+    return this->_bottomUpSteps;
+}
+
+/**
+ * Riporta in parallelo tutti i nodi allo stato non raggiunto
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void ParallelBfs<TGraph>::_reset()
+{
+    uint32_t size = (uint32_t) this->_outDegrees.size();
+
+    this->_levels.resize(size);
+    this->_parents.resize(size);
+    this->_reachedAmount = 0;
+    this->_depth = 0;
+    this->_topDownSteps = 0;
+    this->_bottomUpSteps = 0;
+
+    this->_pool.parallelFor(0, size, _GRAIN_NODES, [this](uint32_t from, uint32_t to, uint32_t thread)
+    {
+        for (uint32_t u = from; u < to; u++)
+        {
+            this->_claims[u].store(UNREACHED, std::memory_order_relaxed);
+            this->_levels[u] = UNREACHED;
+            this->_parents[u] = UNREACHED;
+        }
+    });
+}
+
+/**
+ * Passo top-down: ogni nodo della frontiera reclama i suoi vicini non ancora visitati.
+ * Se piu' nodi della frontiera hanno lo stesso vicino, la CAS sul padre ne sceglie uno.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param level : Livello della frontiera corrente
+ * @param frontierLinks : Archi uscenti dalla nuova frontiera
+ * @return Numero di nodi della nuova frontiera
+ */
+template <class TGraph>
+uint32_t ParallelBfs<TGraph>::_topDownStep(uint32_t level, uint64_t& frontierLinks)
+{
+    std::atomic<uint32_t> nextSize(0);
+    std::atomic<uint64_t> nextLinks(0);
+
+    this->_pool.parallelFor(0, this->_frontier.getWordAmount(), _GRAIN_WORDS, [this, level, &nextSize, &nextLinks](uint32_t fromWord, uint32_t toWord, uint32_t thread)
+    {
+        uint32_t amount = 0;
+        uint64_t links = 0;
+
+        for (uint32_t w = fromWord; w < toWord; w++)
+        {
+            uint64_t word = this->_frontier.getWord(w);
+
+            while (word != 0)
+            {
+                uint32_t u = w * AtomicBitSet::WORD_BITS + countTrailingZeros(word);
+                word &= word - 1;
+
+                for (auto link : this->_graph.getOutLinks(GraphNode(u)))
+                {
+                    uint32_t v = link.id;
+                    uint32_t expected = UNREACHED;
+
+                    // La lettura evita la CAS, e il traffico sulla linea di cache, per i nodi gia' visitati
+                    if (this->_claims[v].load(std::memory_order_relaxed) == UNREACHED &&
+                        this->_claims[v].compare_exchange_strong(expected, u, std::memory_order_relaxed))
+                    {
+                        this->_levels[v] = level + 1;
+                        this->_next.set(v);
+
+                        amount++;
+                        links += this->_outDegrees[v];
+                    }
+                }
+            }
+        }
+
+        nextSize.fetch_add(amount, std::memory_order_relaxed);
+        nextLinks.fetch_add(links, std::memory_order_relaxed);
+    });
+
+    frontierLinks = nextLinks.load();
+    return nextSize.load();
+}
+
+/**
+ * Passo bottom-up: ogni nodo non ancora visitato cerca un predecessore nella frontiera.
+ * I blocchi di lavoro sono allineati alle parole dell'insieme, quindi ogni nodo e ogni
+ * parola della nuova frontiera sono scritti da un solo thread.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param level : Livello della frontiera corrente
+ * @param frontierLinks : Archi uscenti dalla nuova frontiera
+ * @return Numero di nodi della nuova frontiera
+ */
+template <class TGraph>
+uint32_t ParallelBfs<TGraph>::_bottomUpStep(uint32_t level, uint64_t& frontierLinks)
+{
+    std::atomic<uint32_t> nextSize(0);
+    std::atomic<uint64_t> nextLinks(0);
+    uint32_t size = (uint32_t) this->_outDegrees.size();
+
+    this->_pool.parallelFor(0, this->_frontier.getWordAmount(), _GRAIN_WORDS, [this, level, size, &nextSize, &nextLinks](uint32_t fromWord, uint32_t toWord, uint32_t thread)
+    {
+        uint32_t amount = 0;
+        uint64_t links = 0;
+        uint32_t end = toWord * AtomicBitSet::WORD_BITS;
+
+        if (end > size)
+        {
+            end = size;
+        }
+
+        for (uint32_t v = fromWord * AtomicBitSet::WORD_BITS; v < end; v++)
+        {
+            if (this->_claims[v].load(std::memory_order_relaxed) != UNREACHED || !this->_graph.isNodeEnabled(GraphNode(v)))
+            {
+                continue;
+            }
+
+            for (auto link : this->_graph.getInLinks(GraphNode(v)))
+            {
+                if (this->_frontier.test(link.id))
+                {
+                    this->_claims[v].store(link.id, std::memory_order_relaxed);
+                    this->_levels[v] = level + 1;
+                    this->_next.set(v);
+
+                    amount++;
+                    links += this->_outDegrees[v];
+                    break;
+                }
+            }
+        }
+
+        nextSize.fetch_add(amount, std::memory_order_relaxed);
+        nextLinks.fetch_add(links, std::memory_order_relaxed);
+    });
+
+    frontierLinks = nextLinks.load();
+    return nextSize.load();
+}
+
+#endif // _PARALLELBFS_H
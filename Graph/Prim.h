@@ -0,0 +1,175 @@
+#ifndef _PRIM_H
+#define _PRIM_H
+
+#include "Graph.h"
+#include "SpanningForest.h"
+#include "../PriorityQueue/IndexedPriorityQueue.h"
+
+#include <vector>
+
+/**
+ * Motore per il calcolo della foresta ricoprente minima con l'algoritmo di Prim.
+ *
+ * Gli archi sono considerati non orientati: ogni nodo e' collegato sia ai successori sia
+ * ai predecessori. Partendo da un nodo non ancora coperto, l'albero cresce aggiungendo
+ * ogni volta l'arco minimo verso un nodo esterno; la coda con priorita' indicizzata
+ * contiene, per ogni nodo esterno adiacente all'albero, il miglior arco che lo raggiunge,
+ * aggiornato con decreaseKey. Esaurita la coda si riparte dal nodo successivo non
+ * coperto, cosi' che ogni componente connessa abbia il suo albero.
+ *
+ * Il costo e' O(E log V), con strutture riutilizzate fra un'esecuzione e l'altra.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+class Prim
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+        typedef SpanningLink<LinkWeight> Link;
+        typedef SpanningForest<LinkWeight> Forest;
+
+    private:
+        typedef IndexedPriorityQueue<Link> Queue;
+
+        const TGraph& _graph; // Grafo di cui calcolare la foresta
+        Queue _queue; // Miglior arco verso ogni nodo esterno adiacente all'albero
+        std::vector<typename Queue::Handle> _handles; // Handle nella coda di ogni nodo
+        std::vector<bool> _covered; // Se true, il nodo e' gia' in un albero
+        Forest _forest; // Foresta dell'ultima esecuzione
+
+    private:
+        void _cover(uint32_t node);
+        void _offer(uint32_t from, uint32_t to, LinkWeight weight);
+
+    public:
+        Prim(const TGraph& graph);
+
+        const Forest& run();
+        const Forest& getForest() const;
+};
+
+
+/**
+ * Crea un motore di Prim sul grafo dato, che deve sopravvivere al motore
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo di cui calcolare la foresta ricoprente minima
+ */
+template <class TGraph>
+Prim<TGraph>::Prim(const TGraph& graph) : _graph(graph) { }
+
+/**
+ * Calcola la foresta ricoprente minima del grafo.
+ * Il riferimento restituito resta valido fino all'esecuzione successiva.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Foresta ricoprente minima
+ */
+template <class TGraph>
+const typename Prim<TGraph>::Forest& Prim<TGraph>::run()
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+    uint32_t trees = 0;
+
+    this->_handles.assign(size, Queue::NULL_HANDLE);
+    this->_covered.assign(size, false);
+    this->_queue.clear();
+    this->_forest.clear();
+
+    for (uint32_t root = 0; root < size; root++)
+    {
+        if (this->_covered[root] || !this->_graph.isNodeEnabled(GraphNode(root)))
+        {
+            continue;
+        }
+
+        trees++;
+        this->_cover(root);
+
+        while (!this->_queue.isEmpty())
+        {
+            Link link = this->_queue.min();
+
+            this->_queue.deleteMin();
+            this->_handles[link.to] = Queue::NULL_HANDLE;
+            this->_forest.add(link);
+            this->_cover(link.to);
+        }
+    }
+
+    this->_forest.setTreeAmount(trees);
+
+    return this->_forest;
+}
+
+/**
+ * Restituisce la foresta dell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Foresta ricoprente minima
+ */
+template <class TGraph>
+const typename Prim<TGraph>::Forest& Prim<TGraph>::getForest() const
+{
+    return this->_forest;
+}
+
+
+/**
+ * Aggiunge node all'albero corrente e propone gli archi verso i suoi vicini esterni
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Id del nodo da aggiungere
+ */
+template <class TGraph>
+void Prim<TGraph>::_cover(uint32_t node)
+{
+    this->_covered[node] = true;
+
+    for (auto link : this->_graph.getOutLinks(GraphNode(node)))
+    {
+        this->_offer(node, link.id, link.weight);
+    }
+
+    for (auto link : this->_graph.getInLinks(GraphNode(node)))
+    {
+        this->_offer(node, link.id, link.weight);
+    }
+}
+
+/**
+ * Propone l'arco (from, to) per raggiungere il nodo esterno to: se to non e' in coda
+ * viene inserito, se l'arco e' migliore di quello in coda viene usato decreaseKey
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param from : Id del nodo dell'albero
+ * @param to : Id del nodo esterno
+ * @param weight : Peso dell'arco
+ */
+template <class TGraph>
+void Prim<TGraph>::_offer(uint32_t from, uint32_t to, LinkWeight weight)
+{
+    if (this->_covered[to])
+    {
+        return;
+    }
+
+    Link link;
+
+    link.from = from;
+    link.to = to;
+    link.weight = weight;
+
+    if (this->_handles[to] == Queue::NULL_HANDLE)
+    {
+        this->_handles[to] = this->_queue.push(link);
+    }
+
+    else if (link < this->_queue.get(this->_handles[to]))
+    {
+        this->_queue.decreaseKey(this->_handles[to], link);
+    }
+}
+
+#endif // _PRIM_H
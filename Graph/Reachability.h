@@ -0,0 +1,180 @@
+#ifndef _REACHABILITY_H
+#define _REACHABILITY_H
+
+#include "Graph.h"
+#include "../Lib/BitSet.h"
+
+#include <vector>
+
+/**
+ * Motore per il calcolo dell'insieme dei nodi raggiungibili da un nodo di partenza.
+ *
+ * Una sola visita in profondita' iterativa, con uno stack esplicito, segna in un BitSet
+ * tutti i nodi raggiungibili; le interrogazioni successive (ad esempio il filtro sui nodi
+ * con la stessa etichetta) leggono solo il BitSet. Il BitSet e lo stack vengono conservati
+ * fra una chiamata e l'altra, quindi molte interrogazioni consecutive non allocano memoria
+ * per i nodi visitati.
+ *
+ * @tparam TGraph : Tipo del grafo su cui calcolare la raggiungibilita'
+ */
+template <class TGraph>
+class Reachability
+{
+    public:
+        typedef typename TGraph::NodeLabel NodeLabel;
+        typedef LinkedList<uint32_t> GraphNodeList;
+
+    private:
+        const TGraph& _graph; // Grafo da visitare
+        BitSet _reached; // Nodi raggiunti nell'ultima esecuzione
+        std::vector<uint32_t> _stack; // Stack della visita
+
+    public:
+        Reachability(const TGraph& graph);
+
+        const BitSet& run(const GraphNode& start);
+        const BitSet& getReached() const;
+        bool isReachable(const GraphNode& node) const;
+
+        GraphNodeList getSameReachableNodes(const GraphNode& node);
+        void getSameReachableNodes(const std::vector<GraphNode>& nodes, std::vector<GraphNodeList>& results);
+};
+
+
+/**
+ * Crea un motore di raggiungibilita' sul grafo dato. Il grafo deve sopravvivere al motore.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo da visitare
+ */
+template <class TGraph>
+Reachability<TGraph>::Reachability(const TGraph& graph) : _graph(graph) { }
+
+/**
+ * Calcola l'insieme dei nodi raggiungibili da start, start compreso.
+ * Se start non esiste, l'insieme e' vuoto.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param start : Nodo di partenza
+ * @return Insieme dei nodi raggiunti, valido fino alla prossima esecuzione del motore
+ */
+template <class TGraph>
+const BitSet& Reachability<TGraph>::run(const GraphNode& start)
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+
+    if (this->_reached.getSize() != size)
+    {
+        this->_reached.resize(size);
+    }
+
+    else
+    {
+        this->_reached.clear();
+    }
+
+    this->_stack.clear();
+
+    if (!this->_graph.isNodeEnabled(start))
+    {
+        return this->_reached;
+    }
+
+    this->_reached.set(start.getId());
+    this->_stack.push_back(start.getId());
+
+    // Ogni nodo entra nello stack una sola volta, quando viene raggiunto per la prima volta
+    while (!this->_stack.empty())
+    {
+        uint32_t u = this->_stack.back();
+        this->_stack.pop_back();
+
+        for (auto link : this->_graph.getOutLinks(GraphNode(u)))
+        {
+            if (!this->_reached.testAndSet(link.id))
+            {
+                this->_stack.push_back(link.id);
+            }
+        }
+    }
+
+    return this->_reached;
+}
+
+/**
+ * Restituisce l'insieme dei nodi raggiunti nell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Insieme dei nodi raggiunti
+ */
+template <class TGraph>
+const BitSet& Reachability<TGraph>::getReached() const
+{
+    return this->_reached;
+}
+
+/**
+ * Restituisce true se node e' stato raggiunto nell'ultima esecuzione
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo da controllare
+ * @return True se node e' raggiungibile, altrimenti false
+ */
+template <class TGraph>
+bool Reachability<TGraph>::isReachable(const GraphNode& node) const
+{
+    return (node.getId() < this->_reached.getSize() && this->_reached.test(node.getId()));
+}
+
+/**
+ * Restituisce la lista dei nodi, diversi da node, raggiungibili da node e con la sua
+ * stessa etichetta, in ordine crescente di id
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo di partenza
+ * @return Lista dei nodi raggiungibili con la stessa etichetta
+ */
+template <class TGraph>
+typename Reachability<TGraph>::GraphNodeList Reachability<TGraph>::getSameReachableNodes(const GraphNode& node)
+{
+    GraphNodeList outList;
+    const BitSet& reached = this->run(node);
+
+    if (!this->_graph.isNodeEnabled(node))
+    {
+        return outList;
+    }
+
+    NodeLabel label = this->_graph.getLabel(node);
+
+    for (uint32_t i = reached.nextSet(0); i < reached.getSize(); i = reached.nextSet(i + 1))
+    {
+        if (i != node.getId() && this->_graph.getLabel(GraphNode(i)) == label)
+        {
+            outList.append(i);
+        }
+    }
+
+    return outList;
+}
+
+/**
+ * Calcola getSameReachableNodes per ogni nodo di nodes, riusando lo stesso BitSet e lo
+ * stesso stack per tutte le visite. results[i] conterra' la risposta per nodes[i].
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param nodes : Nodi di partenza
+ * @param results : Liste dei nodi raggiungibili con la stessa etichetta
+ */
+template <class TGraph>
+void Reachability<TGraph>::getSameReachableNodes(const std::vector<GraphNode>& nodes, std::vector<GraphNodeList>& results)
+{
+    results.resize(nodes.size());
+
+    for (std::size_t i = 0; i < nodes.size(); i++)
+    {
+        results[i] = this->getSameReachableNodes(nodes[i]);
+    }
+}
+
+#endif // _REACHABILITY_H
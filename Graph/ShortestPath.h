@@ -0,0 +1,190 @@
+#ifndef _SHORTESTPATH_H
+#define _SHORTESTPATH_H
+
+#include "../LinkedList/LinkedList.h"
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * Cammino minimo fra due nodi, prodotto dalle ricerche punto a punto (A*, Dijkstra
+ * bidirezionale). Contiene gli id dei nodi attraversati, sorgente e destinazione
+ * comprese, e il costo totale del cammino.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class ShortestPath
+{
+    private:
+        std::vector<uint32_t> _nodes; // Nodi del cammino, dalla sorgente alla destinazione
+        TLinkWeight _cost; // Somma dei pesi degli archi del cammino
+
+    public:
+        ShortestPath();
+
+        static TLinkWeight infinity();
+
+        bool isFound() const;
+        TLinkWeight getCost() const;
+        uint32_t getLength() const;
+        const std::vector<uint32_t>& getNodes() const;
+        LinkedList<uint32_t> getPath() const;
+
+        void clear();
+        void setCost(TLinkWeight cost);
+        void append(uint32_t node);
+        void reverse(std::size_t from);
+};
+
+
+/**
+ * Crea un cammino vuoto, cioe' non trovato
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+ShortestPath<TLinkWeight>::ShortestPath()
+{
+    this->_cost = infinity();
+}
+
+/**
+ * Restituisce il costo usato per i cammini non trovati
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Costo infinito
+ */
+template <class TLinkWeight>
+TLinkWeight ShortestPath<TLinkWeight>::infinity()
+{
+    return std::numeric_limits<TLinkWeight>::max();
+}
+
+/**
+ * Restituisce true se esiste un cammino dalla sorgente alla destinazione
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return True se il cammino e' stato trovato, altrimenti false
+ */
+template <class TLinkWeight>
+bool ShortestPath<TLinkWeight>::isFound() const
+{
+    return !this->_nodes.empty();
+}
+
+/**
+ * Restituisce il costo del cammino, oppure infinity() se il cammino non esiste
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Costo del cammino
+ */
+template <class TLinkWeight>
+TLinkWeight ShortestPath<TLinkWeight>::getCost() const
+{
+    return this->_cost;
+}
+
+/**
+ * Restituisce il numero di archi del cammino
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di archi, zero se il cammino non esiste
+ */
+template <class TLinkWeight>
+uint32_t ShortestPath<TLinkWeight>::getLength() const
+{
+    return this->_nodes.empty() ? 0 : (uint32_t) this->_nodes.size() - 1;
+}
+
+/**
+ * Restituisce i nodi del cammino, dalla sorgente alla destinazione
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Id dei nodi del cammino
+ */
+template <class TLinkWeight>
+const std::vector<uint32_t>& ShortestPath<TLinkWeight>::getNodes() const
+{
+    return this->_nodes;
+}
+
+/**
+ * Restituisce i nodi del cammino come lista, dalla sorgente alla destinazione
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Lista degli id dei nodi del cammino, vuota se il cammino non esiste
+ */
+template <class TLinkWeight>
+LinkedList<uint32_t> ShortestPath<TLinkWeight>::getPath() const
+{
+    LinkedList<uint32_t> path;
+
+    for (std::size_t i = 0; i < this->_nodes.size(); i++)
+    {
+        path.append(this->_nodes[i]);
+    }
+
+    return path;
+}
+
+/**
+ * Svuota il cammino, che risulta non trovato
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+void ShortestPath<TLinkWeight>::clear()
+{
+    this->_nodes.clear();
+    this->_cost = infinity();
+}
+
+/**
+ * Imposta il costo del cammino
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param cost : Costo del cammino
+ */
+template <class TLinkWeight>
+void ShortestPath<TLinkWeight>::setCost(TLinkWeight cost)
+{
+    this->_cost = cost;
+}
+
+/**
+ * Aggiunge un nodo in coda al cammino
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ */
+template <class TLinkWeight>
+void ShortestPath<TLinkWeight>::append(uint32_t node)
+{
+    this->_nodes.push_back(node);
+}
+
+/**
+ * Inverte l'ordine dei nodi dalla posizione from in poi. Serve a chi ricostruisce il
+ * cammino risalendo i padri, quindi dalla fine verso l'inizio.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param from : Posizione del primo nodo da invertire
+ */
+template <class TLinkWeight>
+void ShortestPath<TLinkWeight>::reverse(std::size_t from)
+{
+    std::size_t i = from;
+    std::size_t j = this->_nodes.size();
+
+    while (i + 1 < j)
+    {
+        j--;
+        std::swap(this->_nodes[i], this->_nodes[j]);
+        i++;
+    }
+}
+
+#endif // _SHORTESTPATH_H
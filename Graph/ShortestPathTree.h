@@ -0,0 +1,284 @@
+#ifndef _SHORTESTPATHTREE_H
+#define _SHORTESTPATHTREE_H
+
+#include "../LinkedList/LinkedList.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * Albero dei cammini minimi (shortest path tree) rappresentato con il vettore dei padri.
+ *
+ * Per ogni nodo i contiene la lunghezza del cammino minimo dalla sorgente ad i e il
+ * predecessore di i lungo quel cammino. Un nodo e' raggiungibile solo se e' stato
+ * definitivamente etichettato (settled) dall'algoritmo che ha prodotto l'albero.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class ShortestPathTree
+{
+    public:
+        static const uint32_t NO_PARENT = UINT32_MAX; // Padre della sorgente e dei nodi non raggiungibili
+
+    private:
+        uint32_t _source; // Nodo sorgente
+        std::vector<TLinkWeight> _distances; // Distanza di ogni nodo dalla sorgente
+        std::vector<uint32_t> _parents; // Padre di ogni nodo nell'albero
+        std::vector<bool> _settled; // Se true, la distanza del nodo e' definitiva
+
+    public:
+        ShortestPathTree();
+        ShortestPathTree(uint32_t size);
+
+        static TLinkWeight infinity();
+
+        uint32_t getSize() const;
+        uint32_t getSource() const;
+
+        bool isReachable(uint32_t node) const;
+        TLinkWeight getDistance(uint32_t node) const;
+        uint32_t getParent(uint32_t node) const;
+        LinkedList<uint32_t> getPath(uint32_t node) const;
+
+        void resize(uint32_t size);
+        void setSource(uint32_t source);
+        void setDistance(uint32_t node, TLinkWeight distance, uint32_t parent);
+        void settle(uint32_t node);
+        void reset(uint32_t node);
+        TLinkWeight getTentativeDistance(uint32_t node) const;
+        uint32_t getTentativeParent(uint32_t node) const;
+};
+
+template <class TLinkWeight>
+const uint32_t ShortestPathTree<TLinkWeight>::NO_PARENT;
+
+
+/**
+ * Crea un albero vuoto
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+ShortestPathTree<TLinkWeight>::ShortestPathTree() : ShortestPathTree(0) { }
+
+/**
+ * Crea un albero per un grafo con size nodi, in cui nessun nodo e' raggiungibile
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param size : Numero massimo di nodi del grafo
+ */
+template <class TLinkWeight>
+ShortestPathTree<TLinkWeight>::ShortestPathTree(uint32_t size)
+{
+    this->_source = NO_PARENT;
+    this->resize(size);
+}
+
+/**
+ * Restituisce il valore usato come distanza infinita
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Distanza infinita
+ */
+template <class TLinkWeight>
+TLinkWeight ShortestPathTree<TLinkWeight>::infinity()
+{
+    return std::numeric_limits<TLinkWeight>::max();
+}
+
+/**
+ * Restituisce il numero di nodi gestiti dall'albero
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di nodi
+ */
+template <class TLinkWeight>
+uint32_t ShortestPathTree<TLinkWeight>::getSize() const
+{
+    return (uint32_t) this->_distances.size();
+}
+
+/**
+ * Restituisce il nodo sorgente
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Id della sorgente
+ */
+template <class TLinkWeight>
+uint32_t ShortestPathTree<TLinkWeight>::getSource() const
+{
+    return this->_source;
+}
+
+/**
+ * Restituisce true se il nodo e' raggiungibile dalla sorgente e la sua distanza e' definitiva
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @return True se il nodo e' raggiungibile, altrimenti false
+ */
+template <class TLinkWeight>
+bool ShortestPathTree<TLinkWeight>::isReachable(uint32_t node) const
+{
+    return (node < this->_settled.size() && this->_settled[node]);
+}
+
+/**
+ * Restituisce la lunghezza del cammino minimo dalla sorgente al nodo,
+ * oppure infinity() se il nodo non e' raggiungibile.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @return Distanza dalla sorgente
+ */
+template <class TLinkWeight>
+TLinkWeight ShortestPathTree<TLinkWeight>::getDistance(uint32_t node) const
+{
+    if (!this->isReachable(node))
+    {
+        return infinity();
+    }
+
+    return this->_distances[node];
+}
+
+/**
+ * Restituisce il padre del nodo nell'albero, oppure NO_PARENT
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @return Id del padre
+ */
+template <class TLinkWeight>
+uint32_t ShortestPathTree<TLinkWeight>::getParent(uint32_t node) const
+{
+    if (!this->isReachable(node))
+    {
+        return NO_PARENT;
+    }
+
+    return this->_parents[node];
+}
+
+/**
+ * Restituisce la lista dei nodi del cammino minimo dalla sorgente al nodo.
+ * Se il nodo non e' raggiungibile, la lista e' vuota.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Nodo di arrivo
+ * @return Lista di id dei nodi del cammino, sorgente compresa
+ */
+template <class TLinkWeight>
+LinkedList<uint32_t> ShortestPathTree<TLinkWeight>::getPath(uint32_t node) const
+{
+    LinkedList<uint32_t> path;
+
+    if (!this->isReachable(node))
+    {
+        return path;
+    }
+
+    for (uint32_t current = node; current != NO_PARENT; current = this->_parents[current])
+    {
+        path.unshift(current);
+    }
+
+    return path;
+}
+
+/**
+ * Adatta l'albero ad un grafo con size nodi, rendendo tutti i nodi non raggiungibili
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param size : Numero massimo di nodi del grafo
+ */
+template <class TLinkWeight>
+void ShortestPathTree<TLinkWeight>::resize(uint32_t size)
+{
+    this->_distances.assign(size, infinity());
+    this->_parents.assign(size, NO_PARENT);
+    this->_settled.assign(size, false);
+}
+
+/**
+ * Imposta la sorgente dell'albero
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param source : Id della sorgente
+ */
+template <class TLinkWeight>
+void ShortestPathTree<TLinkWeight>::setSource(uint32_t source)
+{
+    this->_source = source;
+}
+
+/**
+ * Imposta la distanza provvisoria di un nodo e il suo padre
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @param distance : Distanza dalla sorgente
+ * @param parent : Id del padre
+ */
+template <class TLinkWeight>
+void ShortestPathTree<TLinkWeight>::setDistance(uint32_t node, TLinkWeight distance, uint32_t parent)
+{
+    this->_distances[node] = distance;
+    this->_parents[node] = parent;
+}
+
+/**
+ * Rende definitiva la distanza di un nodo
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ */
+template <class TLinkWeight>
+void ShortestPathTree<TLinkWeight>::settle(uint32_t node)
+{
+    this->_settled[node] = true;
+}
+
+/**
+ * Rende nuovamente non raggiungibile un nodo
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ */
+template <class TLinkWeight>
+void ShortestPathTree<TLinkWeight>::reset(uint32_t node)
+{
+    this->_distances[node] = infinity();
+    this->_parents[node] = NO_PARENT;
+    this->_settled[node] = false;
+}
+
+/**
+ * Restituisce la distanza provvisoria di un nodo, anche se non ancora definitiva
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @return Distanza provvisoria dalla sorgente
+ */
+template <class TLinkWeight>
+TLinkWeight ShortestPathTree<TLinkWeight>::getTentativeDistance(uint32_t node) const
+{
+    return this->_distances[node];
+}
+
+/**
+ * Restituisce il padre provvisorio di un nodo, anche se la sua distanza non e' ancora definitiva
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param node : Id del nodo
+ * @return Id del padre provvisorio, oppure NO_PARENT
+ */
+template <class TLinkWeight>
+uint32_t ShortestPathTree<TLinkWeight>::getTentativeParent(uint32_t node) const
+{
+    return this->_parents[node];
+}
+
+#endif // _SHORTESTPATHTREE_H
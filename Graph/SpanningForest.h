@@ -0,0 +1,207 @@
+#ifndef _SPANNINGFOREST_H
+#define _SPANNINGFOREST_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Arco di una foresta ricoprente, considerato non orientato.
+ *
+ * Gli archi sono ordinati per peso e, a parita' di peso, per estremo minore e poi per
+ * estremo maggiore: e' un ordine totale sugli archi fra nodi distinti, quindi la foresta
+ * ricoprente minima rispetto a questo ordine e' unica e Prim, Kruskal e Boruvka la
+ * trovano identica.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class SpanningLink
+{
+    public:
+        uint32_t from; // Id del primo estremo
+        uint32_t to; // Id del secondo estremo
+        TLinkWeight weight; // Peso dell'arco
+
+    public:
+        uint32_t getLower() const;
+        uint32_t getUpper() const;
+
+        bool operator<(const SpanningLink<TLinkWeight>& link) const;
+};
+
+/**
+ * Restituisce l'estremo di id minore
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Id dell'estremo minore
+ */
+template <class TLinkWeight>
+uint32_t SpanningLink<TLinkWeight>::getLower() const
+{
+    return (this->from < this->to) ? this->from : this->to;
+}
+
+/**
+ * Restituisce l'estremo di id maggiore
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Id dell'estremo maggiore
+ */
+template <class TLinkWeight>
+uint32_t SpanningLink<TLinkWeight>::getUpper() const
+{
+    return (this->from < this->to) ? this->to : this->from;
+}
+
+/**
+ * Confronta due archi per peso, estremo minore ed estremo maggiore
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param link : Arco da confrontare
+ * @return True se l'arco precede link, altrimenti false
+ */
+template <class TLinkWeight>
+bool SpanningLink<TLinkWeight>::operator<(const SpanningLink<TLinkWeight>& link) const
+{
+    if (this->weight < link.weight || link.weight < this->weight)
+    {
+        return this->weight < link.weight;
+    }
+
+    if (this->getLower() != link.getLower())
+    {
+        return this->getLower() < link.getLower();
+    }
+
+    return this->getUpper() < link.getUpper();
+}
+
+
+/**
+ * Foresta ricoprente minima prodotta da Prim, Kruskal e Boruvka: un albero per ogni
+ * componente connessa del grafo, con gli archi considerati non orientati.
+ * Contiene gli archi scelti e il loro peso totale.
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+class SpanningForest
+{
+    private:
+        std::vector< SpanningLink<TLinkWeight> > _links; // Archi della foresta
+        TLinkWeight _weight; // Somma dei pesi degli archi
+        uint32_t _treeAmount; // Numero di alberi, cioe' di componenti connesse
+
+    public:
+        SpanningForest();
+
+        const std::vector< SpanningLink<TLinkWeight> >& getLinks() const;
+        uint32_t getLinkAmount() const;
+        TLinkWeight getWeight() const;
+        uint32_t getTreeAmount() const;
+
+        void clear();
+        void add(const SpanningLink<TLinkWeight>& link);
+        void setTreeAmount(uint32_t amount);
+};
+
+
+/**
+ * Crea una foresta vuota
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+SpanningForest<TLinkWeight>::SpanningForest()
+{
+    this->clear();
+}
+
+/**
+ * Restituisce gli archi della foresta, nell'ordine in cui sono stati scelti
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Archi della foresta
+ */
+template <class TLinkWeight>
+const std::vector< SpanningLink<TLinkWeight> >& SpanningForest<TLinkWeight>::getLinks() const
+{
+    return this->_links;
+}
+
+/**
+ * Restituisce il numero di archi della foresta
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di archi
+ */
+template <class TLinkWeight>
+uint32_t SpanningForest<TLinkWeight>::getLinkAmount() const
+{
+    return (uint32_t) this->_links.size();
+}
+
+/**
+ * Restituisce la somma dei pesi degli archi della foresta
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Peso totale
+ */
+template <class TLinkWeight>
+TLinkWeight SpanningForest<TLinkWeight>::getWeight() const
+{
+    return this->_weight;
+}
+
+/**
+ * Restituisce il numero di alberi della foresta, cioe' di componenti connesse del grafo
+ * (considerato non orientato); un nodo isolato e' un albero senza archi
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @return Numero di alberi
+ */
+template <class TLinkWeight>
+uint32_t SpanningForest<TLinkWeight>::getTreeAmount() const
+{
+    return this->_treeAmount;
+}
+
+/**
+ * Svuota la foresta
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ */
+template <class TLinkWeight>
+void SpanningForest<TLinkWeight>::clear()
+{
+    this->_links.clear();
+    this->_weight = TLinkWeight();
+    this->_treeAmount = 0;
+}
+
+/**
+ * Aggiunge un arco alla foresta
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param link : Arco da aggiungere
+ */
+template <class TLinkWeight>
+void SpanningForest<TLinkWeight>::add(const SpanningLink<TLinkWeight>& link)
+{
+    this->_links.push_back(link);
+    this->_weight = this->_weight + link.weight;
+}
+
+/**
+ * Imposta il numero di alberi della foresta
+ *
+ * @tparam TLinkWeight : Tipo del peso dell'arco
+ * @param amount : Numero di alberi
+ */
+template <class TLinkWeight>
+void SpanningForest<TLinkWeight>::setTreeAmount(uint32_t amount)
+{
+    this->_treeAmount = amount;
+}
+
+#endif // _SPANNINGFOREST_H
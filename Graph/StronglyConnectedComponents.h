@@ -0,0 +1,351 @@
+#ifndef _STRONGLYCONNECTEDCOMPONENTS_H
+#define _STRONGLYCONNECTEDCOMPONENTS_H
+
+#include "Graph.h"
+#include "../Lib/BitSet.h"
+
+#include <utility>
+#include <vector>
+
+/**
+ * Motore per il calcolo delle componenti fortemente connesse di un grafo orientato con
+ * l'algoritmo di Tarjan, in tempo O(V + E).
+ *
+ * La visita in profondita' e' iterativa: al posto della ricorsione usa uno stack esplicito
+ * di frame, ognuno con il nodo e la posizione raggiunta fra i suoi archi uscenti, quindi
+ * anche grafi con molti nodi non esauriscono lo stack del thread.
+ *
+ * Le componenti sono numerate in ordine topologico del grafo condensato: se esiste un
+ * arco da un nodo della componente a ad un nodo della componente b diversa da a, allora
+ * a < b. Dopo run(), sapere se due nodi sono mutuamente raggiungibili costa O(1).
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+class StronglyConnectedComponents
+{
+    public:
+        typedef typename TGraph::LinkWeight LinkWeight;
+        typedef LinkedList<uint32_t> GraphNodeList;
+        typedef Graph<uint32_t, LinkWeight> CondensationGraph;
+
+        static const uint32_t NO_COMPONENT = UINT32_MAX; // Componente dei nodi inesistenti
+
+    private:
+        typedef decltype(std::declval<const TGraph&>().getOutLinks(GraphNode()).begin()) LinkIterator;
+
+        /**
+         * Frame della visita in profondita': nodo visitato e prossimo arco da esaminare
+         */
+        class Frame
+        {
+            public:
+                uint32_t node; // Nodo visitato
+                LinkIterator next; // Prossimo arco uscente da esaminare
+                LinkIterator end; // Fine degli archi uscenti
+        };
+
+        const TGraph& _graph; // Grafo di cui calcolare le componenti
+        std::vector<uint32_t> _component; // Componente di ogni nodo
+        std::vector<uint32_t> _componentSizes; // Numero di nodi di ogni componente
+
+    public:
+        StronglyConnectedComponents(const TGraph& graph);
+
+        void run();
+
+        uint32_t getComponentAmount() const;
+        uint32_t getComponent(const GraphNode& node) const;
+        uint32_t getComponentSize(uint32_t component) const;
+        GraphNodeList getComponentNodes(uint32_t component) const;
+
+        bool isStronglyConnected(const GraphNode& from, const GraphNode& to) const;
+
+        CondensationGraph* buildCondensation() const;
+};
+
+template <class TGraph>
+const uint32_t StronglyConnectedComponents<TGraph>::NO_COMPONENT;
+
+
+/**
+ * Crea un motore per le componenti fortemente connesse del grafo dato e le calcola.
+ * Il grafo deve sopravvivere al motore; se viene modificato, bisogna chiamare di nuovo run().
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param graph : Grafo di cui calcolare le componenti
+ */
+template <class TGraph>
+StronglyConnectedComponents<TGraph>::StronglyConnectedComponents(const TGraph& graph) : _graph(graph)
+{
+    this->run();
+}
+
+/**
+ * Calcola le componenti fortemente connesse con l'algoritmo di Tarjan.
+ *
+ * Ogni nodo riceve un indice in ordine di scoperta e un lowlink, il piu' piccolo indice
+ * raggiungibile dal suo sottoalbero restando nei nodi ancora sullo stack di Tarjan.
+ * Quando un nodo termina con lowlink uguale al suo indice e' la radice di una componente,
+ * formata dai nodi sopra di lui nello stack di Tarjan.
+ *
+ * @tparam TGraph : Tipo del grafo
+ */
+template <class TGraph>
+void StronglyConnectedComponents<TGraph>::run()
+{
+    uint32_t size = this->_graph.getMaxNodeAmount();
+
+    std::vector<uint32_t> index(size, NO_COMPONENT); // Ordine di scoperta di ogni nodo
+    std::vector<uint32_t> lowLink(size, 0); // Lowlink di ogni nodo
+    BitSet onStack(size); // Nodi presenti nello stack di Tarjan
+    std::vector<uint32_t> tarjanStack;
+    std::vector<Frame> callStack;
+    uint32_t nextIndex = 0;
+
+    this->_component.assign(size, NO_COMPONENT);
+    this->_componentSizes.clear();
+
+    for (uint32_t root = 0; root < size; root++)
+    {
+        if (index[root] != NO_COMPONENT || !this->_graph.isNodeEnabled(GraphNode(root)))
+        {
+            continue;
+        }
+
+        auto links = this->_graph.getOutLinks(GraphNode(root));
+        callStack.push_back(Frame{ root, links.begin(), links.end() });
+
+        index[root] = lowLink[root] = nextIndex++;
+        tarjanStack.push_back(root);
+        onStack.set(root);
+
+        while (!callStack.empty())
+        {
+            Frame& top = callStack.back();
+            uint32_t u = top.node;
+
+            if (top.next != top.end)
+            {
+                uint32_t v = (*top.next).id;
+                ++top.next;
+
+                if (index[v] == NO_COMPONENT)
+                {
+                    // Scendo in v: il frame di u verra' ripreso quando v termina
+                    auto vLinks = this->_graph.getOutLinks(GraphNode(v));
+
+                    index[v] = lowLink[v] = nextIndex++;
+                    tarjanStack.push_back(v);
+                    onStack.set(v);
+
+                    callStack.push_back(Frame{ v, vLinks.begin(), vLinks.end() });
+                }
+
+                else if (onStack.test(v) && index[v] < lowLink[u])
+                {
+                    lowLink[u] = index[v];
+                }
+
+                continue;
+            }
+
+            // Tutti gli archi di u sono stati esaminati
+            callStack.pop_back();
+
+            if (lowLink[u] == index[u])
+            {
+                uint32_t component = (uint32_t) this->_componentSizes.size();
+                uint32_t amount = 0;
+                uint32_t w;
+
+                do
+                {
+                    w = tarjanStack.back();
+                    tarjanStack.pop_back();
+                    onStack.reset(w);
+
+                    this->_component[w] = component;
+                    amount++;
+                } while (w != u);
+
+                this->_componentSizes.push_back(amount);
+            }
+
+            if (!callStack.empty())
+            {
+                uint32_t parent = callStack.back().node;
+
+                if (lowLink[u] < lowLink[parent])
+                {
+                    lowLink[parent] = lowLink[u];
+                }
+            }
+        }
+    }
+
+    // Tarjan chiude le componenti in ordine topologico inverso: rinumero al contrario
+    uint32_t amount = (uint32_t) this->_componentSizes.size();
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        if (this->_component[i] != NO_COMPONENT)
+        {
+            this->_component[i] = amount - 1 - this->_component[i];
+        }
+    }
+
+    for (uint32_t i = 0; i < amount / 2; i++)
+    {
+        uint32_t swap = this->_componentSizes[i];
+
+        this->_componentSizes[i] = this->_componentSizes[amount - 1 - i];
+        this->_componentSizes[amount - 1 - i] = swap;
+    }
+}
+
+/**
+ * Restituisce il numero di componenti fortemente connesse
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Numero di componenti
+ */
+template <class TGraph>
+uint32_t StronglyConnectedComponents<TGraph>::getComponentAmount() const
+{
+    return (uint32_t) this->_componentSizes.size();
+}
+
+/**
+ * Restituisce la componente di un nodo, oppure NO_COMPONENT se il nodo non esiste
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param node : Nodo
+ * @return Id della componente
+ */
+template <class TGraph>
+uint32_t StronglyConnectedComponents<TGraph>::getComponent(const GraphNode& node) const
+{
+    if (node.getId() >= this->_component.size())
+    {
+        return NO_COMPONENT;
+    }
+
+    return this->_component[node.getId()];
+}
+
+/**
+ * Restituisce il numero di nodi di una componente
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param component : Id della componente
+ * @return Numero di nodi, oppure 0 se la componente non esiste
+ */
+template <class TGraph>
+uint32_t StronglyConnectedComponents<TGraph>::getComponentSize(uint32_t component) const
+{
+    if (component >= this->_componentSizes.size())
+    {
+        return 0;
+    }
+
+    return this->_componentSizes[component];
+}
+
+/**
+ * Restituisce la lista dei nodi di una componente, in ordine crescente di id
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param component : Id della componente
+ * @return Lista dei nodi della componente
+ */
+template <class TGraph>
+typename StronglyConnectedComponents<TGraph>::GraphNodeList StronglyConnectedComponents<TGraph>::getComponentNodes(uint32_t component) const
+{
+    GraphNodeList nodes;
+
+    for (uint32_t i = 0; i < this->_component.size(); i++)
+    {
+        if (this->_component[i] == component)
+        {
+            nodes.append(i);
+        }
+    }
+
+    return nodes;
+}
+
+/**
+ * Restituisce true se from e to sono mutuamente raggiungibili, cioe' appartengono
+ * alla stessa componente fortemente connessa
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @param from : Primo nodo
+ * @param to : Secondo nodo
+ * @return True se i nodi sono mutuamente raggiungibili, altrimenti false
+ */
+template <class TGraph>
+bool StronglyConnectedComponents<TGraph>::isStronglyConnected(const GraphNode& from, const GraphNode& to) const
+{
+    uint32_t component = this->getComponent(from);
+    return (component != NO_COMPONENT && component == this->getComponent(to));
+}
+
+/**
+ * Costruisce il grafo condensato: un nodo per ogni componente, con id pari all'id della
+ * componente ed etichetta pari al numero dei suoi nodi, e un arco fra due componenti se
+ * nel grafo originale esiste almeno un arco fra loro. Il peso dell'arco e' il minimo fra
+ * i pesi di questi archi. Il grafo condensato e' aciclico.
+ *
+ * Il grafo restituito e' allocato dinamicamente e deve essere deallocato dal chiamante.
+ *
+ * @tparam TGraph : Tipo del grafo
+ * @return Grafo condensato
+ */
+template <class TGraph>
+typename StronglyConnectedComponents<TGraph>::CondensationGraph* StronglyConnectedComponents<TGraph>::buildCondensation() const
+{
+    uint32_t amount = this->getComponentAmount();
+    CondensationGraph* condensation = new CondensationGraph(amount);
+    std::vector<GraphNode> nodes(amount);
+
+    // In un grafo vuoto i nodi ricevono gli id in ordine crescente
+    for (uint32_t i = 0; i < amount; i++)
+    {
+        condensation->addNode(nodes[i], this->_componentSizes[i]);
+    }
+
+    for (uint32_t u = 0; u < this->_component.size(); u++)
+    {
+        uint32_t from = this->_component[u];
+
+        if (from == NO_COMPONENT)
+        {
+            continue;
+        }
+
+        for (auto link : this->_graph.getOutLinks(GraphNode(u)))
+        {
+            uint32_t to = this->_component[link.id];
+
+            if (from == to)
+            {
+                continue;
+            }
+
+            if (!condensation->isLinkActive(nodes[from], nodes[to]))
+            {
+                condensation->addLink(nodes[from], nodes[to], link.weight);
+            }
+
+            else if (link.weight < condensation->getWeight(nodes[from], nodes[to]))
+            {
+                condensation->setWeight(nodes[from], nodes[to], link.weight);
+            }
+        }
+    }
+
+    return condensation;
+}
+
+#endif // _STRONGLYCONNECTEDCOMPONENTS_H
@@ -0,0 +1,198 @@
+#ifndef _ATOMICBITSET_H
+#define _ATOMICBITSET_H
+
+#include "Bits.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Insieme di interi compresi fra 0 e size - 1, memorizzato come vettore di bit, in cui
+ * piu' thread possono aggiungere elementi contemporaneamente.
+ *
+ * Ha la stessa rappresentazione del BitSet, ma le parole sono atomiche e set() usa un
+ * OR atomico, quindi due thread che aggiungono elementi della stessa parola non perdono
+ * bit. Le operazioni usano l'ordinamento rilassato: la visibilita' fra thread diversi
+ * va garantita dalla sincronizzazione esterna, ad esempio la fine di ThreadPool::run().
+ */
+class AtomicBitSet
+{
+    public:
+        static const uint32_t WORD_BITS = 64U; // Numero di bit in una parola
+
+    private:
+        std::vector< std::atomic<uint64_t> > _words; // Parole che contengono i bit
+        uint32_t _size; // Numero di bit dell'insieme
+
+    public:
+        AtomicBitSet();
+        AtomicBitSet(uint32_t size);
+
+        uint32_t getSize() const;
+        uint32_t getWordAmount() const;
+        uint64_t getWord(uint32_t wordIndex) const;
+
+        bool test(uint32_t index) const;
+        void set(uint32_t index);
+        bool testAndSet(uint32_t index);
+
+        void clear();
+        void clear(uint32_t fromWord, uint32_t toWord);
+        void resize(uint32_t size);
+        uint32_t count() const;
+
+        void swap(AtomicBitSet& other);
+};
+
+
+/**
+ * Crea un insieme vuoto di dimensione zero
+ */
+inline AtomicBitSet::AtomicBitSet() : AtomicBitSet(0) { }
+
+/**
+ * Crea un insieme vuoto che puo' contenere gli interi da 0 a size - 1
+ *
+ * @param size : Numero di bit
+ */
+inline AtomicBitSet::AtomicBitSet(uint32_t size)
+{
+    this->resize(size);
+}
+
+/**
+ * Restituisce il numero di bit dell'insieme
+ *
+ * @return Numero di bit
+ */
+inline uint32_t AtomicBitSet::getSize() const
+{
+    return this->_size;
+}
+
+/**
+ * Restituisce il numero di parole a 64 bit usate dall'insieme
+ *
+ * @return Numero di parole
+ */
+inline uint32_t AtomicBitSet::getWordAmount() const
+{
+    return (uint32_t) this->_words.size();
+}
+
+/**
+ * Restituisce una parola dell'insieme, per scorrere 64 elementi alla volta
+ *
+ * @param wordIndex : Indice della parola
+ * @return Parola
+ */
+inline uint64_t AtomicBitSet::getWord(uint32_t wordIndex) const
+{
+    return this->_words[wordIndex].load(std::memory_order_relaxed);
+}
+
+/**
+ * Restituisce true se index appartiene all'insieme
+ *
+ * @param index : Elemento da controllare
+ * @return True se index e' presente, altrimenti false
+ */
+inline bool AtomicBitSet::test(uint32_t index) const
+{
+    return (this->getWord(index / WORD_BITS) >> (index % WORD_BITS)) & 1ULL;
+}
+
+/**
+ * Aggiunge index all'insieme
+ *
+ * @param index : Elemento da aggiungere
+ */
+inline void AtomicBitSet::set(uint32_t index)
+{
+    this->_words[index / WORD_BITS].fetch_or(1ULL << (index % WORD_BITS), std::memory_order_relaxed);
+}
+
+/**
+ * Aggiunge index all'insieme e restituisce true se era gia' presente.
+ * Se piu' thread aggiungono lo stesso elemento, solo uno riceve false.
+ *
+ * @param index : Elemento da aggiungere
+ * @return True se index era gia' presente, altrimenti false
+ */
+inline bool AtomicBitSet::testAndSet(uint32_t index)
+{
+    uint64_t bit = 1ULL << (index % WORD_BITS);
+    return (this->_words[index / WORD_BITS].fetch_or(bit, std::memory_order_relaxed) & bit) != 0;
+}
+
+/**
+ * Svuota l'insieme, mantenendone la dimensione
+ */
+inline void AtomicBitSet::clear()
+{
+    this->clear(0, this->getWordAmount());
+}
+
+/**
+ * Azzera le parole comprese fra fromWord (inclusa) e toWord (esclusa), cosi' che piu'
+ * thread possano svuotare parti diverse dell'insieme
+ *
+ * @param fromWord : Prima parola da azzerare
+ * @param toWord : Parola successiva all'ultima da azzerare
+ */
+inline void AtomicBitSet::clear(uint32_t fromWord, uint32_t toWord)
+{
+    for (uint32_t i = fromWord; i < toWord; i++)
+    {
+        this->_words[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Cambia la dimensione dell'insieme e lo svuota
+ *
+ * @param size : Nuovo numero di bit
+ */
+inline void AtomicBitSet::resize(uint32_t size)
+{
+    // Gli atomici non si possono copiare: costruisco un nuovo vettore e lo scambio
+    std::vector< std::atomic<uint64_t> > words((size + WORD_BITS - 1) / WORD_BITS);
+
+    this->_words.swap(words);
+    this->_size = size;
+    this->clear();
+}
+
+/**
+ * Restituisce il numero di elementi presenti nell'insieme
+ *
+ * @return Numero di bit a 1
+ */
+inline uint32_t AtomicBitSet::count() const
+{
+    uint32_t amount = 0;
+
+    for (uint32_t i = 0; i < this->getWordAmount(); i++)
+    {
+        amount += popCount(this->getWord(i));
+    }
+
+    return amount;
+}
+
+/**
+ * Scambia in tempo costante il contenuto dell'insieme con quello di other
+ *
+ * @param other : Insieme da scambiare
+ */
+inline void AtomicBitSet::swap(AtomicBitSet& other)
+{
+    uint32_t size = this->_size;
+
+    this->_words.swap(other._words);
+    this->_size = other._size;
+    other._size = size;
+}
+
+#endif // _ATOMICBITSET_H
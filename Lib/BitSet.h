@@ -0,0 +1,224 @@
+#ifndef _BITSET_H
+#define _BITSET_H
+
+#include "Bits.h"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Insieme di interi compresi fra 0 e size - 1, memorizzato come vettore di bit.
+ *
+ * Ogni parola a 64 bit contiene 64 elementi, quindi l'insieme di tutti i nodi di un grafo
+ * con un milione di nodi occupa 125 KB. L'iterazione sugli elementi presenti salta le
+ * parole nulle e usa countTrailingZeros per trovare il bit successivo.
+ */
+class BitSet
+{
+    public:
+        static const uint32_t WORD_BITS = 64U; // Numero di bit in una parola
+
+    private:
+        std::vector<uint64_t> _words; // Parole che contengono i bit
+        uint32_t _size; // Numero di bit dell'insieme
+
+    public:
+        BitSet();
+        BitSet(uint32_t size);
+
+        uint32_t getSize() const;
+        uint32_t getWordAmount() const;
+
+        bool test(uint32_t index) const;
+        void set(uint32_t index);
+        void reset(uint32_t index);
+        bool testAndSet(uint32_t index);
+
+        void clear();
+        void resize(uint32_t size);
+        uint32_t count() const;
+        uint32_t nextSet(uint32_t index) const;
+
+        uint64_t* getWords();
+        const uint64_t* getWords() const;
+};
+
+
+/**
+ * Crea un insieme vuoto di dimensione zero
+ */
+inline BitSet::BitSet() : BitSet(0) { }
+
+/**
+ * Crea un insieme vuoto che puo' contenere gli interi da 0 a size - 1
+ *
+ * @param size : Numero di bit
+ */
+inline BitSet::BitSet(uint32_t size)
+{
+    this->resize(size);
+}
+
+/**
+ * Restituisce il numero di bit dell'insieme
+ *
+ * @return Numero di bit
+ */
+inline uint32_t BitSet::getSize() const
+{
+    return this->_size;
+}
+
+/**
+ * Restituisce il numero di parole a 64 bit usate dall'insieme
+ *
+ * @return Numero di parole
+ */
+inline uint32_t BitSet::getWordAmount() const
+{
+    return (uint32_t) this->_words.size();
+}
+
+/**
+ * Restituisce true se index appartiene all'insieme
+ *
+ * @param index : Elemento da controllare
+ * @return True se index e' presente, altrimenti false
+ */
+inline bool BitSet::test(uint32_t index) const
+{
+    return (this->_words[index / WORD_BITS] >> (index % WORD_BITS)) & 1ULL;
+}
+
+/**
+ * Aggiunge index all'insieme
+ *
+ * @param index : Elemento da aggiungere
+ */
+inline void BitSet::set(uint32_t index)
+{
+    this->_words[index / WORD_BITS] |= (1ULL << (index % WORD_BITS));
+}
+
+/**
+ * Toglie index dall'insieme
+ *
+ * @param index : Elemento da togliere
+ */
+inline void BitSet::reset(uint32_t index)
+{
+    this->_words[index / WORD_BITS] &= ~(1ULL << (index % WORD_BITS));
+}
+
+/**
+ * Aggiunge index all'insieme e restituisce true se era gia' presente
+ *
+ * @param index : Elemento da aggiungere
+ * @return True se index era gia' presente, altrimenti false
+ */
+inline bool BitSet::testAndSet(uint32_t index)
+{
+    uint64_t& word = this->_words[index / WORD_BITS];
+    uint64_t bit = 1ULL << (index % WORD_BITS);
+    bool wasSet = (word & bit) != 0;
+
+    word |= bit;
+
+    return wasSet;
+}
+
+/**
+ * Svuota l'insieme, mantenendone la dimensione
+ */
+inline void BitSet::clear()
+{
+    for (std::size_t i = 0; i < this->_words.size(); i++)
+    {
+        this->_words[i] = 0;
+    }
+}
+
+/**
+ * Cambia la dimensione dell'insieme e lo svuota
+ *
+ * @param size : Nuovo numero di bit
+ */
+inline void BitSet::resize(uint32_t size)
+{
+    this->_size = size;
+    this->_words.assign((size + WORD_BITS - 1) / WORD_BITS, 0);
+}
+
+/**
+ * Restituisce il numero di elementi presenti nell'insieme
+ *
+ * @return Numero di bit a 1
+ */
+inline uint32_t BitSet::count() const
+{
+    uint32_t amount = 0;
+
+    for (std::size_t i = 0; i < this->_words.size(); i++)
+    {
+        amount += popCount(this->_words[i]);
+    }
+
+    return amount;
+}
+
+/**
+ * Restituisce il piu' piccolo elemento dell'insieme maggiore o uguale a index,
+ * oppure getSize() se non esiste. Permette di scorrere gli elementi con
+ *
+ *     for (uint32_t i = set.nextSet(0); i < set.getSize(); i = set.nextSet(i + 1))
+ *
+ * @param index : Primo elemento da considerare
+ * @return Elemento successivo, oppure getSize()
+ */
+inline uint32_t BitSet::nextSet(uint32_t index) const
+{
+    if (index >= this->_size)
+    {
+        return this->_size;
+    }
+
+    uint32_t wordIndex = index / WORD_BITS;
+    uint64_t word = this->_words[wordIndex] & (~0ULL << (index % WORD_BITS));
+
+    while (word == 0)
+    {
+        wordIndex++;
+
+        if (wordIndex == this->_words.size())
+        {
+            return this->_size;
+        }
+
+        word = this->_words[wordIndex];
+    }
+
+    return wordIndex * WORD_BITS + countTrailingZeros(word);
+}
+
+/**
+ * Restituisce le parole dell'insieme, per operazioni su 64 elementi alla volta.
+ * I bit oltre getSize() nell'ultima parola devono restare a zero.
+ *
+ * @return Puntatore alla prima parola
+ */
+inline uint64_t* BitSet::getWords()
+{
+    return this->_words.data();
+}
+
+/**
+ * Restituisce le parole dell'insieme
+ *
+ * @return Puntatore alla prima parola
+ */
+inline const uint64_t* BitSet::getWords() const
+{
+    return this->_words.data();
+}
+
+#endif // _BITSET_H
@@ -0,0 +1,55 @@
+#ifndef _BITS_H
+#define _BITS_H
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * Restituisce la posizione del bit a 1 meno significativo di value.
+ * value deve essere diverso da zero.
+ *
+ * @param value : Valore da esaminare
+ * @return Numero di zeri finali
+ */
+inline uint32_t countTrailingZeros(uint64_t value)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return (uint32_t) index;
+#elif defined(_MSC_VER)
+    unsigned long index;
+
+    if (_BitScanForward(&index, (unsigned long) value))
+    {
+        return (uint32_t) index;
+    }
+
+    _BitScanForward(&index, (unsigned long) (value >> 32));
+    return (uint32_t) index + 32;
+#else
+    return (uint32_t) __builtin_ctzll(value);
+#endif
+}
+
+/**
+ * Restituisce il numero di bit a 1 di value
+ *
+ * @param value : Valore da esaminare
+ * @return Numero di bit a 1
+ */
+inline uint32_t popCount(uint64_t value)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    return (uint32_t) __popcnt64(value);
+#elif defined(_MSC_VER)
+    return (uint32_t) (__popcnt((unsigned int) value) + __popcnt((unsigned int) (value >> 32)));
+#else
+    return (uint32_t) __builtin_popcountll(value);
+#endif
+}
+
+#endif // _BITS_H
@@ -0,0 +1,180 @@
+#ifndef _MAPPEDFILE_H
+#define _MAPPEDFILE_H
+
+#include <cstdint>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MAPPED_FILE_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * File mappato in memoria in sola lettura. Il contenuto non viene copiato: le pagine
+ * vengono caricate dal sistema operativo al primo accesso e condivise con la page cache,
+ * quindi aprire un file anche di molti gigabyte costa pochi microsecondi e piu' processi
+ * che mappano lo stesso file ne condividono la memoria.
+ *
+ * La mappatura resta valida fino a close() o alla distruzione dell'oggetto, anche se il
+ * file viene cancellato nel frattempo; non va pero' troncato finche' e' mappato.
+ * Disponibile solo sui sistemi POSIX: altrove open() fallisce sempre.
+ */
+class MappedFile
+{
+    private:
+        const uint8_t* _data; // Inizio della mappatura, nullptr se il file e' vuoto o non aperto
+        uint64_t _size; // Dimensione del file in byte
+        bool _open; // Se true, un file e' aperto
+
+    public:
+        MappedFile();
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool open(const std::string& path);
+        void close();
+        void prefetch() const;
+
+        bool isOpen() const;
+        const uint8_t* getData() const;
+        uint64_t getSize() const;
+};
+
+
+/**
+ * Crea un oggetto senza file aperto
+ */
+inline MappedFile::MappedFile()
+{
+    this->_data = nullptr;
+    this->_size = 0;
+    this->_open = false;
+}
+
+/**
+ * Rilascia la mappatura, se presente
+ */
+inline MappedFile::~MappedFile()
+{
+    this->close();
+}
+
+/**
+ * Mappa in memoria il file, chiudendo quello eventualmente gia' aperto. Il descrittore
+ * del file viene chiuso subito: la mappatura non ne ha bisogno.
+ *
+ * @param path : Percorso del file
+ * @return True se il file e' stato mappato, altrimenti false
+ */
+inline bool MappedFile::open(const std::string& path)
+{
+    this->close();
+
+#ifdef MAPPED_FILE_POSIX
+    int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (descriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat status;
+
+    if (::fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode))
+    {
+        ::close(descriptor);
+        return false;
+    }
+
+    // Un file vuoto non si puo' mappare, ma e' comunque un file aperto
+    if (status.st_size > 0)
+    {
+        void* data = ::mmap(nullptr, (std::size_t) status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+        if (data == MAP_FAILED)
+        {
+            ::close(descriptor);
+            return false;
+        }
+
+        this->_data = (const uint8_t*) data;
+    }
+
+    ::close(descriptor);
+
+    this->_size = (uint64_t) status.st_size;
+    this->_open = true;
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Rilascia la mappatura. I puntatori ottenuti da getData() non sono piu' validi.
+ */
+inline void MappedFile::close()
+{
+#ifdef MAPPED_FILE_POSIX
+    if (this->_data != nullptr)
+    {
+        ::munmap((void*) this->_data, (std::size_t) this->_size);
+    }
+#endif
+
+    this->_data = nullptr;
+    this->_size = 0;
+    this->_open = false;
+}
+
+/**
+ * Chiede al sistema operativo di iniziare a leggere in anticipo tutto il file, cosi' che
+ * i primi accessi non attendano il disco. Non blocca e non e' necessario per la correttezza.
+ */
+inline void MappedFile::prefetch() const
+{
+#ifdef MAPPED_FILE_POSIX
+    if (this->_data != nullptr)
+    {
+        ::madvise((void*) this->_data, (std::size_t) this->_size, MADV_WILLNEED);
+    }
+#endif
+}
+
+/**
+ * Restituisce true se un file e' aperto, altrimenti false
+ *
+ * @return True se un file e' aperto
+ */
+inline bool MappedFile::isOpen() const
+{
+    return this->_open;
+}
+
+/**
+ * Restituisce il contenuto del file, allineato alla pagina
+ *
+ * @return Primo byte del file, nullptr se il file e' vuoto o non aperto
+ */
+inline const uint8_t* MappedFile::getData() const
+{
+    return this->_data;
+}
+
+/**
+ * Restituisce la dimensione del file
+ *
+ * @return Dimensione in byte, zero se nessun file e' aperto
+ */
+inline uint64_t MappedFile::getSize() const
+{
+    return this->_size;
+}
+
+#endif // _MAPPEDFILE_H
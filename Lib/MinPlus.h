@@ -0,0 +1,119 @@
+#ifndef _MINPLUS_H
+#define _MINPLUS_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Se MIN_PLUS_SCALAR e' definita, vengono usate le versioni scalari anche quando SSE2
+// e' disponibile (utile per confrontare le due versioni)
+#if !defined(MIN_PLUS_SCALAR) && defined(__SSE2__)
+#define MIN_PLUS_SSE2
+#include <emmintrin.h>
+#endif
+
+/**
+ * Passo del prodotto min-plus su una riga: per ogni j sostituisce distances[j] con
+ * weight + row[j] se quest'ultimo e' minore, e in quel caso imposta hops[j] a hop.
+ * E' il ciclo interno di Floyd-Warshall con la matrice dei passi successivi.
+ *
+ * Versione generica, scalare, usata per i tipi di peso senza una versione vettoriale.
+ *
+ * @tparam T : Tipo del peso
+ * @param distances : Riga delle distanze da aggiornare
+ * @param hops : Riga dei passi successivi da aggiornare insieme alle distanze
+ * @param row : Riga delle distanze da sommare a weight
+ * @param weight : Distanza da sommare agli elementi di row
+ * @param hop : Passo successivo da assegnare agli elementi migliorati
+ * @param count : Numero di elementi delle righe
+ */
+template <class T>
+inline void minPlusRow(T* distances, uint32_t* hops, const T* row, T weight, uint32_t hop, std::size_t count)
+{
+    for (std::size_t j = 0; j < count; j++)
+    {
+        T candidate = weight + row[j];
+
+        if (candidate < distances[j])
+        {
+            distances[j] = candidate;
+            hops[j] = hop;
+        }
+    }
+}
+
+/**
+ * Passo del prodotto min-plus su una riga di interi a 32 bit.
+ *
+ * Con SSE2 vengono elaborati 4 elementi alla volta: il confronto produce una maschera
+ * con cui si scelgono sia le distanze sia i passi successivi (SSE2 non ha il minimo fra
+ * interi a 32 bit, quindi la scelta e' fatta con and/andnot/or). La somma non deve
+ * superare il massimo di int32_t.
+ *
+ * @param distances : Riga delle distanze da aggiornare
+ * @param hops : Riga dei passi successivi da aggiornare insieme alle distanze
+ * @param row : Riga delle distanze da sommare a weight
+ * @param weight : Distanza da sommare agli elementi di row
+ * @param hop : Passo successivo da assegnare agli elementi migliorati
+ * @param count : Numero di elementi delle righe
+ */
+inline void minPlusRow(int32_t* distances, uint32_t* hops, const int32_t* row, int32_t weight, uint32_t hop, std::size_t count)
+{
+    std::size_t j = 0;
+
+#if defined(MIN_PLUS_SSE2)
+    const __m128i weights = _mm_set1_epi32(weight);
+    const __m128i newHops = _mm_set1_epi32((int32_t) hop);
+
+    for (; j + 4 <= count; j += 4)
+    {
+        __m128i current = _mm_loadu_si128((const __m128i*) (distances + j));
+        __m128i candidate = _mm_add_epi32(weights, _mm_loadu_si128((const __m128i*) (row + j)));
+        __m128i better = _mm_cmplt_epi32(candidate, current);
+        __m128i oldHops = _mm_loadu_si128((const __m128i*) (hops + j));
+
+        _mm_storeu_si128((__m128i*) (distances + j), _mm_or_si128(_mm_and_si128(better, candidate), _mm_andnot_si128(better, current)));
+        _mm_storeu_si128((__m128i*) (hops + j), _mm_or_si128(_mm_and_si128(better, newHops), _mm_andnot_si128(better, oldHops)));
+    }
+#endif
+
+    minPlusRow<int32_t>(distances + j, hops + j, row + j, weight, hop, count - j);
+}
+
+/**
+ * Passo del prodotto min-plus su una riga di float.
+ *
+ * Con SSE2 vengono elaborati 4 elementi alla volta, scegliendo distanze e passi
+ * successivi con la maschera del confronto.
+ *
+ * @param distances : Riga delle distanze da aggiornare
+ * @param hops : Riga dei passi successivi da aggiornare insieme alle distanze
+ * @param row : Riga delle distanze da sommare a weight
+ * @param weight : Distanza da sommare agli elementi di row
+ * @param hop : Passo successivo da assegnare agli elementi migliorati
+ * @param count : Numero di elementi delle righe
+ */
+inline void minPlusRow(float* distances, uint32_t* hops, const float* row, float weight, uint32_t hop, std::size_t count)
+{
+    std::size_t j = 0;
+
+#if defined(MIN_PLUS_SSE2)
+    const __m128 weights = _mm_set1_ps(weight);
+    const __m128i newHops = _mm_set1_epi32((int32_t) hop);
+
+    for (; j + 4 <= count; j += 4)
+    {
+        __m128 current = _mm_loadu_ps(distances + j);
+        __m128 candidate = _mm_add_ps(weights, _mm_loadu_ps(row + j));
+        __m128 better = _mm_cmplt_ps(candidate, current);
+        __m128i mask = _mm_castps_si128(better);
+        __m128i oldHops = _mm_loadu_si128((const __m128i*) (hops + j));
+
+        _mm_storeu_ps(distances + j, _mm_or_ps(_mm_and_ps(better, candidate), _mm_andnot_ps(better, current)));
+        _mm_storeu_si128((__m128i*) (hops + j), _mm_or_si128(_mm_and_si128(mask, newHops), _mm_andnot_si128(mask, oldHops)));
+    }
+#endif
+
+    minPlusRow<float>(distances + j, hops + j, row + j, weight, hop, count - j);
+}
+
+#endif // _MINPLUS_H
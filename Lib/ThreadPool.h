@@ -0,0 +1,233 @@
+#ifndef _THREADPOOL_H
+#define _THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Gruppo di thread riutilizzabile per eseguire lavoro in parallelo.
+ *
+ * Il pool crea i thread una sola volta; ogni chiamata a run() li risveglia, fa eseguire a
+ * ognuno lo stesso compito e ritorna quando tutti hanno finito. Il thread chiamante
+ * partecipa al lavoro come thread 0, quindi un pool di N thread ne crea N - 1.
+ * Al ritorno di run() tutte le scritture fatte dai thread sono visibili al chiamante.
+ *
+ * parallelFor() divide un intervallo di indici in blocchi, assegnati dinamicamente ai
+ * thread man mano che si liberano, cosi' che blocchi di costo diverso si bilancino.
+ */
+class ThreadPool
+{
+    private:
+        std::vector<std::thread> _workers; // Thread del pool, escluso il chiamante
+        std::function<void(uint32_t)> _task; // Compito in esecuzione
+        std::mutex _lock; // Protegge lo stato condiviso con i thread
+        std::mutex _runLock; // Serializza le chiamate concorrenti a run()
+        std::condition_variable _wakeUp; // Segnala ai thread un nuovo compito
+        std::condition_variable _done; // Segnala al chiamante la fine del compito
+        uint64_t _generation; // Numero di compiti avviati
+        uint32_t _pending; // Thread che non hanno ancora finito il compito corrente
+        bool _isStopping; // Se true, i thread devono terminare
+
+    private:
+        void _work(uint32_t index);
+
+    public:
+        ThreadPool();
+        ThreadPool(uint32_t threadAmount);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        uint32_t getThreadAmount() const;
+
+        void run(const std::function<void(uint32_t)>& task);
+
+        template <class TBody>
+        void parallelFor(uint32_t begin, uint32_t end, uint32_t grain, const TBody& body);
+};
+
+
+/**
+ * Crea un pool con un thread per ogni core disponibile
+ */
+inline ThreadPool::ThreadPool() : ThreadPool(0) { }
+
+/**
+ * Crea un pool con threadAmount thread, compreso il chiamante.
+ * Se threadAmount e' zero, viene usato un thread per ogni core disponibile.
+ *
+ * @param threadAmount : Numero di thread
+ */
+inline ThreadPool::ThreadPool(uint32_t threadAmount)
+{
+    if (threadAmount == 0)
+    {
+        threadAmount = std::thread::hardware_concurrency();
+    }
+
+    if (threadAmount == 0)
+    {
+        threadAmount = 1;
+    }
+
+    this->_generation = 0;
+    this->_pending = 0;
+    this->_isStopping = false;
+
+    for (uint32_t i = 1; i < threadAmount; i++)
+    {
+        this->_workers.push_back(std::thread(&ThreadPool::_work, this, i));
+    }
+}
+
+/**
+ * Distruttore: attende la terminazione di tutti i thread
+ */
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->_lock);
+        this->_isStopping = true;
+    }
+
+    this->_wakeUp.notify_all();
+
+    for (std::size_t i = 0; i < this->_workers.size(); i++)
+    {
+        this->_workers[i].join();
+    }
+}
+
+/**
+ * Restituisce il numero di thread del pool, compreso il chiamante
+ *
+ * @return Numero di thread
+ */
+inline uint32_t ThreadPool::getThreadAmount() const
+{
+    return (uint32_t) this->_workers.size() + 1;
+}
+
+/**
+ * Esegue task su tutti i thread del pool e attende che abbiano finito.
+ * Ogni thread riceve il proprio indice, compreso fra 0 e getThreadAmount() - 1.
+ *
+ * @param task : Compito da eseguire
+ */
+inline void ThreadPool::run(const std::function<void(uint32_t)>& task)
+{
+    std::lock_guard<std::mutex> runLock(this->_runLock);
+
+    if (this->_workers.empty())
+    {
+        task(0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->_lock);
+
+        this->_task = task;
+        this->_pending = (uint32_t) this->_workers.size();
+        this->_generation++;
+    }
+
+    this->_wakeUp.notify_all();
+    task(0);
+
+    std::unique_lock<std::mutex> lock(this->_lock);
+    this->_done.wait(lock, [this]() { return this->_pending == 0; });
+
+    this->_task = nullptr;
+}
+
+/**
+ * Esegue body su tutti gli indici compresi fra begin (incluso) ed end (escluso).
+ * L'intervallo viene diviso in blocchi di grain indici; body(from, to, thread) riceve
+ * un blocco alla volta e l'indice del thread che lo esegue. Se l'intervallo sta in un
+ * solo blocco, body viene eseguito direttamente dal chiamante.
+ *
+ * @tparam TBody : Tipo della funzione da eseguire
+ * @param begin : Primo indice
+ * @param end : Indice successivo all'ultimo
+ * @param grain : Numero di indici per blocco
+ * @param body : Funzione da eseguire su ogni blocco
+ */
+template <class TBody>
+void ThreadPool::parallelFor(uint32_t begin, uint32_t end, uint32_t grain, const TBody& body)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    if (grain == 0)
+    {
+        grain = 1;
+    }
+
+    if (this->_workers.empty() || end - begin <= grain)
+    {
+        body(begin, end, 0U);
+        return;
+    }
+
+    std::atomic<uint64_t> next(begin); // Primo indice del prossimo blocco da assegnare
+
+    this->run([&next, end, grain, &body](uint32_t thread)
+    {
+        uint64_t from;
+
+        while ((from = next.fetch_add(grain, std::memory_order_relaxed)) < end)
+        {
+            uint64_t to = from + grain;
+            body((uint32_t) from, (uint32_t) (to < end ? to : end), thread);
+        }
+    });
+}
+
+/**
+ * Ciclo eseguito da ogni thread del pool: attende un nuovo compito, lo esegue e ne
+ * segnala la fine, finche' il pool non viene distrutto
+ *
+ * @param index : Indice del thread
+ */
+inline void ThreadPool::_work(uint32_t index)
+{
+    uint64_t seen = 0; // Ultimo compito eseguito
+
+    while (true)
+    {
+        std::function<void(uint32_t)> task;
+
+        {
+            std::unique_lock<std::mutex> lock(this->_lock);
+            this->_wakeUp.wait(lock, [this, seen]() { return this->_isStopping || this->_generation != seen; });
+
+            if (this->_isStopping)
+            {
+                return;
+            }
+
+            seen = this->_generation;
+            task = this->_task;
+        }
+
+        task(index);
+
+        std::lock_guard<std::mutex> lock(this->_lock);
+
+        if (--this->_pending == 0)
+        {
+            this->_done.notify_one();
+        }
+    }
+}
+
+#endif // _THREADPOOL_H
@@ -0,0 +1,103 @@
+#ifndef _VISITEDSET_H
+#define _VISITEDSET_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Insieme dei nodi visitati, riutilizzabile fra una visita e l'altra.
+ *
+ * Invece di un booleano per nodo, ogni nodo conserva il numero (epoca) dell'ultima visita
+ * in cui e' stato raggiunto: un nodo e' visitato se il suo timbro coincide con l'epoca
+ * corrente. Iniziare una nuova visita significa solo incrementare l'epoca, quindi visite
+ * consecutive costano quanto i nodi effettivamente raggiunti e non O(V). I timbri vengono
+ * azzerati solo quando l'epoca torna a zero, una volta ogni 2^32 visite.
+ */
+class VisitedSet
+{
+    private:
+        std::vector<uint32_t> _stamps; // Epoca dell'ultima visita che ha raggiunto ogni nodo
+        uint32_t _epoch; // Epoca della visita corrente
+
+    public:
+        VisitedSet();
+
+        void begin(uint32_t size);
+
+        uint32_t getSize() const;
+        bool isVisited(uint32_t node) const;
+        bool visit(uint32_t node);
+};
+
+
+/**
+ * Crea un insieme vuoto
+ */
+inline VisitedSet::VisitedSet()
+{
+    this->_epoch = 0;
+}
+
+/**
+ * Inizia una nuova visita su size nodi, rendendo tutti i nodi non visitati.
+ * Se size non cambia, il costo e' costante.
+ *
+ * @param size : Numero di nodi
+ */
+inline void VisitedSet::begin(uint32_t size)
+{
+    if (this->_stamps.size() != size)
+    {
+        this->_stamps.assign(size, 0);
+        this->_epoch = 0;
+    }
+
+    this->_epoch++;
+
+    // L'epoca e' tornata a zero: i vecchi timbri potrebbero coincidere con le nuove epoche
+    if (this->_epoch == 0)
+    {
+        this->_stamps.assign(size, 0);
+        this->_epoch = 1;
+    }
+}
+
+/**
+ * Restituisce il numero di nodi gestiti
+ *
+ * @return Numero di nodi
+ */
+inline uint32_t VisitedSet::getSize() const
+{
+    return (uint32_t) this->_stamps.size();
+}
+
+/**
+ * Restituisce true se il nodo e' stato visitato nella visita corrente
+ *
+ * @param node : Id del nodo
+ * @return True se il nodo e' visitato, altrimenti false
+ */
+inline bool VisitedSet::isVisited(uint32_t node) const
+{
+    return (node < this->_stamps.size() && this->_stamps[node] == this->_epoch);
+}
+
+/**
+ * Segna il nodo come visitato
+ *
+ * @param node : Id del nodo
+ * @return True se il nodo non era ancora stato visitato, altrimenti false
+ */
+inline bool VisitedSet::visit(uint32_t node)
+{
+    if (this->_stamps[node] == this->_epoch)
+    {
+        return false;
+    }
+
+    this->_stamps[node] = this->_epoch;
+    return true;
+}
+
+#endif // _VISITEDSET_H
@@ -0,0 +1,278 @@
+#ifndef _DARYPRIORITYQUEUE_H
+#define _DARYPRIORITYQUEUE_H
+
+#include "IPriorityQueue.h"
+
+/**
+ * Classe che realizza la coda con priorita' tramite uno heap d-ario implicito.
+ *
+ * Ogni nodo ha D figli memorizzati in posizioni contigue dell'array, quindi l'albero
+ * ha altezza log_D(n): l'inserimento effettua meno confronti rispetto allo heap binario
+ * e, in _fixDown, i figli di un nodo vengono letti da una sola linea di cache.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo (ad esempio 4 oppure 8)
+ */
+template <class T, std::size_t D = 4>
+class DaryPriorityQueue : public IPriorityQueue<T, std::size_t>
+{
+    static_assert(D >= 2, "Lo heap deve avere almeno due figli per nodo");
+
+    public:
+        typedef typename IPriorityQueue<T, std::size_t>::Type Type;
+        typedef typename IPriorityQueue<T, std::size_t>::Iterator Iterator;
+
+    private:
+        static const std::size_t _DEFAULT_SIZE = 16ULL; // Lunghezza iniziale di default della coda
+
+        std::size_t _length; // Lunghezza massima attuale dello heap
+        std::size_t _currentSize; // Numero di elementi presenti nella coda
+        Type* _heap; // Array heap
+
+    private:
+        void _grow();
+        void _fixUp(std::size_t pos);
+        void _fixDown(std::size_t pos);
+
+    public:
+        DaryPriorityQueue();
+        DaryPriorityQueue(std::size_t size);
+        ~DaryPriorityQueue();
+
+        bool isEmpty() const;
+        std::size_t getSize() const;
+        Type min() const;
+
+        void insert(const Type& value);
+        void deleteMin();
+        void clear();
+};
+
+
+/**
+ * Crea una coda con priorita' con dimensioni iniziali di default (16)
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ */
+template <class T, std::size_t D>
+DaryPriorityQueue<T, D>::DaryPriorityQueue() : DaryPriorityQueue(_DEFAULT_SIZE) { }
+
+/**
+ * Crea una coda con priorita' vuota con dimensioni iniziali pari a size.
+ * Se size e' uguale a zero, allora la coda avra' dimensioni di default (16)
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ * @param size : Dimensioni iniziali della coda
+ */
+template <class T, std::size_t D>
+DaryPriorityQueue<T, D>::DaryPriorityQueue(std::size_t size)
+{
+    this->_length = (size == 0) ? _DEFAULT_SIZE : size;
+    this->_currentSize = 0;
+    this->_heap = new Type[this->_length];
+}
+
+/**
+ * Distruttore
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ */
+template <class T, std::size_t D>
+DaryPriorityQueue<T, D>::~DaryPriorityQueue()
+{
+    delete[] this->_heap;
+    this->_heap = nullptr;
+
+    this->_length = 0;
+    this->_currentSize = 0;
+}
+
+/**
+ * Restituisce true se la coda con priorita' e' vuota, altrimenti false.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ * @return True se e' vuota, altrimenti false
+ */
+template <class T, std::size_t D>
+bool DaryPriorityQueue<T, D>::isEmpty() const
+{
+    return (this->_currentSize == 0);
+}
+
+/**
+ * Restituisce il numero di elementi presenti nella coda
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ * @return Numero di elementi nella coda
+ */
+template <class T, std::size_t D>
+std::size_t DaryPriorityQueue<T, D>::getSize() const
+{
+    return this->_currentSize;
+}
+
+/**
+ * Restituisce il valore minimo della coda
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ * @return Valore minimo della coda
+ */
+template <class T, std::size_t D>
+typename DaryPriorityQueue<T, D>::Type DaryPriorityQueue<T, D>::min() const
+{
+    return this->_heap[0];
+}
+
+/**
+ * Inserisce un nuovo elemento, raddoppiando le dimensioni dello heap se e' pieno.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ * @param value : Valore da inserire
+ */
+template <class T, std::size_t D>
+void DaryPriorityQueue<T, D>::insert(const Type& value)
+{
+    if (this->_currentSize == this->_length)
+    {
+        this->_grow();
+    }
+
+    this->_heap[this->_currentSize] = value;
+    this->_currentSize++;
+    this->_fixUp(this->_currentSize - 1);
+}
+
+/**
+ * Elimina l'elemento con valore minimo, cioe' quello con priorita' piu' alta.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ */
+template <class T, std::size_t D>
+void DaryPriorityQueue<T, D>::deleteMin()
+{
+    if (this->isEmpty())
+    {
+        return;
+    }
+
+    this->_currentSize--;
+
+    if (this->_currentSize > 0)
+    {
+        this->_heap[0] = this->_heap[this->_currentSize];
+        this->_fixDown(0);
+    }
+}
+
+/**
+ * Svuota la coda con priorita'
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ */
+template <class T, std::size_t D>
+void DaryPriorityQueue<T, D>::clear()
+{
+    this->_currentSize = 0;
+}
+
+
+/**
+ * Raddoppia la lunghezza massima dello heap
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ */
+template <class T, std::size_t D>
+void DaryPriorityQueue<T, D>::_grow()
+{
+    std::size_t newLength = this->_length * 2;
+    Type* newHeap = new Type[newLength];
+
+    for (std::size_t i = 0; i < this->_currentSize; i++)
+    {
+        newHeap[i] = this->_heap[i];
+    }
+
+    delete[] this->_heap;
+
+    this->_heap = newHeap;
+    this->_length = newLength;
+}
+
+/**
+ * Fa risalire l'elemento in posizione pos. Il genitore della posizione i si trova in (i - 1) / D
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ * @param pos : Posizione di partenza
+ */
+template <class T, std::size_t D>
+void DaryPriorityQueue<T, D>::_fixUp(std::size_t pos)
+{
+    Type value = this->_heap[pos];
+
+    while (pos > 0)
+    {
+        std::size_t parentPos = (pos - 1) / D;
+
+        if (!(value < this->_heap[parentPos]))
+        {
+            break;
+        }
+
+        this->_heap[pos] = this->_heap[parentPos];
+        pos = parentPos;
+    }
+
+    this->_heap[pos] = value;
+}
+
+/**
+ * Fa scendere l'elemento in posizione pos scambiandolo con il minore dei suoi D figli,
+ * che si trovano nelle posizioni contigue da D * pos + 1 a D * pos + D.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @tparam D : Numero di figli di ogni nodo
+ * @param pos : Posizione di partenza
+ */
+template <class T, std::size_t D>
+void DaryPriorityQueue<T, D>::_fixDown(std::size_t pos)
+{
+    Type value = this->_heap[pos];
+
+    while (D * pos + 1 < this->_currentSize)
+    {
+        std::size_t firstChild = D * pos + 1;
+        std::size_t lastChild = (firstChild + D < this->_currentSize) ? firstChild + D : this->_currentSize;
+        std::size_t minChild = firstChild;
+
+        for (std::size_t child = firstChild + 1; child < lastChild; child++)
+        {
+            if (this->_heap[child] < this->_heap[minChild])
+            {
+                minChild = child;
+            }
+        }
+
+        if (!(this->_heap[minChild] < value))
+        {
+            break;
+        }
+
+        this->_heap[pos] = this->_heap[minChild];
+        pos = minChild;
+    }
+
+    this->_heap[pos] = value;
+}
+
+#endif // _DARYPRIORITYQUEUE_H
@@ -0,0 +1,475 @@
+#ifndef _INDEXEDPRIORITYQUEUE_H
+#define _INDEXEDPRIORITYQUEUE_H
+
+#include "IPriorityQueue.h"
+
+#include <cstdint>
+
+/**
+ * Classe che realizza la coda con priorita' indicizzata.
+ *
+ * Ogni elemento inserito riceve un handle stabile, che rimane valido fino a quando
+ * l'elemento non viene rimosso dalla coda. Attraverso l'handle e' possibile diminuire
+ * la priorita' di un elemento (decreaseKey) o rimuoverlo (erase) in tempo O(log n),
+ * senza dover reinserire dei duplicati.
+ *
+ * Lo heap contiene solo gli handle, mentre i valori restano fermi nella posizione
+ * indicata dal proprio handle. Gli handle liberati vengono riutilizzati.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+class IndexedPriorityQueue : public IPriorityQueue<T, std::size_t>
+{
+    public:
+        typedef typename IPriorityQueue<T, std::size_t>::Type Type;
+        typedef typename IPriorityQueue<T, std::size_t>::Iterator Iterator;
+        typedef std::size_t Handle;
+
+        static const Handle NULL_HANDLE = SIZE_MAX; // Handle che non identifica alcun elemento
+
+    private:
+        static const std::size_t _DEFAULT_SIZE = 16ULL; // Lunghezza iniziale di default della coda
+        static const std::size_t _NO_POSITION = SIZE_MAX; // Posizione di un handle non presente nello heap
+
+        std::size_t _length; // Lunghezza degli array interni
+        std::size_t _currentSize; // Numero di elementi presenti nella coda
+        std::size_t _handleAmount; // Numero di handle distribuiti almeno una volta
+        std::size_t _freeAmount; // Numero di handle liberi riutilizzabili
+
+        Type* _values; // Valori degli elementi, indicizzati per handle
+        Handle* _heap; // Array heap di handle
+        std::size_t* _positions; // Posizione nello heap di ogni handle
+        Handle* _freeHandles; // Pila degli handle liberati
+
+    private:
+        void _grow();
+        void _place(Handle handle, std::size_t pos);
+        void _fixUp(std::size_t pos);
+        void _fixDown(std::size_t pos);
+        void _removeAt(std::size_t pos);
+
+    public:
+        IndexedPriorityQueue();
+        IndexedPriorityQueue(std::size_t size);
+        ~IndexedPriorityQueue();
+
+        bool isEmpty() const;
+        std::size_t getSize() const;
+        bool contains(Handle handle) const;
+
+        Type min() const;
+        Handle minHandle() const;
+        const Type& get(Handle handle) const;
+
+        void insert(const Type& value);
+        Handle push(const Type& value);
+        void deleteMin();
+        void clear();
+
+        void decreaseKey(Handle handle, const Type& value);
+        void erase(Handle handle);
+};
+
+template <class T>
+const typename IndexedPriorityQueue<T>::Handle IndexedPriorityQueue<T>::NULL_HANDLE;
+
+
+/**
+ * Crea una coda con priorita' indicizzata con dimensioni iniziali di default (16)
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+IndexedPriorityQueue<T>::IndexedPriorityQueue() : IndexedPriorityQueue(_DEFAULT_SIZE) { }
+
+/**
+ * Crea una coda con priorita' indicizzata con dimensioni iniziali pari a size.
+ * Se size e' uguale a zero, allora la coda avra' dimensioni di default (16).
+ * La coda cresce automaticamente quando viene riempita.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param size : Dimensioni iniziali della coda
+ */
+template <class T>
+IndexedPriorityQueue<T>::IndexedPriorityQueue(std::size_t size)
+{
+    this->_length = (size == 0) ? _DEFAULT_SIZE : size;
+    this->_currentSize = 0;
+    this->_handleAmount = 0;
+    this->_freeAmount = 0;
+
+    this->_values = new Type[this->_length];
+    this->_heap = new Handle[this->_length];
+    this->_positions = new std::size_t[this->_length];
+    this->_freeHandles = new Handle[this->_length];
+}
+
+/**
+ * Distruttore
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+IndexedPriorityQueue<T>::~IndexedPriorityQueue()
+{
+    delete[] this->_values;
+    delete[] this->_heap;
+    delete[] this->_positions;
+    delete[] this->_freeHandles;
+
+    this->_length = 0;
+    this->_currentSize = 0;
+}
+
+/**
+ * Restituisce true se la coda con priorita' e' vuota, altrimenti false.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @return True se e' vuota, altrimenti false
+ */
+template <class T>
+bool IndexedPriorityQueue<T>::isEmpty() const
+{
+    return (this->_currentSize == 0);
+}
+
+/**
+ * Restituisce il numero di elementi presenti nella coda
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @return Numero di elementi nella coda
+ */
+template <class T>
+std::size_t IndexedPriorityQueue<T>::getSize() const
+{
+    return this->_currentSize;
+}
+
+/**
+ * Restituisce true se l'handle identifica un elemento ancora presente nella coda
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param handle : Handle da verificare
+ * @return True se l'elemento e' nella coda, altrimenti false
+ */
+template <class T>
+bool IndexedPriorityQueue<T>::contains(Handle handle) const
+{
+    return (handle < this->_handleAmount && this->_positions[handle] != _NO_POSITION);
+}
+
+/**
+ * Restituisce il valore minimo della coda
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @return Valore minimo della coda
+ */
+template <class T>
+typename IndexedPriorityQueue<T>::Type IndexedPriorityQueue<T>::min() const
+{
+    return this->_values[this->_heap[0]];
+}
+
+/**
+ * Restituisce l'handle dell'elemento con valore minimo, oppure NULL_HANDLE se la coda e' vuota
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @return Handle del minimo
+ */
+template <class T>
+typename IndexedPriorityQueue<T>::Handle IndexedPriorityQueue<T>::minHandle() const
+{
+    if (this->isEmpty())
+    {
+        return NULL_HANDLE;
+    }
+
+    return this->_heap[0];
+}
+
+/**
+ * Restituisce il valore associato ad un handle presente nella coda
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param handle : Handle dell'elemento
+ * @return Valore dell'elemento
+ */
+template <class T>
+const typename IndexedPriorityQueue<T>::Type& IndexedPriorityQueue<T>::get(Handle handle) const
+{
+    return this->_values[handle];
+}
+
+/**
+ * Inserisce un nuovo elemento, ignorandone l'handle.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param value : Valore da inserire
+ */
+template <class T>
+void IndexedPriorityQueue<T>::insert(const Type& value)
+{
+    this->push(value);
+}
+
+/**
+ * Inserisce un nuovo elemento e restituisce il suo handle.
+ * Se la coda e' piena, le sue dimensioni vengono raddoppiate.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param value : Valore da inserire
+ * @return Handle dell'elemento inserito
+ */
+template <class T>
+typename IndexedPriorityQueue<T>::Handle IndexedPriorityQueue<T>::push(const Type& value)
+{
+    Handle handle;
+
+    if (this->_freeAmount > 0)
+    {
+        this->_freeAmount--;
+        handle = this->_freeHandles[this->_freeAmount];
+    }
+
+    else
+    {
+        if (this->_handleAmount == this->_length)
+        {
+            this->_grow();
+        }
+
+        handle = this->_handleAmount;
+        this->_handleAmount++;
+    }
+
+    this->_values[handle] = value;
+    this->_place(handle, this->_currentSize);
+    this->_currentSize++;
+
+    this->_fixUp(this->_currentSize - 1);
+
+    return handle;
+}
+
+/**
+ * Elimina l'elemento con valore minimo, liberandone l'handle.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+void IndexedPriorityQueue<T>::deleteMin()
+{
+    if (this->isEmpty())
+    {
+        return;
+    }
+
+    this->_removeAt(0);
+}
+
+/**
+ * Svuota la coda, invalidando tutti gli handle distribuiti.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+void IndexedPriorityQueue<T>::clear()
+{
+    this->_currentSize = 0;
+    this->_handleAmount = 0;
+    this->_freeAmount = 0;
+}
+
+/**
+ * Diminuisce la priorita' dell'elemento identificato da handle, assegnandogli il valore value.
+ * Se value non e' minore del valore attuale oppure l'handle non e' nella coda, non fa nulla.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param handle : Handle dell'elemento
+ * @param value : Nuovo valore dell'elemento
+ */
+template <class T>
+void IndexedPriorityQueue<T>::decreaseKey(Handle handle, const Type& value)
+{
+    if (!this->contains(handle) || !(value < this->_values[handle]))
+    {
+        return;
+    }
+
+    this->_values[handle] = value;
+    this->_fixUp(this->_positions[handle]);
+}
+
+/**
+ * Rimuove dalla coda l'elemento identificato da handle, liberandone l'handle.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param handle : Handle dell'elemento da rimuovere
+ */
+template <class T>
+void IndexedPriorityQueue<T>::erase(Handle handle)
+{
+    if (!this->contains(handle))
+    {
+        return;
+    }
+
+    this->_removeAt(this->_positions[handle]);
+}
+
+
+/**
+ * Raddoppia le dimensioni degli array interni
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+void IndexedPriorityQueue<T>::_grow()
+{
+    std::size_t newLength = this->_length * 2;
+
+    Type* newValues = new Type[newLength];
+    Handle* newHeap = new Handle[newLength];
+    std::size_t* newPositions = new std::size_t[newLength];
+    Handle* newFreeHandles = new Handle[newLength];
+
+    for (std::size_t i = 0; i < this->_handleAmount; i++)
+    {
+        newValues[i] = this->_values[i];
+        newPositions[i] = this->_positions[i];
+    }
+
+    for (std::size_t i = 0; i < this->_currentSize; i++)
+    {
+        newHeap[i] = this->_heap[i];
+    }
+
+    for (std::size_t i = 0; i < this->_freeAmount; i++)
+    {
+        newFreeHandles[i] = this->_freeHandles[i];
+    }
+
+    delete[] this->_values;
+    delete[] this->_heap;
+    delete[] this->_positions;
+    delete[] this->_freeHandles;
+
+    this->_values = newValues;
+    this->_heap = newHeap;
+    this->_positions = newPositions;
+    this->_freeHandles = newFreeHandles;
+    this->_length = newLength;
+}
+
+/**
+ * Mette l'handle nella posizione pos dello heap, aggiornando la sua posizione
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param handle : Handle da posizionare
+ * @param pos : Posizione nello heap
+ */
+template <class T>
+void IndexedPriorityQueue<T>::_place(Handle handle, std::size_t pos)
+{
+    this->_heap[pos] = handle;
+    this->_positions[handle] = pos;
+}
+
+/**
+ * Fa risalire l'elemento in posizione pos fino a quando il suo genitore non e' minore o uguale.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param pos : Posizione di partenza
+ */
+template <class T>
+void IndexedPriorityQueue<T>::_fixUp(std::size_t pos)
+{
+    Handle handle = this->_heap[pos];
+
+    while (pos > 0)
+    {
+        std::size_t parentPos = (pos - 1) / 2;
+
+        if (!(this->_values[handle] < this->_values[this->_heap[parentPos]]))
+        {
+            break;
+        }
+
+        this->_place(this->_heap[parentPos], pos);
+        pos = parentPos;
+    }
+
+    this->_place(handle, pos);
+}
+
+/**
+ * Fa scendere l'elemento in posizione pos, scambiandolo con il minore dei suoi figli,
+ * fino a quando non e' minore o uguale ad entrambi oppure raggiunge il fondo dello heap.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param pos : Posizione di partenza
+ */
+template <class T>
+void IndexedPriorityQueue<T>::_fixDown(std::size_t pos)
+{
+    Handle handle = this->_heap[pos];
+
+    while (2 * pos + 1 < this->_currentSize)
+    {
+        std::size_t childPos = 2 * pos + 1;
+
+        if (childPos + 1 < this->_currentSize &&
+            this->_values[this->_heap[childPos + 1]] < this->_values[this->_heap[childPos]])
+        {
+            childPos++;
+        }
+
+        if (!(this->_values[this->_heap[childPos]] < this->_values[handle]))
+        {
+            break;
+        }
+
+        this->_place(this->_heap[childPos], pos);
+        pos = childPos;
+    }
+
+    this->_place(handle, pos);
+}
+
+/**
+ * Rimuove l'elemento in posizione pos dello heap, sostituendolo con l'ultimo elemento
+ * e ripristinando i vincoli dello heap. L'handle rimosso viene liberato.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param pos : Posizione dell'elemento da rimuovere
+ */
+template <class T>
+void IndexedPriorityQueue<T>::_removeAt(std::size_t pos)
+{
+    Handle removed = this->_heap[pos];
+
+    this->_positions[removed] = _NO_POSITION;
+    this->_freeHandles[this->_freeAmount] = removed;
+    this->_freeAmount++;
+    this->_currentSize--;
+
+    if (pos == this->_currentSize)
+    {
+        return;
+    }
+
+    this->_place(this->_heap[this->_currentSize], pos);
+
+    if (pos > 0 && this->_values[this->_heap[pos]] < this->_values[this->_heap[(pos - 1) / 2]])
+    {
+        this->_fixUp(pos);
+    }
+
+    else
+    {
+        this->_fixDown(pos);
+    }
+}
+
+#endif // _INDEXEDPRIORITYQUEUE_H
@@ -0,0 +1,352 @@
+#ifndef _PAIRINGHEAP_H
+#define _PAIRINGHEAP_H
+
+#include "IPriorityQueue.h"
+
+#include <vector>
+
+template <class T>
+class PairingHeap;
+
+/**
+ * Nodo di un pairing heap. I figli di un nodo formano una lista concatenata
+ * tramite il puntatore al fratello successivo.
+ *
+ * @tparam T : Tipo di dato contenuto nel nodo
+ */
+template <class T>
+class PairingHeapNode
+{
+    friend class PairingHeap<T>;
+
+    private:
+        T _value; // Valore del nodo
+        PairingHeapNode<T>* _child; // Primo figlio del nodo
+        PairingHeapNode<T>* _sibling; // Fratello successivo del nodo
+};
+
+
+/**
+ * Classe che realizza la coda con priorita' tramite un pairing heap.
+ *
+ * L'inserimento e l'unione di due code (meld) costano O(1), mentre deleteMin costa
+ * O(log n) ammortizzato grazie all'accoppiamento in due passate dei figli della radice.
+ * E' adatto ai carichi in cui gli inserimenti sono molto piu' frequenti delle estrazioni.
+ *
+ * I nodi eliminati vengono conservati in una lista libera e riutilizzati dagli inserimenti
+ * successivi, per evitare una allocazione per ogni elemento.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+class PairingHeap : public IPriorityQueue<T, PairingHeapNode<T>*>
+{
+    public:
+        typedef typename IPriorityQueue<T, PairingHeapNode<T>*>::Type Type;
+        typedef typename IPriorityQueue<T, PairingHeapNode<T>*>::Iterator Iterator;
+
+    private:
+        Iterator _root; // Radice dello heap, contiene il minimo
+        Iterator _freeNodes; // Lista dei nodi liberi, concatenati tramite _sibling
+        std::size_t _currentSize; // Numero di elementi presenti nella coda
+        std::vector<Iterator> _pairs; // Buffer di supporto per l'accoppiamento in deleteMin
+
+    private:
+        Iterator _createNode(const Type& value);
+        Iterator _link(Iterator first, Iterator second);
+        void _release(Iterator node);
+        void _destroy(Iterator node);
+
+    public:
+        PairingHeap();
+        ~PairingHeap();
+
+        bool isEmpty() const;
+        std::size_t getSize() const;
+        Type min() const;
+
+        void insert(const Type& value);
+        void deleteMin();
+        void clear();
+
+        void meld(PairingHeap<T>& heap);
+};
+
+
+/**
+ * Crea un pairing heap vuoto
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+PairingHeap<T>::PairingHeap()
+{
+    this->_root = nullptr;
+    this->_freeNodes = nullptr;
+    this->_currentSize = 0;
+}
+
+/**
+ * Distruttore
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+PairingHeap<T>::~PairingHeap()
+{
+    this->_destroy(this->_root);
+    this->_destroy(this->_freeNodes);
+
+    this->_root = nullptr;
+    this->_freeNodes = nullptr;
+    this->_currentSize = 0;
+}
+
+/**
+ * Restituisce true se la coda con priorita' e' vuota, altrimenti false.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @return True se e' vuota, altrimenti false
+ */
+template <class T>
+bool PairingHeap<T>::isEmpty() const
+{
+    return (this->_root == nullptr);
+}
+
+/**
+ * Restituisce il numero di elementi presenti nella coda
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @return Numero di elementi nella coda
+ */
+template <class T>
+std::size_t PairingHeap<T>::getSize() const
+{
+    return this->_currentSize;
+}
+
+/**
+ * Restituisce il valore minimo della coda
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @return Valore minimo della coda
+ */
+template <class T>
+typename PairingHeap<T>::Type PairingHeap<T>::min() const
+{
+    return this->_root->_value;
+}
+
+/**
+ * Inserisce un nuovo elemento, collegandolo alla radice in tempo costante.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param value : Valore da inserire
+ */
+template <class T>
+void PairingHeap<T>::insert(const Type& value)
+{
+    this->_root = this->_link(this->_root, this->_createNode(value));
+    this->_currentSize++;
+}
+
+/**
+ * Elimina l'elemento con valore minimo.
+ * I figli della radice vengono accoppiati da sinistra verso destra e poi fusi
+ * da destra verso sinistra (two-pass pairing).
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+void PairingHeap<T>::deleteMin()
+{
+    if (this->isEmpty())
+    {
+        return;
+    }
+
+    Iterator oldRoot = this->_root;
+    Iterator child = oldRoot->_child;
+
+    this->_pairs.clear();
+
+    // Prima passata: accoppio i figli a due a due
+    while (child != nullptr)
+    {
+        Iterator first = child;
+        Iterator second = child->_sibling;
+
+        if (second == nullptr)
+        {
+            first->_sibling = nullptr;
+            this->_pairs.push_back(first);
+            break;
+        }
+
+        child = second->_sibling;
+        first->_sibling = nullptr;
+        second->_sibling = nullptr;
+
+        this->_pairs.push_back(this->_link(first, second));
+    }
+
+    // Seconda passata: fondo le coppie partendo dall'ultima
+    Iterator newRoot = nullptr;
+
+    for (std::size_t i = this->_pairs.size(); i > 0; i--)
+    {
+        newRoot = this->_link(this->_pairs[i - 1], newRoot);
+    }
+
+    this->_root = newRoot;
+    this->_currentSize--;
+    this->_release(oldRoot);
+}
+
+/**
+ * Svuota la coda con priorita'
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+void PairingHeap<T>::clear()
+{
+    this->_destroy(this->_root);
+
+    this->_root = nullptr;
+    this->_currentSize = 0;
+}
+
+/**
+ * Unisce in tempo costante gli elementi di heap a questa coda. Al termine heap e' vuoto.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param heap : Coda da unire
+ */
+template <class T>
+void PairingHeap<T>::meld(PairingHeap<T>& heap)
+{
+    if (this == &heap)
+    {
+        return;
+    }
+
+    this->_root = this->_link(this->_root, heap._root);
+    this->_currentSize += heap._currentSize;
+
+    heap._root = nullptr;
+    heap._currentSize = 0;
+}
+
+
+/**
+ * Crea un nodo con valore value, riutilizzando se possibile un nodo libero
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param value : Valore del nodo
+ * @return Nodo creato
+ */
+template <class T>
+typename PairingHeap<T>::Iterator PairingHeap<T>::_createNode(const Type& value)
+{
+    Iterator node = this->_freeNodes;
+
+    if (node != nullptr)
+    {
+        this->_freeNodes = node->_sibling;
+    }
+
+    else
+    {
+        node = new PairingHeapNode<T>();
+    }
+
+    node->_value = value;
+    node->_child = nullptr;
+    node->_sibling = nullptr;
+
+    return node;
+}
+
+/**
+ * Collega due heap: la radice con valore maggiore diventa il primo figlio dell'altra.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param first : Radice del primo heap
+ * @param second : Radice del secondo heap
+ * @return Radice dello heap risultante
+ */
+template <class T>
+typename PairingHeap<T>::Iterator PairingHeap<T>::_link(Iterator first, Iterator second)
+{
+    if (first == nullptr)
+    {
+        return second;
+    }
+
+    if (second == nullptr)
+    {
+        return first;
+    }
+
+    if (second->_value < first->_value)
+    {
+        Iterator temp = first;
+        first = second;
+        second = temp;
+    }
+
+    second->_sibling = first->_child;
+    first->_child = second;
+
+    return first;
+}
+
+/**
+ * Inserisce un nodo nella lista dei nodi liberi
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param node : Nodo da liberare
+ */
+template <class T>
+void PairingHeap<T>::_release(Iterator node)
+{
+    node->_child = nullptr;
+    node->_sibling = this->_freeNodes;
+    this->_freeNodes = node;
+}
+
+/**
+ * Dealloca tutti i nodi raggiungibili da node, senza ricorsione.
+ *
+ * @tparam T : Tipo di dato contenuto nella coda con priorita'
+ * @param node : Nodo da cui iniziare la deallocazione
+ */
+template <class T>
+void PairingHeap<T>::_destroy(Iterator node)
+{
+    while (node != nullptr)
+    {
+        // Sposto i figli in testa ai fratelli, cosi' da visitare l'albero come una lista
+        if (node->_child != nullptr)
+        {
+            Iterator lastChild = node->_child;
+
+            while (lastChild->_sibling != nullptr)
+            {
+                lastChild = lastChild->_sibling;
+            }
+
+            lastChild->_sibling = node->_sibling;
+            node->_sibling = node->_child;
+            node->_child = nullptr;
+        }
+
+        Iterator next = node->_sibling;
+        delete node;
+        node = next;
+    }
+}
+
+#endif // _PAIRINGHEAP_H
@@ -24,6 +24,7 @@ class PriorityQueue : public IPriorityQueue<T, std::size_t>
 
     private:
         void _swap(std::size_t childIndex, std::size_t parentIndex);
+        void _grow();
         void _fixUp();
         void _fixDown(std::size_t startPos, std::size_t endPos);
 
@@ -33,6 +34,7 @@ class PriorityQueue : public IPriorityQueue<T, std::size_t>
         ~PriorityQueue();
 
         bool isEmpty() const;
+        std::size_t getSize() const;
         Type min() const;
 
         void insert(const Type& value);
@@ -110,6 +112,18 @@ bool PriorityQueue<T>::isEmpty() const
     return (this->_currentSize == 0);
 }
 
+/**
+ * Restituisce il numero di elementi presenti nella coda con priorita'
+ *
+ * @tparam T: Tipo di dato contenuto nella coda con priorita'
+ * @return Numero di elementi nella coda
+ */
+template<class T>
+std::size_t PriorityQueue<T>::getSize() const
+{
+    return this->_currentSize;
+}
+
 /**
  * Restituisce il valore minimo della coda
  *
@@ -127,6 +141,7 @@ typename PriorityQueue<T>::Type PriorityQueue<T>::min() const
 
 /**
  * Inserisce un nuovo elemento.
+ * Se lo heap e' pieno, la sua lunghezza massima viene raddoppiata prima dell'inserimento.
  *
  * @tparam T: Tipo di dato contenuto nella coda con priorita'
  * @param value: Valore da inserire
@@ -134,12 +149,14 @@ typename PriorityQueue<T>::Type PriorityQueue<T>::min() const
 template <class T>
 void PriorityQueue<T>::insert(const Type& value)
 {
-    if (this->_currentSize < this->_length)
+    if (this->_currentSize == this->_length)
     {
-        this->_heap[this->_currentSize] = value;
-        this->_currentSize++;
-        this->_fixUp();
+        this->_grow();
     }
+
+    this->_heap[this->_currentSize] = value;
+    this->_currentSize++;
+    this->_fixUp();
 }
 
 
@@ -211,6 +228,29 @@ std::ostream& operator<<(std::ostream& out, const PriorityQueue<V>& pQueue) {
 
 
 
+/**
+ * Raddoppia la lunghezza massima dello heap, copiando gli elementi presenti
+ * in un nuovo array. Il costo della copia, ammortizzato sugli inserimenti, e' costante.
+ *
+ * @tparam T: Tipo di dato contenuto nella coda con priorita'
+ */
+template <class T>
+void PriorityQueue<T>::_grow()
+{
+    std::size_t newLength = (this->_length == 0) ? this->_DEFAULT_SIZE : this->_length * 2;
+    Type* newHeap = new Type[newLength];
+
+    for (std::size_t i = 0; i < this->_currentSize; i++)
+    {
+        newHeap[i] = this->_heap[i];
+    }
+
+    delete[] this->_heap;
+
+    this->_heap = newHeap;
+    this->_length = newLength;
+}
+
 /**
  * Effettua uno o piu' scambi foglia-radice per fare in modo che venga rispettata
  * la proprieta' 3 della coda con priorita'
@@ -220,52 +260,31 @@ std::ostream& operator<<(std::ostream& out, const PriorityQueue<V>& pQueue) {
 template <class T>
 void PriorityQueue<T>::_fixUp()
 {
-    int currentChildPos = this->_currentSize - 1;
-    int currentParentPos;
+    std::size_t currentChildPos = this->_currentSize - 1;
 
     /**
      * Analizzo l'ultimo elemento inserito nell'albero. se questo non rispetta la proprieta' 3 delle
-     * code con priorita' (ovvero deve avere un valore >= a quello del genitore) allora effettuo uno
-     * scambio con il genitore
+     * code con priorita' (ovvero deve avere un valore >= a quello del genitore) allora faccio
+     * scendere il genitore al suo posto, fino a trovare la posizione corretta dell'elemento.
+     * Il genitore della posizione i (con indici a partire da 0) si trova in (i - 1) / 2
      */
 
     Type currentChild = this->_heap[currentChildPos];
-    Type currentParent;
-
-    if(currentChildPos % 2 == 0)
-    {
-        currentParentPos = currentChildPos / 2 - 1;
-    }
-
-    else
-    {
-        currentParentPos = currentChildPos / 2;
-    }
-
-    currentParent = this->_heap[currentParentPos];
 
-    while((currentChildPos > 0) && (currentChild < currentParent))
+    while (currentChildPos > 0)
     {
-        //faccio lo scambio
+        std::size_t currentParentPos = (currentChildPos - 1) / 2;
 
-        Type temp = currentChild;
-        this->_heap[currentChildPos] = this->_heap[currentParentPos];
-        this->_heap[currentParentPos] = temp;
-
-        currentChildPos = currentParentPos;
-
-        if(currentChildPos % 2 == 0)
-        {
-            currentParentPos = currentChildPos / 2 - 1;
-        }
-        else
+        if (!(currentChild < this->_heap[currentParentPos]))
         {
-            currentParentPos = currentChildPos / 2;
+            break;
         }
 
-        currentChild = this->_heap[currentChildPos];
-        currentParent = this->_heap[currentParentPos];
+        this->_heap[currentChildPos] = this->_heap[currentParentPos];
+        currentChildPos = currentParentPos;
     }
+
+    this->_heap[currentChildPos] = currentChild;
 }
 
 /**
@@ -0,0 +1,268 @@
+#ifndef _CONCURRENTUNIONFIND_H
+#define _CONCURRENTUNIONFIND_H
+
+#include "IUnionFind.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Struttura union-find senza lock, per unioni e ricerche eseguite da piu' thread
+ * contemporaneamente (ad esempio l'etichettatura parallela delle componenti connesse).
+ *
+ * Ogni elemento e' una parola atomica a 64 bit che contiene il padre (32 bit bassi) e il
+ * rango (32 bit alti, significativo solo per le radici), cosi' che una sola CAS controlli
+ * insieme che un elemento sia ancora radice e che il suo rango non sia cambiato:
+ *  - unite collega la radice con chiave (rango, -id) minore sotto l'altra, con una CAS
+ *    che fallisce se la radice nel frattempo e' stata collegata altrove; in quel caso la
+ *    ricerca ricomincia. Poiche' le chiavi crescono strettamente lungo i padri non si
+ *    possono formare cicli, e a parita' di rango l'incremento del rango della nuova
+ *    radice e' tentato con una seconda CAS, che puo' fallire senza danni;
+ *  - find dimezza il cammino con CAS che collegano un elemento al nonno, ignorando i
+ *    fallimenti dovuti ad altri thread.
+ * getSetAmount e' esatto solo quando nessun thread sta eseguendo unioni.
+ *
+ * reset non e' thread-safe: va chiamato prima di avviare i thread.
+ */
+class ConcurrentUnionFind : public IUnionFind
+{
+    private:
+        std::vector< std::atomic<uint64_t> > _nodes; // Padre e rango di ogni elemento
+        std::atomic<uint32_t> _setAmount; // Numero di insiemi disgiunti
+
+    private:
+        static uint64_t _pack(uint32_t parent, uint32_t rank);
+        static uint32_t _parent(uint64_t node);
+        static uint32_t _rank(uint64_t node);
+
+    public:
+        ConcurrentUnionFind();
+        ConcurrentUnionFind(uint32_t size);
+
+        void reset(uint32_t size);
+
+        uint32_t getSize() const;
+        uint32_t getSetAmount() const;
+
+        uint32_t find(uint32_t element);
+        bool unite(uint32_t first, uint32_t second);
+        bool connected(uint32_t first, uint32_t second);
+};
+
+
+/**
+ * Crea una struttura union-find concorrente vuota
+ */
+inline ConcurrentUnionFind::ConcurrentUnionFind() : ConcurrentUnionFind(0) { }
+
+/**
+ * Crea una struttura union-find concorrente con size elementi, ognuno in un insieme a se'
+ *
+ * @param size : Numero di elementi
+ */
+inline ConcurrentUnionFind::ConcurrentUnionFind(uint32_t size) : _setAmount(0)
+{
+    this->reset(size);
+}
+
+/**
+ * Riporta la struttura a size elementi, ognuno in un insieme a se'.
+ * Non deve essere eseguito mentre altri thread usano la struttura.
+ *
+ * @param size : Numero di elementi
+ */
+inline void ConcurrentUnionFind::reset(uint32_t size)
+{
+    if (this->_nodes.size() != size)
+    {
+        std::vector< std::atomic<uint64_t> > nodes(size);
+
+        this->_nodes.swap(nodes);
+    }
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        this->_nodes[i].store(_pack(i, 0), std::memory_order_relaxed);
+    }
+
+    this->_setAmount.store(size);
+}
+
+/**
+ * Restituisce il numero di elementi
+ *
+ * @return Numero di elementi
+ */
+inline uint32_t ConcurrentUnionFind::getSize() const
+{
+    return (uint32_t) this->_nodes.size();
+}
+
+/**
+ * Restituisce il numero di insiemi disgiunti
+ *
+ * @return Numero di insiemi
+ */
+inline uint32_t ConcurrentUnionFind::getSetAmount() const
+{
+    return this->_setAmount.load();
+}
+
+/**
+ * Restituisce il rappresentante dell'insieme che contiene element. Lungo la risalita
+ * ogni elemento visitato viene collegato al nonno con una CAS, dimezzando il cammino.
+ * Se altri thread stanno unendo insiemi, il rappresentante restituito puo' essere gia'
+ * stato collegato a un'altra radice.
+ *
+ * @param element : Elemento da cercare
+ * @return Rappresentante dell'insieme
+ */
+inline uint32_t ConcurrentUnionFind::find(uint32_t element)
+{
+    while (true)
+    {
+        uint64_t node = this->_nodes[element].load(std::memory_order_acquire);
+        uint32_t parent = _parent(node);
+
+        if (parent == element)
+        {
+            return element;
+        }
+
+        uint32_t grandParent = _parent(this->_nodes[parent].load(std::memory_order_acquire));
+
+        if (grandParent != parent)
+        {
+            this->_nodes[element].compare_exchange_weak(node, _pack(grandParent, _rank(node)), std::memory_order_release, std::memory_order_relaxed);
+        }
+
+        element = grandParent;
+    }
+}
+
+/**
+ * Unisce gli insiemi che contengono first e second
+ *
+ * @param first : Elemento del primo insieme
+ * @param second : Elemento del secondo insieme
+ * @return True se questa chiamata ha unito due insiemi distinti, false se first e second erano gia' nello stesso insieme
+ */
+inline bool ConcurrentUnionFind::unite(uint32_t first, uint32_t second)
+{
+    while (true)
+    {
+        first = this->find(first);
+        second = this->find(second);
+
+        if (first == second)
+        {
+            return false;
+        }
+
+        uint64_t firstNode = this->_nodes[first].load(std::memory_order_acquire);
+        uint64_t secondNode = this->_nodes[second].load(std::memory_order_acquire);
+
+        // Una delle due non e' piu' radice: la ricerca ricomincia dalle nuove radici
+        if (_parent(firstNode) != first || _parent(secondNode) != second)
+        {
+            continue;
+        }
+
+        uint32_t firstRank = _rank(firstNode);
+        uint32_t secondRank = _rank(secondNode);
+
+        // first diventa la radice con chiave (rango, -id) minore, che viene collegata sotto second
+        if (firstRank > secondRank || (firstRank == secondRank && first < second))
+        {
+            uint32_t swap = first;
+            uint64_t swapNode = firstNode;
+
+            first = second;
+            second = swap;
+            firstNode = secondNode;
+            secondNode = swapNode;
+            firstRank = _rank(firstNode);
+            secondRank = _rank(secondNode);
+        }
+
+        if (!this->_nodes[first].compare_exchange_strong(firstNode, _pack(second, firstRank), std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            continue;
+        }
+
+        if (firstRank == secondRank)
+        {
+            this->_nodes[second].compare_exchange_strong(secondNode, _pack(second, secondRank + 1), std::memory_order_acq_rel, std::memory_order_relaxed);
+        }
+
+        this->_setAmount.fetch_sub(1, std::memory_order_relaxed);
+
+        return true;
+    }
+}
+
+/**
+ * Restituisce true se first e second sono nello stesso insieme. Se altri thread stanno
+ * unendo insiemi, il risultato e' corretto per un istante durante la chiamata.
+ *
+ * @param first : Primo elemento
+ * @param second : Secondo elemento
+ * @return True se first e second sono nello stesso insieme, altrimenti false
+ */
+inline bool ConcurrentUnionFind::connected(uint32_t first, uint32_t second)
+{
+    while (true)
+    {
+        first = this->find(first);
+        second = this->find(second);
+
+        if (first == second)
+        {
+            return true;
+        }
+
+        // Se first e' ancora radice, i due insiemi erano distinti dopo la ricerca di second
+        if (_parent(this->_nodes[first].load(std::memory_order_acquire)) == first)
+        {
+            return false;
+        }
+    }
+}
+
+
+/**
+ * Compone la parola atomica di un elemento
+ *
+ * @param parent : Padre dell'elemento
+ * @param rank : Rango dell'elemento
+ * @return Parola con il padre nei 32 bit bassi e il rango in quelli alti
+ */
+inline uint64_t ConcurrentUnionFind::_pack(uint32_t parent, uint32_t rank)
+{
+    return ((uint64_t) rank << 32) | parent;
+}
+
+/**
+ * Estrae il padre dalla parola atomica di un elemento
+ *
+ * @param node : Parola dell'elemento
+ * @return Padre dell'elemento
+ */
+inline uint32_t ConcurrentUnionFind::_parent(uint64_t node)
+{
+    return (uint32_t) node;
+}
+
+/**
+ * Estrae il rango dalla parola atomica di un elemento
+ *
+ * @param node : Parola dell'elemento
+ * @return Rango dell'elemento
+ */
+inline uint32_t ConcurrentUnionFind::_rank(uint64_t node)
+{
+    return (uint32_t) (node >> 32);
+}
+
+#endif // _CONCURRENTUNIONFIND_H
@@ -0,0 +1,66 @@
+#ifndef _IUNIONFIND_H
+#define _IUNIONFIND_H
+
+#include <cstdint>
+
+/**
+ * Interfaccia di una struttura union-find (insiemi disgiunti) sugli elementi 0, ..., size - 1.
+ *
+ * Ogni insieme e' identificato da un suo elemento, il rappresentante, restituito da find:
+ * due elementi stanno nello stesso insieme sse hanno lo stesso rappresentante. Il
+ * rappresentante di un insieme puo' cambiare dopo un'unione.
+ *
+ * Implementazioni: UnionFind, sequenziale, e ConcurrentUnionFind, per unioni da piu' thread.
+ */
+class IUnionFind
+{
+    public:
+        /**
+         * Riporta la struttura a size elementi, ognuno in un insieme a se'
+         *
+         * @param size : Numero di elementi
+         */
+        virtual void reset(uint32_t size) = 0;
+
+        /**
+         * Restituisce il numero di elementi
+         *
+         * @return Numero di elementi
+         */
+        virtual uint32_t getSize() const = 0;
+
+        /**
+         * Restituisce il numero di insiemi disgiunti
+         *
+         * @return Numero di insiemi
+         */
+        virtual uint32_t getSetAmount() const = 0;
+
+        /**
+         * Restituisce il rappresentante dell'insieme che contiene element
+         *
+         * @param element : Elemento da cercare, minore di getSize()
+         * @return Rappresentante dell'insieme
+         */
+        virtual uint32_t find(uint32_t element) = 0;
+
+        /**
+         * Unisce gli insiemi che contengono first e second
+         *
+         * @param first : Primo elemento
+         * @param second : Secondo elemento
+         * @return true se gli insiemi erano distinti, false se erano gia' lo stesso insieme
+         */
+        virtual bool unite(uint32_t first, uint32_t second) = 0;
+
+        /**
+         * Verifica se first e second stanno nello stesso insieme
+         *
+         * @param first : Primo elemento
+         * @param second : Secondo elemento
+         * @return true se stanno nello stesso insieme, false altrimenti
+         */
+        virtual bool connected(uint32_t first, uint32_t second) = 0;
+};
+
+#endif // _IUNIONFIND_H
@@ -0,0 +1,184 @@
+#ifndef _UNIONFIND_H
+#define _UNIONFIND_H
+
+#include "IUnionFind.h"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Struttura union-find (insiemi disgiunti) sugli elementi 0, ..., size - 1.
+ *
+ * Ogni insieme e' un albero, memorizzato in due array piatti (padri e ranghi), con la
+ * radice come rappresentante. L'unione appende l'albero di rango minore sotto la radice
+ * di quello di rango maggiore (union by rank) e la ricerca dimezza il cammino verso la
+ * radice (path halving): insieme garantiscono un costo ammortizzato quasi costante per
+ * operazione. Il rango e' un limite superiore all'altezza dell'albero, quindi non supera
+ * mai 32 e sta in un byte.
+ *
+ * Per unioni da piu' thread si usa ConcurrentUnionFind.
+ */
+class UnionFind : public IUnionFind
+{
+    private:
+        std::vector<uint32_t> _parents; // Padre di ogni elemento, la radice e' padre di se' stessa
+        std::vector<uint8_t> _ranks; // Rango di ogni albero, significativo solo per le radici
+        uint32_t _setAmount; // Numero di insiemi disgiunti
+
+    public:
+        UnionFind();
+        UnionFind(uint32_t size);
+
+        void reset(uint32_t size);
+        void grow(uint32_t size);
+
+        uint32_t getSize() const;
+        uint32_t getSetAmount() const;
+
+        uint32_t find(uint32_t element);
+        bool unite(uint32_t first, uint32_t second);
+        bool connected(uint32_t first, uint32_t second);
+};
+
+
+/**
+ * Crea una struttura union-find vuota
+ */
+inline UnionFind::UnionFind() : UnionFind(0) { }
+
+/**
+ * Crea una struttura union-find con size elementi, ognuno in un insieme a se'
+ *
+ * @param size : Numero di elementi
+ */
+inline UnionFind::UnionFind(uint32_t size)
+{
+    this->reset(size);
+}
+
+/**
+ * Riporta la struttura a size elementi, ognuno in un insieme a se'
+ *
+ * @param size : Numero di elementi
+ */
+inline void UnionFind::reset(uint32_t size)
+{
+    this->_parents.clear();
+    this->_ranks.clear();
+    this->_setAmount = 0;
+    this->grow(size);
+}
+
+/**
+ * Porta la struttura a size elementi aggiungendo in fondo elementi in insiemi a se';
+ * gli insiemi esistenti non cambiano. Se size non supera la dimensione attuale non
+ * succede nulla.
+ *
+ * @param size : Nuovo numero di elementi
+ */
+inline void UnionFind::grow(uint32_t size)
+{
+    uint32_t current = this->getSize();
+
+    if (size <= current)
+    {
+        return;
+    }
+
+    this->_parents.resize(size);
+    this->_ranks.resize(size, 0);
+    this->_setAmount += size - current;
+
+    for (uint32_t i = current; i < size; i++)
+    {
+        this->_parents[i] = i;
+    }
+}
+
+/**
+ * Restituisce il numero di elementi
+ *
+ * @return Numero di elementi
+ */
+inline uint32_t UnionFind::getSize() const
+{
+    return (uint32_t) this->_parents.size();
+}
+
+/**
+ * Restituisce il numero di insiemi disgiunti
+ *
+ * @return Numero di insiemi
+ */
+inline uint32_t UnionFind::getSetAmount() const
+{
+    return this->_setAmount;
+}
+
+/**
+ * Restituisce il rappresentante dell'insieme che contiene element. Lungo la risalita
+ * ogni elemento visitato viene collegato al nonno, dimezzando il cammino.
+ *
+ * @param element : Elemento da cercare
+ * @return Rappresentante dell'insieme
+ */
+inline uint32_t UnionFind::find(uint32_t element)
+{
+    while (this->_parents[element] != element)
+    {
+        this->_parents[element] = this->_parents[this->_parents[element]];
+        element = this->_parents[element];
+    }
+
+    return element;
+}
+
+/**
+ * Unisce gli insiemi che contengono first e second
+ *
+ * @param first : Elemento del primo insieme
+ * @param second : Elemento del secondo insieme
+ * @return True se gli insiemi erano distinti, false se first e second erano gia' nello stesso insieme
+ */
+inline bool UnionFind::unite(uint32_t first, uint32_t second)
+{
+    first = this->find(first);
+    second = this->find(second);
+
+    if (first == second)
+    {
+        return false;
+    }
+
+    if (this->_ranks[first] < this->_ranks[second])
+    {
+        uint32_t swap = first;
+
+        first = second;
+        second = swap;
+    }
+
+    else if (this->_ranks[first] == this->_ranks[second])
+    {
+        this->_ranks[first]++;
+    }
+
+    this->_parents[second] = first;
+    this->_setAmount--;
+
+    return true;
+}
+
+/**
+ * Restituisce true se first e second sono nello stesso insieme
+ *
+ * @param first : Primo elemento
+ * @param second : Secondo elemento
+ * @return True se first e second sono nello stesso insieme, altrimenti false
+ */
+inline bool UnionFind::connected(uint32_t first, uint32_t second)
+{
+    return this->find(first) == this->find(second);
+}
+
+#endif // _UNIONFIND_H